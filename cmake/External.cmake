@@ -296,12 +296,18 @@ if(LSTG_PLATFORM_EMSCRIPTEN)
 
     add_library(lstg::liblua-static ALIAS lua51.liblua-static)
 else()
+    if(LSTG_LUAJIT_FFI)
+        set(LSTG_LUAJIT_DISABLE_FFI OFF)
+    else()
+        set(LSTG_LUAJIT_DISABLE_FFI ON)
+    endif()
+
     CPMAddPackage(
         NAME luajit
         GITHUB_REPOSITORY GameDevDeps/luajit
         GIT_TAG luajit2/v2.1-20231117
         OPTIONS
-            "LUAJIT_DISABLE_FFI ON"
+            "LUAJIT_DISABLE_FFI ${LSTG_LUAJIT_DISABLE_FFI}"
             "LUAJIT_DISABLE_BUFFER ON"
     )
 
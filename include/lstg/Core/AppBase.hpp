@@ -79,6 +79,13 @@ namespace lstg
          */
         void SetFrameRate(double rate) noexcept;
 
+        /**
+         * 获取空闲时间
+         * 即上一帧执行完毕后距离下一帧开始的时间，可用于安排不紧急的工作（例如 GC）。
+         * @return 空闲时间（秒）
+         */
+        [[nodiscard]] double GetIdleTime() const noexcept { return m_dIdleTime; }
+
         /**
          * 启动应用程序循环
          */
@@ -150,6 +157,7 @@ namespace lstg
         double m_dFrameInterval = 1. / 60.;
         uint32_t m_uRenderFrameSkip = 0;
         TimerTask m_stFrameTask;
+        double m_dIdleTime = 0.;
 #ifdef LSTG_PLATFORM_EMSCRIPTEN
         long m_lTimeoutId = 0;  // 主逻辑循环定时器
         bool m_bRenderEmit = false;  // HTML下，渲染不跟随逻辑进行，通过标志位控制
@@ -6,6 +6,7 @@
  */
 #pragma once
 #include <array>
+#include <type_traits>
 #include "../Span.hpp"
 #include "../Result.hpp"
 #include "EncodingError.hpp"
@@ -59,6 +60,22 @@ namespace lstg::Encoding
         return true;
     }
 
+    /**
+     * 批量转码器
+     * 编码对可以特化此模板，按块转换输入以绕开逐字符的编解码过程。
+     * 特化需要提供：
+     *   - kAvailable 为 true
+     *   - kMaxExpansion 每个输入单元最多产生的输出单元数
+     *   - size_t Convert(OutputUnit* out, const InputUnit* src, size_t length, size_t& written) noexcept
+     *     从头转换尽可能多的完整且合法的字符，遇到非法或不完整的序列时停止，返回消耗的输入单元数
+     * Convert 会将剩余部分交给编解码器处理，因此结果与逐字符处理完全一致。
+     */
+    template <typename InputEncoding, typename OutputEncoding>
+    struct BulkConverter
+    {
+        static constexpr bool kAvailable = false;
+    };
+
     /**
      * 单向编码视图
      * 将编码过程迭代器化。
@@ -511,14 +528,34 @@ namespace lstg::Encoding
         FailureFallbackCallbackType<typename InputEncoding::Decoder> decoderFailureFallback = nullptr,
         FailureFallbackCallbackType<typename OutputEncoding::Encoder> encoderFailureFallback = nullptr) noexcept
     {
-        ConvertingView<InputEncoding, OutputEncoding, InputType> view({ src.data(), src.size() }, decoderFailureFallback,
-            encoderFailureFallback);
+        using TBulkConverter = BulkConverter<InputEncoding, OutputEncoding>;
 
         try
         {
             builder.clear();
-            builder.reserve(src.size());
 
+            // 先由批量转码器处理尽可能长的前缀
+            size_t consumed = 0;
+            if constexpr (TBulkConverter::kAvailable &&
+                std::is_same_v<InputType, typename InputEncoding::Decoder::InputType> &&
+                std::is_same_v<OutputType, typename OutputEncoding::Encoder::OutputType>)
+            {
+                size_t written = 0;
+                builder.resize(src.size() * TBulkConverter::kMaxExpansion);
+                consumed = TBulkConverter::Convert(builder.data(), src.data(), src.size(), written);
+                assert(consumed <= src.size() && written <= builder.size());
+                builder.resize(written);
+                if (consumed == src.size())
+                    return {};
+            }
+            else
+            {
+                builder.reserve(src.size());
+            }
+
+            // 剩余部分从合法字符的边界开始，逐字符处理
+            ConvertingView<InputEncoding, OutputEncoding, InputType> view({ src.data() + consumed, src.size() - consumed },
+                decoderFailureFallback, encoderFailureFallback);
             for (const auto ret : view)
             {
                 if (!ret)
@@ -212,4 +212,53 @@ namespace lstg::Encoding
             }
         };
     };
+
+    /**
+     * UTF8 到 UTF16 的批量转码
+     * ASCII 部分按 SIMD 宽度整块处理。
+     */
+    template <>
+    struct BulkConverter<Utf8, Utf16>
+    {
+        static constexpr bool kAvailable = true;
+        static constexpr size_t kMaxExpansion = 1;
+
+        static size_t Convert(char16_t* out, const char* src, size_t length, size_t& written) noexcept;
+    };
+
+    /**
+     * UTF16 到 UTF8 的批量转码
+     */
+    template <>
+    struct BulkConverter<Utf16, Utf8>
+    {
+        static constexpr bool kAvailable = true;
+        static constexpr size_t kMaxExpansion = 3;
+
+        static size_t Convert(char* out, const char16_t* src, size_t length, size_t& written) noexcept;
+    };
+
+    /**
+     * UTF8 到 UTF32 的批量转码
+     */
+    template <>
+    struct BulkConverter<Utf8, Utf32>
+    {
+        static constexpr bool kAvailable = true;
+        static constexpr size_t kMaxExpansion = 1;
+
+        static size_t Convert(char32_t* out, const char* src, size_t length, size_t& written) noexcept;
+    };
+
+    /**
+     * UTF32 到 UTF8 的批量转码
+     */
+    template <>
+    struct BulkConverter<Utf32, Utf8>
+    {
+        static constexpr bool kAvailable = true;
+        static constexpr size_t kMaxExpansion = 4;
+
+        static size_t Convert(char* out, const char32_t* src, size_t length, size_t& written) noexcept;
+    };
 }
@@ -0,0 +1,210 @@
+/**
+ * @file
+ * @date 2022/8/14
+ * @author 9chu
+ * 此文件为 LuaSTGPlus 项目的一部分，版权与许可声明详见 COPYRIGHT.txt。
+ */
+#pragma once
+#include <cstdint>
+#include <cassert>
+#include <algorithm>
+#include <vector>
+#include <type_traits>
+#if !(defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_PTHREADS__))
+#include <atomic>
+#endif
+#include "ThreadPool.hpp"
+
+namespace lstg
+{
+#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_PTHREADS__)
+    template <typename Mode = SingleThreadModeTag>
+    class ForkJoinPool;
+#else
+    template <typename Mode = MultiThreadModeTag>
+    class ForkJoinPool;
+#endif
+
+    /**
+     * 分叉-合并线程池
+     * 单线程特化，所有任务在调用线程上直接执行。
+     */
+    template <>
+    class ForkJoinPool<SingleThreadModeTag>
+    {
+    public:
+        explicit ForkJoinPool(uint32_t /* workThreadCount */) {}
+
+    public:
+        /**
+         * 获取并发度（含调用线程）
+         */
+        [[nodiscard]] uint32_t GetConcurrency() const noexcept { return 1u; }
+
+        /**
+         * 并行执行区间任务
+         * @tparam TFunc 任务类型，签名为 void(size_t begin, size_t end) noexcept
+         * @param count 元素个数
+         * @param minBatchSize 单个批次的最小元素个数
+         * @param func 任务
+         */
+        template <typename TFunc>
+        void For(size_t count, size_t /* minBatchSize */, TFunc&& func) noexcept
+        {
+            if (count > 0)
+                func(static_cast<size_t>(0), count);
+        }
+    };
+
+#if !(defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_PTHREADS__))
+    /**
+     * 分叉-合并线程池
+     * 与 ThreadPool 不同，For 方法会阻塞直到所有批次执行完毕，调用线程也参与执行。
+     * 适用于在一帧内需要同步得到结果的数据并行任务。
+     */
+    template <>
+    class ForkJoinPool<MultiThreadModeTag>
+    {
+    public:
+        /**
+         * 构造线程池
+         * @param workThreadCount 工作线程数量，为 0 时所有任务在调用线程上执行
+         */
+        explicit ForkJoinPool(uint32_t workThreadCount)
+        {
+            for (uint32_t i = 0; i < workThreadCount; ++i)
+            {
+                m_stThreads.emplace_back(std::thread([this]() {
+                    ThreadJob();
+                }));
+            }
+        }
+
+        ForkJoinPool(const ForkJoinPool&) = delete;
+        ForkJoinPool(ForkJoinPool&&) = delete;
+
+        ~ForkJoinPool() noexcept
+        {
+            {
+                std::unique_lock<std::mutex> lockGuard(m_stMutex);
+                m_bThreadStopped = true;
+            }
+            m_stWakeCondVar.notify_all();
+            for (auto& thread : m_stThreads)
+                thread.join();
+        }
+
+    public:
+        /**
+         * 获取并发度（含调用线程）
+         */
+        [[nodiscard]] uint32_t GetConcurrency() const noexcept { return static_cast<uint32_t>(m_stThreads.size()) + 1u; }
+
+        /**
+         * 并行执行区间任务
+         * 区间 [0, count) 被切分为若干批次，由工作线程与调用线程共同领取执行，所有批次完成后返回。
+         * @note 不可重入，只能在单一线程上调用
+         * @tparam TFunc 任务类型，签名为 void(size_t begin, size_t end) noexcept
+         * @param count 元素个数
+         * @param minBatchSize 单个批次的最小元素个数
+         * @param func 任务
+         */
+        template <typename TFunc>
+        void For(size_t count, size_t minBatchSize, TFunc&& func) noexcept
+        {
+            if (count == 0)
+                return;
+
+            // 数据量过小时不值得唤醒工作线程
+            minBatchSize = std::max<size_t>(1u, minBatchSize);
+            if (m_stThreads.empty() || count <= minBatchSize)
+            {
+                func(static_cast<size_t>(0), count);
+                return;
+            }
+
+            // 每个线程大约领取 4 个批次，以平衡负载
+            auto batchSize = std::max(minBatchSize, (count + GetConcurrency() * 4u - 1u) / (GetConcurrency() * 4u));
+
+            // 发布任务
+            {
+                std::unique_lock<std::mutex> lockGuard(m_stMutex);
+                assert(m_uActiveThreads == 0);
+                m_pTaskContext = const_cast<void*>(static_cast<const void*>(&func));
+                m_pTaskInvoker = [](void* context, size_t begin, size_t end) noexcept {
+                    (*static_cast<std::remove_reference_t<TFunc>*>(context))(begin, end);
+                };
+                m_uTaskCount = count;
+                m_uTaskBatchSize = batchSize;
+                m_uNextTaskIndex.store(0, std::memory_order_relaxed);
+                m_uActiveThreads = static_cast<uint32_t>(m_stThreads.size());
+                ++m_ullGeneration;
+            }
+            m_stWakeCondVar.notify_all();
+
+            // 调用线程同样参与执行
+            RunBatches();
+
+            // 等待所有工作线程退出本轮任务
+            {
+                std::unique_lock<std::mutex> lockGuard(m_stMutex);
+                m_stDoneCondVar.wait(lockGuard, [this]() { return m_uActiveThreads == 0; });
+                m_pTaskContext = nullptr;
+                m_pTaskInvoker = nullptr;
+            }
+        }
+
+    private:
+        void RunBatches() noexcept
+        {
+            while (true)
+            {
+                auto begin = m_uNextTaskIndex.fetch_add(m_uTaskBatchSize, std::memory_order_relaxed);
+                if (begin >= m_uTaskCount)
+                    break;
+                auto end = std::min(begin + m_uTaskBatchSize, m_uTaskCount);
+                m_pTaskInvoker(m_pTaskContext, begin, end);
+            }
+        }
+
+        void ThreadJob() noexcept
+        {
+            uint64_t seenGeneration = 0;
+            std::unique_lock<std::mutex> lockGuard(m_stMutex);
+            while (true)
+            {
+                m_stWakeCondVar.wait(lockGuard, [&]() { return m_bThreadStopped || m_ullGeneration != seenGeneration; });
+                if (m_bThreadStopped)
+                    break;
+                seenGeneration = m_ullGeneration;
+
+                // 任务参数在 m_uActiveThreads 归零前不会被修改，可以解锁执行
+                lockGuard.unlock();
+                RunBatches();
+                lockGuard.lock();
+
+                assert(m_uActiveThreads > 0);
+                if (--m_uActiveThreads == 0)
+                    m_stDoneCondVar.notify_one();
+            }
+        }
+
+    private:
+        std::vector<std::thread> m_stThreads;
+
+        std::mutex m_stMutex;
+        std::condition_variable m_stWakeCondVar;
+        std::condition_variable m_stDoneCondVar;
+        bool m_bThreadStopped = false;
+        uint64_t m_ullGeneration = 0;
+        uint32_t m_uActiveThreads = 0;
+
+        // 当前任务
+        void* m_pTaskContext = nullptr;
+        void (*m_pTaskInvoker)(void*, size_t, size_t) noexcept = nullptr;
+        size_t m_uTaskCount = 0;
+        size_t m_uTaskBatchSize = 1;
+        std::atomic<size_t> m_uNextTaskIndex { 0 };
+    };
+#endif
+}
@@ -177,6 +177,43 @@ namespace lstg
         }
     }
 
+    /**
+     * 在指定节点后插入跳表节点
+     * 调用方需要保证插入后依然有序。高层的前驱通过在下一层向前查找得到，期望步数为常数，适用于已知插入位置的场合。
+     * @tparam Depth 深度
+     * @tparam TDepthRandomizer 深度随机数发生器类型
+     * @param prev 前驱节点，可以是头结点
+     * @param node 节点
+     * @param randomizer 随机数发生器类型
+     */
+    template <size_t Depth, typename TDepthRandomizer>
+    inline void SkipListInsertAfter(IntrusiveSkipListNode<Depth>* prev, IntrusiveSkipListNode<Depth>* node,
+        TDepthRandomizer& randomizer) noexcept
+    {
+        static_assert(Depth > 0, "Invalid link list");
+
+        auto insertDepth = randomizer();
+        assert(0u < insertDepth && insertDepth <= Depth);
+        assert(prev->Adj[0].Next != nullptr);  // prev 不能是尾结点
+        auto p = prev;
+
+        for (size_t curDepth = 0; curDepth < insertDepth; ++curDepth)
+        {
+            // 找到本层的前驱，头结点在每一层都有链接
+            while (p->Adj[curDepth].Next == nullptr)
+            {
+                assert(curDepth > 0);
+                p = p->Adj[curDepth - 1].Prev;
+                assert(p != nullptr);
+            }
+
+            node->Adj[curDepth].Prev = p;
+            node->Adj[curDepth].Next = p->Adj[curDepth].Next;
+            p->Adj[curDepth].Next->Adj[curDepth].Prev = node;
+            p->Adj[curDepth].Next = node;
+        }
+    }
+
     /**
      * 跳表深度计算器
      * 通过随机的方式决定如何产生某个节点的跳表深度。
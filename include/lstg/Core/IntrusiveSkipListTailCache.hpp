@@ -0,0 +1,137 @@
+/**
+ * @file
+ * @date 2022/10/4
+ * @author 9chu
+ * 此文件为 LuaSTGPlus 项目的一部分，版权与许可声明详见 COPYRIGHT.txt。
+ */
+#pragma once
+#include <unordered_map>
+#include "IntrusiveSkipList.hpp"
+
+namespace lstg
+{
+    /**
+     * 跳表分组尾部缓存
+     * 跳表按 (分组键, 创建序号) 排序时，新节点的序号最大，总是追加在其分组末尾。记录每个分组最后一个节点，插入时直接追加，跳过跳表查找。
+     * 节点内存可能移动，因此只缓存句柄，使用前校验其是否依然位于分组末尾。访问器需要提供：
+     *   - TKey GetKey(IntrusiveSkipListNode<Depth>*)：取节点的分组键
+     *   - THandle GetHandle(IntrusiveSkipListNode<Depth>*)：取节点的句柄
+     *   - IntrusiveSkipListNode<Depth>* Resolve(THandle)：由句柄取节点，句柄失效时返回 nullptr
+     * @tparam Depth 深度
+     * @tparam TKey 分组键类型
+     * @tparam THandle 句柄类型
+     * @tparam MaxEntries 最大条目数，分组键可能是连续变化的值，超出上限时直接清空
+     */
+    template <size_t Depth, typename TKey, typename THandle, size_t MaxEntries = 64u>
+    class IntrusiveSkipListTailCache
+    {
+    public:
+        using Node = IntrusiveSkipListNode<Depth>;
+
+    public:
+        /**
+         * 插入节点
+         * 缓存的节点依然位于分组末尾且排在新节点之前时，直接插入其后，否则退化为跳表查找。
+         * @param tail 尾节点
+         * @param node 节点
+         * @param accessor 访问器
+         * @param comparer 比较器
+         * @param randomizer 随机数发生器
+         */
+        template <typename TAccessor, typename TComparer, typename TDepthRandomizer>
+        void Insert(Node* tail, Node* node, TAccessor&& accessor, TComparer&& comparer, TDepthRandomizer& randomizer) noexcept
+        {
+            assert(node->Adj[0].Prev == nullptr);
+
+            auto key = accessor.GetKey(node);
+            auto it = m_stTails.find(key);
+            if (it != m_stTails.end())
+            {
+                auto cached = accessor.Resolve(it->second);
+                if (cached && cached->Adj[0].Prev && accessor.GetKey(cached) == key && comparer(cached, node))
+                {
+                    auto next = cached->Adj[0].Next;
+                    if (next == tail || accessor.GetKey(next) != key)
+                    {
+                        SkipListInsertAfter(cached, node, randomizer);
+                        it->second = accessor.GetHandle(node);
+                        return;
+                    }
+                }
+            }
+
+            SkipListInsert(tail, node, comparer, randomizer);
+            Update(tail, node, accessor);
+        }
+
+        /**
+         * 节点的分组键修改后重新排序
+         * 与相邻节点依然有序时不需要移动，逐帧小幅修改分组键时较为常见。
+         * @param head 头节点
+         * @param tail 尾节点
+         * @param node 节点
+         * @param accessor 访问器
+         * @param comparer 比较器
+         * @param randomizer 随机数发生器
+         */
+        template <typename TAccessor, typename TComparer, typename TDepthRandomizer>
+        void Reorder(Node* head, Node* tail, Node* node, TAccessor&& accessor, TComparer&& comparer,
+            TDepthRandomizer& randomizer) noexcept
+        {
+            auto prev = node->Adj[0].Prev;
+            auto next = node->Adj[0].Next;
+            if ((prev == head || comparer(prev, node)) && (next == tail || comparer(node, next)))
+            {
+                Update(tail, node, accessor);
+                return;
+            }
+
+            SkipListRemove(node);
+            Insert(tail, node, accessor, comparer, randomizer);
+        }
+
+        /**
+         * 若节点位于其分组末尾，记录到缓存
+         * @param tail 尾节点
+         * @param node 节点
+         * @param accessor 访问器
+         */
+        template <typename TAccessor>
+        void Update(Node* tail, Node* node, TAccessor&& accessor) noexcept
+        {
+            auto key = accessor.GetKey(node);
+            auto next = node->Adj[0].Next;
+            if (next != tail && accessor.GetKey(next) == key)
+                return;
+
+            auto it = m_stTails.find(key);
+            if (it != m_stTails.end())
+            {
+                it->second = accessor.GetHandle(node);
+                return;
+            }
+
+            try
+            {
+                if (m_stTails.size() >= MaxEntries)
+                    m_stTails.clear();
+                m_stTails.emplace(key, accessor.GetHandle(node));
+            }
+            catch (...)  // bad_alloc
+            {
+                // 缓存失败不影响正确性
+            }
+        }
+
+        /**
+         * 清空缓存
+         */
+        void Clear() noexcept
+        {
+            m_stTails.clear();
+        }
+
+    private:
+        std::unordered_map<TKey, THandle> m_stTails;
+    };
+}
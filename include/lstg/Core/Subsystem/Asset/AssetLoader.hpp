@@ -6,6 +6,8 @@
  */
 #pragma once
 #include <atomic>
+#include <vector>
+#include <string_view>
 #include "Asset.hpp"
 
 namespace lstg::Subsystem::Asset
@@ -22,6 +24,7 @@ namespace lstg::Subsystem::Asset
         AsyncLoadCommitted,  // 已提交异步加载队列，此时可以执行 AsyncLoad
         Loading,  // 加载中，此时应该在执行 AsyncLoad
         AsyncLoaded,  // 异步加载完成，此时可以执行 PostLoad
+        Uploading,  // PostLoad 已发起 GPU 上传，等待 Update 中确认完成
         Loaded,  // 加载完毕
         Error,  // 加载过程失败
     };
@@ -79,6 +82,7 @@ namespace lstg::Subsystem::Asset
 
         /**
          * 后加载
+         * 执行后将发生状态切换 -> Loaded | Uploading | Error
          * @note 总是在主线程上调用
          */
         virtual Result<void> PostLoad() noexcept = 0;
@@ -89,6 +93,15 @@ namespace lstg::Subsystem::Asset
          */
         virtual void Update() noexcept = 0;
 
+        /**
+         * 获取依赖的资产
+         * 处于 DependencyLoading 状态时，资源系统据此建立依赖图：在所有依赖资产结束加载（成功或失败）前不再驱动该加载器。
+         * 若依赖尚未确定（例如需要先解析文件才能得知），可以暂时不输出，此时按照原有方式每帧调用 Update。
+         * @note 总是在主线程上调用，内存不足时可能抛出异常
+         * @param out 输出，追加到末尾
+         */
+        virtual void GetDependencies(std::vector<AssetPtr>& out) const { static_cast<void>(out); }
+
 #if LSTG_ASSET_HOT_RELOAD
         /**
          * 检查是否支持热加载
@@ -108,6 +121,13 @@ namespace lstg::Subsystem::Asset
          * @pre GetState() == AssetLoadingStates::Loaded || GetState() == AssetLoadingStates::Error
          */
         virtual void PrepareToReload() noexcept = 0;
+
+        /**
+         * 获取被监视的文件路径
+         * 若资产仅依赖单个文件，返回其路径（相对资产根目录），资源系统将优先通过 VFS 的文件变更通知触发 CheckIsOutdated。
+         * 返回空表示需要每帧轮询（例如依赖于其他资产版本的情况）。
+         */
+        virtual std::string_view GetWatchedPath() const noexcept { return {}; }
 #endif
 
     protected:
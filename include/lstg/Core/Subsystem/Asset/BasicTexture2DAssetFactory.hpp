@@ -9,12 +9,35 @@
 
 namespace lstg::Subsystem::Asset
 {
+    class BasicTexture2DAsset;
+
+    /**
+     * 纹理资产创建参数
+     */
+    struct BasicTexture2DAssetArguments
+    {
+        std::string_view Path;  // 纹理文件路径
+        bool Mipmaps = true;
+    };
+
     /**
      * 纹理资产工厂
      */
     class BasicTexture2DAssetFactory :
         public IAssetFactory
     {
+    public:
+        using AssetType = BasicTexture2DAsset;
+        using ArgumentsType = BasicTexture2DAssetArguments;
+
+        /**
+         * 通过类型化参数创建资产
+         * 供引擎内部使用，可以避免构造和解析 json 参数。
+         * @see IAssetFactory::CreateAsset
+         */
+        Result<CreateAssetResult> CreateAsset(AssetSystem& assetSystem, AssetPoolPtr pool, std::string_view name,
+            const BasicTexture2DAssetArguments& arguments, IAssetDependencyResolver* resolver) noexcept;
+
     public:  // IAssetFactory
         std::string_view GetAssetTypeName() const noexcept override;
         AssetTypeId GetAssetTypeId() const noexcept override;
@@ -5,9 +5,11 @@
  * 此文件为 LuaSTGPlus 项目的一部分，版权与许可声明详见 COPYRIGHT.txt。
  */
 #pragma once
+#include <string>
 #include <optional>
 #include "AssetLoader.hpp"
 #include "../Render/Texture2DData.hpp"
+#include "../Render/TextureUploadRequest.hpp"
 #include "../VFS/IStream.hpp"
 #include "../VFS/IFileSystem.hpp"
 
@@ -31,6 +33,7 @@ namespace lstg::Subsystem::Asset
         bool SupportHotReload() const noexcept override;
         bool CheckIsOutdated() const noexcept override;
         void PrepareToReload() noexcept override;
+        std::string_view GetWatchedPath() const noexcept override;
 #endif
 
     private:
@@ -39,9 +42,12 @@ namespace lstg::Subsystem::Asset
 
         // 状态
         VFS::StreamPtr m_pSourceStream;  // PreLoad 时加载
+        VFS::StreamPtr m_pBakedStream;  // PreLoad 时加载，预烘焙的 DDS/KTX2 纹理，优先于源文件使用
 #if LSTG_ASSET_HOT_RELOAD
+        std::string m_stWatchPath;  // 用于检查修改的文件
         VFS::FileAttribute m_stSourceAttribute;
 #endif
         std::optional<Render::Texture2DData> m_stTextureData;  // AsyncLoad 时加载
+        Render::TextureUploadRequestPtr m_pUploadRequest;  // PostLoad 时发起
     };
 }
@@ -5,6 +5,7 @@
  * 此文件为 LuaSTGPlus 项目的一部分，版权与许可声明详见 COPYRIGHT.txt。
  */
 #pragma once
+#include <cassert>
 #include "VirtualFileSystem.hpp"
 #include "RenderSystem.hpp"
 #include "VFS/IStream.hpp"
@@ -134,6 +135,36 @@ namespace lstg::Subsystem
             return std::static_pointer_cast<T>(*ret);
         }
 
+        /**
+         * 通过类型化参数创建资产
+         * 直接调用工厂的类型化接口，不经过 json 的构造和解析，适用于脚本桥接等高频调用的场合。
+         * @tparam TFactory 工厂类型，需要定义 AssetType、ArgumentsType 以及对应的 CreateAsset 方法
+         * @param pool 资产池
+         * @param name 资产名称
+         * @param arguments 构造参数
+         * @return 资产对象
+         */
+        template <typename TFactory>
+        Result<std::shared_ptr<typename TFactory::AssetType>> CreateAsset(Asset::AssetPoolPtr pool, std::string_view name,
+            const typename TFactory::ArgumentsType& arguments) noexcept
+        {
+            auto factory = FindAssetFactory<typename TFactory::AssetType>();
+            if (!factory)
+                return make_error_code(Asset::AssetError::AssetFactoryNotRegistered);
+            assert(dynamic_cast<TFactory*>(factory.get()));
+
+            assert(pool);
+            assert(m_pResolver);
+            auto ret = static_cast<TFactory*>(factory.get())->CreateAsset(*this, pool, name, arguments, m_pResolver);
+            if (!ret)
+                return ret.GetError();
+
+            auto ret2 = AddCreatedAsset(std::move(pool), name, std::move(*ret));
+            if (!ret2)
+                return ret2.GetError();
+            return std::static_pointer_cast<typename TFactory::AssetType>(*ret2);
+        }
+
     protected:  // ISubsystem
         void OnUpdate(double elapsedTime) noexcept override;
 
@@ -141,8 +172,19 @@ namespace lstg::Subsystem
         void RegisterCoreAssetFactories();
         Result<Asset::AssetPtr> CreateAsset(Asset::AssetPoolPtr pool, Asset::AssetFactoryPtr factory, std::string_view name,
             const nlohmann::json& arguments) noexcept;
+        Result<Asset::AssetPtr> AddCreatedAsset(Asset::AssetPoolPtr pool, std::string_view name, Asset::CreateAssetResult result) noexcept;
         void BlockUntilLoadingFinished(Asset::AssetPtr asset) noexcept;
         Result<void> CommitAsyncLoadTask(Asset::AssetLoaderPtr loader) noexcept;
+        bool WaitForDependencies(const Asset::AssetLoaderPtr& loader) noexcept;
+        void WakeDependentTasks(const Asset::AssetPtr& asset) noexcept;
+#if LSTG_ASSET_HOT_RELOAD
+        void AddWatchTask(Asset::AssetLoaderPtr loader) noexcept;
+        bool WatchTaskByNotification(const Asset::AssetLoaderPtr& loader) noexcept;
+        void ProcessChangedFiles() noexcept;
+        void SweepNotifiedWatchTasks() noexcept;
+        void UnwatchIfUnused(const std::string& path) noexcept;
+        bool ReloadTask(const Asset::AssetLoaderPtr& loader) noexcept;
+#endif
 
     private:
         std::shared_ptr<VirtualFileSystem> m_pVirtualFileSystem;
@@ -161,9 +203,14 @@ namespace lstg::Subsystem
 
         // 加载队列
         std::vector<Asset::AssetLoaderPtr> m_stLoadingTasks;
+        std::unordered_map<Asset::AssetPtr, std::vector<Asset::AssetLoaderPtr>> m_stDependencyWaitingTasks;  // 依赖资产 -> 等待中的任务
+        std::vector<Asset::AssetPtr> m_stDependencyScratch;
 #if LSTG_ASSET_HOT_RELOAD
         size_t m_uLastCheckedTask = 0;
-        std::vector<Asset::AssetLoaderPtr> m_stWatchTasks;
+        std::vector<Asset::AssetLoaderPtr> m_stWatchTasks;  // 需要轮询检查的任务
+        std::unordered_multimap<std::string, Asset::AssetLoaderPtr> m_stNotifiedWatchTasks;  // 由文件变更通知驱动的任务，键为 VFS 路径
+        uint32_t m_uNotifiedWatchSweepCountdown = 0;
+        std::vector<VFS::Path> m_stChangedFiles;
 #endif
     };
 }
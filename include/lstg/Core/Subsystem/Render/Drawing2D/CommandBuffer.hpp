@@ -57,6 +57,22 @@ namespace lstg::Subsystem::Render::Drawing2D
         ColorRGBA32 Color1 = 0x00000000;  // 在默认2D材质中被当做 MultiplierColor
     };
 
+    /**
+     * 精灵实例
+     * 实例化绘制时每个精灵只上传一个该结构，四边形在 VertexShader 中展开。
+     * 展开规则与 SpriteDrawing 的 Shape -> Transform -> Translate 一致。
+     */
+    struct SpriteInstance
+    {
+        glm::vec3 Position;  // 平移
+        float Rotation = 0.f;  // 旋转，弧度
+        glm::vec2 Scale { 1.f, 1.f };  // 缩放
+        glm::vec4 Shape;  // 局部空间下的形状 (左, 上, 右, 下)，Y 向上
+        glm::vec4 TexRect;  // 纹理坐标 (u0, v0, u1, v1)
+        ColorRGBA32 Color0 = 0x00000000;  // 在默认2D材质中被当做 AdditiveColor
+        ColorRGBA32 Color1 = 0x00000000;  // 在默认2D材质中被当做 MultiplierColor
+    };
+
     /**
      * 命令缓冲
      */
@@ -76,6 +92,9 @@ namespace lstg::Subsystem::Render::Drawing2D
             size_t IndexStart = 0;  // Index起始下标
             size_t IndexCount = 0;  // Index个数
             size_t BaseVertexIndex = 0;  // 基准顶点索引
+            bool Instanced = false;  // 是否为实例化绘制命令
+            size_t InstanceStart = 0;  // 实例起始下标
+            size_t InstanceCount = 0;  // 实例个数
         };
 
         using DrawCommandContainer = std::vector<DrawCommand>;
@@ -103,6 +122,7 @@ namespace lstg::Subsystem::Render::Drawing2D
             CommandGroupContainer& CommandGroup;
             std::vector<Vertex>& VertexBuffer;
             std::vector<uint16_t>& IndexBuffer;
+            std::vector<SpriteInstance>& InstanceBuffer;
             std::vector<FreeListPtr<CameraPtr>>& CameraList;
             std::vector<TexturePtr>& TextureList;
             std::vector<MaterialPtr>& MaterialList;
@@ -217,6 +237,22 @@ namespace lstg::Subsystem::Render::Drawing2D
          */
         Result<Span<Vertex>> DrawQuadInPlace(TexturePtr tex2d) noexcept;
 
+        /**
+         * 是否可以使用实例化方式绘制精灵
+         * 自定义材质的顶点布局与实例数据不兼容，因此仅在使用默认材质时可用。
+         */
+        [[nodiscard]] bool IsSpriteInstancingAvailable() const noexcept { return !m_pCurrentMaterial; }
+
+        /**
+         * 以实例化方式绘制精灵
+         * 连续的、状态相同的实例会被合并到同一个绘制命令中。
+         * @pre IsSpriteInstancingAvailable()
+         * @param tex2d 关联的纹理
+         * @param instance 实例数据
+         * @return 是否成功
+         */
+        Result<void> DrawSpriteInstance(TexturePtr tex2d, const SpriteInstance& instance) noexcept;
+
         /**
          * 清空颜色和 ZBuffer
          * @param color 颜色
@@ -234,6 +270,7 @@ namespace lstg::Subsystem::Render::Drawing2D
         Result<void> InstantialGroup() noexcept;
         Result<void> InstantialQueue() noexcept;
         Result<void> InstantialCommand() noexcept;
+        Result<void> InstantialDrawCommand(TexturePtr tex2d, bool instanced) noexcept;
 
     private:
         struct CameraStateKey
@@ -284,6 +321,7 @@ namespace lstg::Subsystem::Render::Drawing2D
         size_t m_uCurrentBaseVertexIndex = 0;
         std::vector<Vertex> m_stVertices;
         std::vector<uint16_t> m_stIndexes;
+        std::vector<SpriteInstance> m_stInstances;
 
         // 正在生成的命令组
         CommandGroupContainer m_stCommandGroups;
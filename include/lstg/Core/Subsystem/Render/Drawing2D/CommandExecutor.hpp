@@ -52,6 +52,8 @@ namespace lstg::Subsystem::Render::Drawing2D
         Render::TexturePtr m_pDefaultTexture;
         Render::MaterialPtr m_pDefaultMaterial;
         Render::MeshPtr m_pMesh;
+        Render::MaterialPtr m_pInstancedMaterial;
+        Render::MeshPtr m_pInstancedMesh;
 
         // 临时变量
         std::string m_stOldBlendTag;
@@ -11,6 +11,17 @@
 
 namespace lstg::Subsystem::Render::Drawing2D
 {
+    /**
+     * 预变换的精灵绘制数据
+     * @see Sprite::PrepareTransformed
+     */
+    struct PreparedSpriteDrawing
+    {
+        bool Instanced = false;
+        SpriteInstance Instance;
+        std::array<Vertex, 4> Vertices;
+    };
+
     /**
      * 精灵
      */
@@ -110,6 +121,43 @@ namespace lstg::Subsystem::Render::Drawing2D
          */
         Result<SpriteDrawing> Draw(CommandBuffer& buffer, std::optional<ColorBlendMode> blendModeOverride = {}) const noexcept;
 
+        /**
+         * 变换并绘制
+         * 等价于 Draw(...)->Transform(rot, scale).Translate(position)。
+         * 当精灵四角颜色一致且命令缓冲使用默认材质时，使用实例化方式绘制，否则退化到逐顶点绘制。
+         * @param buffer 绘制缓冲区
+         * @param position 平移
+         * @param rot 旋转，弧度
+         * @param scale 缩放
+         * @param blendModeOverride 混合模式覆盖
+         * @return 是否成功
+         */
+        Result<void> DrawTransformed(CommandBuffer& buffer, glm::vec3 position, float rot, glm::vec2 scale,
+            std::optional<ColorBlendMode> blendModeOverride = {}) const noexcept;
+
+        /**
+         * 预先变换
+         * 只计算绘制数据，不访问命令缓冲区，因此可以在工作线程上执行。
+         * 与 DrawPrepared 组合使用时，结果与 DrawTransformed 一致。
+         * @param out 输出
+         * @param position 平移
+         * @param rot 旋转，弧度
+         * @param scale 缩放
+         * @param instancingAvailable 命令缓冲区是否可以使用实例化绘制
+         */
+        void PrepareTransformed(PreparedSpriteDrawing& out, glm::vec3 position, float rot, glm::vec2 scale,
+            bool instancingAvailable) const noexcept;
+
+        /**
+         * 提交预先变换的绘制数据
+         * @param buffer 绘制缓冲区
+         * @param prepared 预先变换的数据
+         * @param blendModeOverride 混合模式覆盖
+         * @return 是否成功
+         */
+        Result<void> DrawPrepared(CommandBuffer& buffer, const PreparedSpriteDrawing& prepared,
+            std::optional<ColorBlendMode> blendModeOverride = {}) const noexcept;
+
     private:
         void PrecomputedVertex(int what) noexcept;
 
@@ -121,5 +169,7 @@ namespace lstg::Subsystem::Render::Drawing2D
         SpriteColorComponents m_stAdditiveBlendColor = { 0x000000FFu, 0x000000FFu, 0x000000FFu, 0x000000FFu };
         SpriteColorComponents m_stMultiplyBlendColor = { 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu };
         std::array<Vertex, 4> m_stPrecomputedVertex;
+        SpriteInstance m_stPrecomputedInstance;
+        bool m_bInstancingCompatible = true;  // 四角颜色一致时才能使用实例化绘制
     };
 }
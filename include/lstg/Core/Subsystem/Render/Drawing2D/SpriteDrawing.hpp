@@ -54,6 +54,16 @@ namespace lstg::Subsystem::Render::Drawing2D
             return SpriteDrawing( dest);
         }
 
+        /**
+         * 在外部顶点上构造绘制工具
+         * 不向命令缓冲区提交任何数据，可用于在工作线程上预先变换顶点。
+         * @param dest 顶点，必须为 4 个
+         */
+        static SpriteDrawing Attach(Span<Vertex> dest) noexcept
+        {
+            return SpriteDrawing(dest);
+        }
+
     protected:
         explicit SpriteDrawing(Span<Vertex> dest)
             : m_stVertexList(dest)
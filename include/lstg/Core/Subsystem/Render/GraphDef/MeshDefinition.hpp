@@ -120,6 +120,29 @@ namespace lstg::Subsystem::Render::GraphDef
          */
         Result<void> AddVertexElement(VertexElementType type, VertexElementSemantic semantic, size_t offset) noexcept;
 
+        /**
+         * 获取单个实例数据的大小
+         * 为 0 时表示网格不包含逐实例数据。
+         */
+        [[nodiscard]] size_t GetInstanceStride() const noexcept { return m_iInstanceStride; }
+
+        /**
+         * 设置单个实例数据的大小
+         * @param stride 大小
+         */
+        void SetInstanceStride(size_t stride) noexcept { m_iInstanceStride = stride; }
+
+        /**
+         * 增加逐实例元素定义
+         * 逐实例元素存放于独立的实例缓冲区中，每个实例步进一次。
+         * @pre !ContainsSemantic(semantic)
+         * @param type 类型
+         * @param semantic 语义
+         * @param offset 相对于当前实例的偏移
+         * @return 是否成功
+         */
+        Result<void> AddInstanceElement(VertexElementType type, VertexElementSemantic semantic, size_t offset) noexcept;
+
         /**
          * 是否包含语义
          * @param semantic 语义
@@ -131,6 +154,11 @@ namespace lstg::Subsystem::Render::GraphDef
          */
         [[nodiscard]] const auto& GetVertexElements() const noexcept { return m_stVertexElements; }
 
+        /**
+         * 获取逐实例元素列表
+         */
+        [[nodiscard]] const auto& GetInstanceElements() const noexcept { return m_stInstanceElements; }
+
         /**
          * 获取哈希值
          */
@@ -140,6 +168,8 @@ namespace lstg::Subsystem::Render::GraphDef
         PrimitiveTopologyTypes m_iTopologyType = PrimitiveTopologyTypes::TriangleList;
         size_t m_iVertexStride = 0;
         std::vector<VertexElement> m_stVertexElements;
+        size_t m_iInstanceStride = 0;
+        std::vector<VertexElement> m_stInstanceElements;
     };
 
     using MeshDefinitionPtr = std::shared_ptr<MeshDefinition>;
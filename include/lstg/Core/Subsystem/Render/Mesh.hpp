@@ -75,6 +75,15 @@ namespace lstg::Subsystem::Render
          */
         Result<void> Commit(Span<const uint8_t> vertexData, Span<const uint8_t> indexData) noexcept;
 
+        /**
+         * 提交逐实例数据
+         * 实例缓冲区总是动态的，与 Mesh 的用途无关，每次提交都会覆盖之前的数据。
+         * @pre GetDefinition()->GetInstanceStride() > 0
+         * @param instanceData 实例数据
+         * @return 结果
+         */
+        Result<void> CommitInstances(Span<const uint8_t> instanceData) noexcept;
+
     private:
         RenderDevice& m_stDevice;
         GraphDef::ImmutableMeshDefinitionPtr m_pDefinition;
@@ -82,6 +91,7 @@ namespace lstg::Subsystem::Render
         Usage m_iUsage = Usage::Static;
         Diligent::IBuffer* m_pVertexBuffer = nullptr;
         Diligent::IBuffer* m_pIndexBuffer = nullptr;
+        Diligent::IBuffer* m_pInstanceBuffer = nullptr;
     };
 
     using MeshPtr = std::shared_ptr<Mesh>;
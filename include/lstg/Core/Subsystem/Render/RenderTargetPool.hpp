@@ -0,0 +1,121 @@
+/**
+ * @file
+ * @date 2022/8/20
+ * @author 9chu
+ * 此文件为 LuaSTGPlus 项目的一部分，版权与许可声明详见 COPYRIGHT.txt。
+ */
+#pragma once
+#include <cstdint>
+#include <vector>
+#include "Texture.hpp"
+
+namespace lstg::Subsystem::Render
+{
+    /**
+     * 渲染目标池
+     * 按照大小和格式缓存 RT 与深度模板缓冲区。
+     * 当池外不再持有纹理时，纹理可被再次分配；连续若干帧未被使用的纹理将被释放。
+     */
+    class RenderTargetPool
+    {
+    public:
+        /**
+         * 池键
+         */
+        struct Key
+        {
+            uint32_t Width = 0;
+            uint32_t Height = 0;
+            uint32_t Format = 0;  // 后端格式
+            bool DepthStencil = false;
+
+            [[nodiscard]] bool operator==(const Key& rhs) const noexcept
+            {
+                return Width == rhs.Width && Height == rhs.Height && Format == rhs.Format && DepthStencil == rhs.DepthStencil;
+            }
+        };
+
+        /**
+         * 统计信息
+         */
+        struct Statistics
+        {
+            size_t PooledCount = 0;  // 池中纹理个数
+            size_t PooledBytes = 0;  // 池中纹理总大小（估算）
+            size_t InUseBytes = 0;  // 正在使用的纹理大小
+            size_t PeakBytes = 0;  // 历史峰值
+            size_t CreatedInFrame = 0;  // 本帧新创建的个数
+            size_t ReusedInFrame = 0;  // 本帧复用的个数
+            size_t ReleasedInFrame = 0;  // 本帧释放的个数
+        };
+
+    public:
+        /**
+         * 构造
+         * @param maxIdleFrames 最大空闲帧数
+         */
+        explicit RenderTargetPool(uint32_t maxIdleFrames);
+
+    public:
+        /**
+         * 获取最大空闲帧数
+         */
+        [[nodiscard]] uint32_t GetMaxIdleFrames() const noexcept { return m_uMaxIdleFrames; }
+
+        /**
+         * 设置最大空闲帧数
+         * 空闲超过该帧数的纹理会在 NewFrame 时被释放。
+         * @param frames 帧数
+         */
+        void SetMaxIdleFrames(uint32_t frames) noexcept { m_uMaxIdleFrames = frames; }
+
+        /**
+         * 获取统计信息
+         */
+        [[nodiscard]] const Statistics& GetStatistics() const noexcept { return m_stStatistics; }
+
+        /**
+         * 尝试获取一个空闲纹理
+         * @param key 键
+         * @return 纹理，若没有空闲纹理则返回 nullptr
+         */
+        TexturePtr TryAcquire(const Key& key) noexcept;
+
+        /**
+         * 将新创建的纹理加入池
+         * @param key 键
+         * @param texture 纹理
+         * @param bytes 纹理大小
+         */
+        Result<void> Add(const Key& key, TexturePtr texture, size_t bytes) noexcept;
+
+        /**
+         * 推进一帧
+         * 刷新使用状态、释放过期纹理并计算统计信息。
+         */
+        void NewFrame() noexcept;
+
+        /**
+         * 释放所有空闲纹理
+         */
+        void Purge() noexcept;
+
+    private:
+        struct Entry
+        {
+            Key PoolKey;
+            TexturePtr Texture;
+            size_t Bytes = 0;
+            uint64_t LastUsedFrame = 0;
+
+            [[nodiscard]] bool IsFree() const noexcept { return Texture.use_count() == 1; }
+        };
+
+        uint32_t m_uMaxIdleFrames = 0;
+        uint64_t m_ullFrame = 0;
+        std::vector<Entry> m_stEntries;
+        size_t m_uCreatedCounter = 0;
+        size_t m_uReusedCounter = 0;
+        Statistics m_stStatistics;
+    };
+}
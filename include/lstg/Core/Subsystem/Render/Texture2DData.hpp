@@ -25,6 +25,7 @@ namespace lstg::Subsystem::Render
     /**
      * 2D 纹理格式
      * 默认都是 UNORM 形式
+     * BC 系列为块压缩格式，只能从预烘焙的容器（DDS/KTX2）中加载。
      */
     enum class Texture2DFormats
     {
@@ -35,6 +36,14 @@ namespace lstg::Subsystem::Render
         R16,
         R16G16,
         R16G16B16A16,
+        BC1,
+        BC1_SRGB,
+        BC2,
+        BC2_SRGB,
+        BC3,
+        BC3_SRGB,
+        BC7,
+        BC7_SRGB,
     };
 
     /**
@@ -47,14 +56,14 @@ namespace lstg::Subsystem::Render
     public:
         /**
          * 从文件加载纹理
-         * 支持 stb_image 所兼容格式
+         * 支持 stb_image 所兼容格式，以及包含预计算 Mipmap 的 DDS/KTX2 容器
          * @param stream 数据流
          */
         Texture2DData(VFS::StreamPtr stream);
 
         /**
          * 从缓冲区加载纹理
-         * 支持 stb_image 所兼容格式
+         * 支持 stb_image 所兼容格式，以及包含预计算 Mipmap 的 DDS/KTX2 容器
          * @param buffer 缓冲区
          */
         Texture2DData(Span<const uint8_t> buffer);
@@ -92,14 +101,26 @@ namespace lstg::Subsystem::Render
          */
         Texture2DFormats GetFormat() const noexcept;
 
+        /**
+         * 是否为块压缩格式
+         */
+        bool IsCompressed() const noexcept;
+
+        /**
+         * 获取 Mipmap 层数
+         */
+        size_t GetMipLevels() const noexcept;
+
         /**
          * 获取数据块
+         * 块压缩格式下，每行对应一行像素块。
          */
         Span<const uint8_t> GetBuffer() const noexcept;
         Span<uint8_t> GetBuffer() noexcept;
 
         /**
          * 生成 Mipmap
+         * 块压缩格式不支持生成 Mipmap，但允许通过 count = 1 丢弃已有的 Mipmap。
          * @param count 数量，设置为 0 表示自动
          * @return 是否成功
          */
@@ -0,0 +1,74 @@
+/**
+ * @file
+ * @date 2022/8/21
+ * @author 9chu
+ * 此文件为 LuaSTGPlus 项目的一部分，版权与许可声明详见 COPYRIGHT.txt。
+ */
+#pragma once
+#include <optional>
+#include "Texture.hpp"
+#include "Texture2DData.hpp"
+
+namespace lstg::Subsystem::Render
+{
+    /**
+     * 纹理上传状态
+     */
+    enum class TextureUploadStates
+    {
+        Uploading,
+        Finished,
+    };
+
+    /**
+     * 纹理上传请求
+     * 由 RenderSystem::CreateTexture2DAsync 创建，数据在 RenderSystem::UpdateTextureUploads 中分片上传。
+     * 当请求不再被外部持有时，视为取消。
+     */
+    class TextureUploadRequest
+    {
+        friend class lstg::Subsystem::RenderSystem;
+
+    public:
+        TextureUploadRequest(TexturePtr texture, Texture2DData data, size_t totalBytes) noexcept
+            : m_pTexture(std::move(texture)), m_stData(std::move(data)), m_uTotalBytes(totalBytes) {}
+
+    public:
+        /**
+         * 获取状态
+         */
+        [[nodiscard]] TextureUploadStates GetState() const noexcept { return m_iState; }
+
+        /**
+         * 是否上传完毕
+         */
+        [[nodiscard]] bool IsFinished() const noexcept { return m_iState == TextureUploadStates::Finished; }
+
+        /**
+         * 获取纹理
+         * @note 上传完成前纹理内容未定义，不应用于绘制
+         */
+        [[nodiscard]] const TexturePtr& GetTexture() const noexcept { return m_pTexture; }
+
+        /**
+         * 获取总字节数
+         */
+        [[nodiscard]] size_t GetTotalBytes() const noexcept { return m_uTotalBytes; }
+
+        /**
+         * 获取已上传字节数
+         */
+        [[nodiscard]] size_t GetUploadedBytes() const noexcept { return m_uUploadedBytes; }
+
+    private:
+        TextureUploadStates m_iState = TextureUploadStates::Uploading;
+        TexturePtr m_pTexture;
+        std::optional<Texture2DData> m_stData;  // 上传完成后释放
+        size_t m_uTotalBytes = 0;
+        size_t m_uUploadedBytes = 0;
+        size_t m_uCurrentMipLevel = 0;
+        uint32_t m_uCurrentRow = 0;  // 块压缩格式下为块行
+    };
+
+    using TextureUploadRequestPtr = std::shared_ptr<TextureUploadRequest>;
+}
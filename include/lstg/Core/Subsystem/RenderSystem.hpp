@@ -5,6 +5,7 @@
  * 此文件为 LuaSTGPlus 项目的一部分，版权与许可声明详见 COPYRIGHT.txt。
  */
 #pragma once
+#include <deque>
 #include <functional>
 #include "../Span.hpp"
 #include "ISubsystem.hpp"
@@ -19,6 +20,8 @@
 #include "Render/GraphicsDefinitionCache.hpp"
 #include "Render/Texture.hpp"
 #include "Render/Texture2DData.hpp"
+#include "Render/RenderTargetPool.hpp"
+#include "Render/TextureUploadRequest.hpp"
 #include "Render/ColorRGBA32.hpp"
 
 #ifdef LSTG_PLATFORM_ANDROID
@@ -122,6 +125,40 @@ namespace lstg::Subsystem
          */
         [[nodiscard]] Result<Render::TexturePtr> CreateTexture2D(const Render::Texture2DData& data) noexcept;
 
+        /**
+         * 检查设备是否支持纹理格式
+         * 结果在初始化时计算，可以在加载线程上调用。
+         * @param format 格式
+         * @return 是否支持
+         */
+        [[nodiscard]] bool IsTextureFormatSupported(Render::Texture2DFormats format) const noexcept;
+
+        /**
+         * 异步创建 2D 纹理
+         * 纹理对象立即创建，数据在后续的 UpdateTextureUploads 中按照每帧预算分片上传，避免大纹理阻塞主线程。
+         * @param data 纹理数据，上传完毕后释放
+         * @return 上传请求
+         */
+        [[nodiscard]] Result<Render::TextureUploadRequestPtr> CreateTexture2DAsync(Render::Texture2DData data) noexcept;
+
+        /**
+         * 获取每次 UpdateTextureUploads 的上传预算（字节）
+         */
+        [[nodiscard]] size_t GetTextureUploadBudget() const noexcept { return m_uTextureUploadBudget; }
+
+        /**
+         * 设置每次 UpdateTextureUploads 的上传预算（字节）
+         * @param bytes 字节数
+         */
+        void SetTextureUploadBudget(size_t bytes) noexcept { m_uTextureUploadBudget = bytes; }
+
+        /**
+         * 在预算内执行排队的纹理上传
+         * 不再被外部持有的请求会被直接丢弃。
+         * @note 总是在主线程调用
+         */
+        void UpdateTextureUploads() noexcept;
+
         /**
          * 创建动态 2D 纹理
          * @note 动态 2D 纹理没有 Mipmaps，且仅允许 CPU 侧写操作。
@@ -149,6 +186,28 @@ namespace lstg::Subsystem
          */
         [[nodiscard]] Result<Render::TexturePtr> CreateDepthStencil(uint32_t width, uint32_t height) noexcept;
 
+        /**
+         * 从池中分配 RenderTarget
+         * 优先复用池中大小、格式一致且不再被持有的 RT，否则创建新的 RT 并放入池中。
+         * @param width 宽度
+         * @param height 高度
+         * @return 纹理对象
+         */
+        [[nodiscard]] Result<Render::TexturePtr> AcquireRenderTarget(uint32_t width, uint32_t height) noexcept;
+
+        /**
+         * 从池中分配深度模板缓冲区
+         * @param width 宽度
+         * @param height 高度
+         * @return 纹理对象
+         */
+        [[nodiscard]] Result<Render::TexturePtr> AcquireDepthStencil(uint32_t width, uint32_t height) noexcept;
+
+        /**
+         * 获取 RT 池
+         */
+        [[nodiscard]] Render::RenderTargetPool& GetRenderTargetPool() noexcept { return m_stRenderTargetPool; }
+
         /**
          * 获取默认的占位 2D 纹理
          */
@@ -256,6 +315,16 @@ namespace lstg::Subsystem
          */
         Result<void> Draw(Render::Mesh* mesh, size_t indexCount, size_t indexOffset, size_t vertexOffset = 0) noexcept;
 
+        /**
+         * 实例化绘制网格
+         * 网格的逐实例数据需要事先通过 Mesh::CommitInstances 提交。
+         * @param mesh 网格对象
+         * @param indexCount 每个实例使用的索引个数
+         * @param instanceCount 实例个数
+         * @param instanceOffset 实例偏移（个数），offset = instanceOffset * instanceStride
+         */
+        Result<void> DrawInstanced(Render::Mesh* mesh, size_t indexCount, size_t instanceCount, size_t instanceOffset = 0) noexcept;
+
     private:
 #ifdef LSTG_ROTATABLE_SCREEN
         void SyncSwapChainSize() noexcept;
@@ -266,6 +335,8 @@ namespace lstg::Subsystem
         Result<void> CommitCamera() noexcept;
         Result<void> CommitMaterial() noexcept;
         Result<void> PreparePipeline(const Render::GraphDef::EffectPassDefinition* pass, const Render::GraphDef::MeshDefinition* meshDef);
+        Result<void> DrawImpl(Render::Mesh* mesh, size_t indexCount, size_t vertexOffset, size_t indexOffset, size_t instanceCount,
+            size_t instanceOffset) noexcept;
 
         // </editor-fold>
     protected:  // ISubsystem
@@ -287,6 +358,16 @@ namespace lstg::Subsystem
         // 内建默认纹理
         Render::TexturePtr m_pDefaultTexture2D;
 
+        // RT 池
+        Render::RenderTargetPool m_stRenderTargetPool;
+
+        // 设备支持的纹理格式，按 Texture2DFormats 取位
+        uint32_t m_uSupportedTextureFormats = 0;
+
+        // 纹理上传队列
+        size_t m_uTextureUploadBudget = 0;
+        std::deque<Render::TextureUploadRequestPtr> m_stTextureUploadQueue;
+
         // 内建工具
         std::shared_ptr<Render::detail::ClearHelper> m_pClearHelper;
 #ifdef LSTG_PLATFORM_EMSCRIPTEN
@@ -0,0 +1,101 @@
+/**
+ * @file
+ * @date 2022/9/12
+ * @author 9chu
+ * 此文件为 LuaSTGPlus 项目的一部分，版权与许可声明详见 COPYRIGHT.txt。
+ */
+#pragma once
+#include <ctime>
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include "LuaStack.hpp"
+
+namespace lstg::Subsystem
+{
+    class VirtualFileSystem;
+}
+
+namespace lstg::Subsystem::Script
+{
+    /**
+     * 字节码缓存
+     * 将编译后的字节码（等价于 string.dump 的输出）按照 路径 + 块名称 存放在缓存目录中，并以修改时间和内容哈希校验。
+     * 命中时跳过词法和语法分析直接加载字节码；未命中时编译源码并异步写回缓存。
+     * 输入本身即为字节码（例如经过预编译的资源包）时直接加载，不经过缓存。
+     */
+    class BytecodeCache
+    {
+    public:
+        /**
+         * 缓存文件格式版本
+         */
+        static constexpr uint32_t kVersion = 1;
+
+        /**
+         * 缓存文件扩展名
+         */
+        static constexpr const char* kExtension = ".ljbc";
+
+        /**
+         * 判断数据是否为字节码
+         * @param source 数据
+         */
+        static bool IsBytecode(Span<const uint8_t> source) noexcept;
+
+    public:
+        BytecodeCache(VirtualFileSystem& fs) noexcept;
+        BytecodeCache(const BytecodeCache&) = delete;
+        BytecodeCache(BytecodeCache&&) = delete;
+
+    public:
+        /**
+         * 获取缓存目录
+         */
+        [[nodiscard]] const std::string& GetCacheDirectory() const noexcept { return m_stCacheDirectory; }
+
+        /**
+         * 设置缓存目录
+         * 目录不存在时创建。为空时禁用缓存。
+         * @param dir 目录
+         */
+        Result<void> SetCacheDirectory(std::string dir) noexcept;
+
+        /**
+         * 获取命中次数
+         */
+        [[nodiscard]] size_t GetHitCount() const noexcept { return m_uHitCount; }
+
+        /**
+         * 获取未命中次数
+         */
+        [[nodiscard]] size_t GetMissCount() const noexcept { return m_uMissCount; }
+
+        /**
+         * 加载代码块
+         * 行为与 luaL_loadbuffer 一致：成功时压入函数，失败时压入错误信息。
+         * @param L 虚拟机
+         * @param source 源码或字节码
+         * @param path 文件路径，作为缓存键
+         * @param lastModified 文件修改时间
+         * @param chunkName 块名称
+         * @return Lua 错误码
+         */
+        int Load(lua_State* L, Span<const uint8_t> source, std::string_view path, std::time_t lastModified,
+            const char* chunkName) noexcept;
+
+    private:
+        std::string MakeCachePath(std::string_view key) const;
+        bool TryLoadCache(lua_State* L, const std::string& cachePath, std::string_view key, std::time_t lastModified,
+            Span<const uint8_t> source, uint32_t contentHash, const char* chunkName) noexcept;
+        void WriteCache(lua_State* L, std::string cachePath, std::string_view key, std::time_t lastModified,
+            Span<const uint8_t> source, uint32_t contentHash) noexcept;
+
+    private:
+        VirtualFileSystem& m_stFileSystem;
+        std::string m_stCacheDirectory;
+        std::shared_ptr<std::unordered_set<std::string>> m_pPendingWrites;  // 正在写入的缓存文件，回调可能晚于对象析构
+        size_t m_uHitCount = 0;
+        size_t m_uMissCount = 0;
+    };
+}
@@ -0,0 +1,97 @@
+/**
+ * @file
+ * @date 2022/10/3
+ * @author 9chu
+ * 此文件为 LuaSTGPlus 项目的一部分，版权与许可声明详见 COPYRIGHT.txt。
+ */
+#pragma once
+#include <memory>
+#include <vector>
+#include <unordered_map>
+#include "../../IntrusiveHeap.hpp"
+#include "LuaStack.hpp"
+
+namespace lstg::Subsystem::Script
+{
+    /**
+     * 协程调度器
+     *
+     * 按帧挂起协程，由 Update 在每帧推进计数并唤醒到期的协程。
+     * 等待中的协程只占用最小堆中的一个节点，到期前不产生任何开销；同一帧到期的协程按照登记顺序唤醒。
+     */
+    class CoroutineScheduler
+    {
+        struct WaitNode :
+            public IntrusiveHeapNode
+        {
+            lua_State* Thread = nullptr;
+            int Ref = LUA_NOREF;  // 持有协程，防止被回收
+            uint64_t WakeFrame = 0;
+            uint64_t Sequence = 0;
+        };
+
+        struct WaitNodeComparer
+        {
+            bool operator()(const WaitNode* a, const WaitNode* b) const noexcept;
+        };
+
+    public:
+        CoroutineScheduler(LuaStack mainThread) noexcept;
+        CoroutineScheduler(const CoroutineScheduler&) = delete;
+        CoroutineScheduler(CoroutineScheduler&&) = delete;
+        ~CoroutineScheduler();
+
+    public:
+        /**
+         * 获取当前帧数
+         */
+        [[nodiscard]] uint64_t GetCurrentFrame() const noexcept { return m_ullCurrentFrame; }
+
+        /**
+         * 获取等待中的协程数量
+         */
+        [[nodiscard]] size_t GetWaitingCount() const noexcept { return m_stWaiting.size(); }
+
+        /**
+         * 登记协程
+         * 协程已经在等待时更新唤醒时间。登记后协程应当自行 yield，由调度器在到期后以无参数的形式 resume。
+         * @param stack 当前栈
+         * @param idx 协程所在的索引
+         * @param frames 等待帧数，至少为 1
+         */
+        Result<void> Schedule(LuaStack& stack, int idx, uint32_t frames) noexcept;
+
+        /**
+         * 取消等待
+         * @param stack 当前栈
+         * @param idx 协程所在的索引
+         * @return 协程是否在等待
+         */
+        bool Cancel(LuaStack& stack, int idx) noexcept;
+
+        /**
+         * 推进一帧并唤醒到期的协程
+         * 协程中的错误会被记录到日志，不会中断其他协程的执行。
+         * @return 唤醒的协程数量
+         */
+        size_t Update() noexcept;
+
+        /**
+         * 取消所有等待
+         */
+        void Clear() noexcept;
+
+    private:
+        WaitNode* AllocNode();
+        void FreeNode(WaitNode* node) noexcept;
+
+    private:
+        LuaStack m_stMainThread;
+        uint64_t m_ullCurrentFrame = 0;
+        uint64_t m_ullSequence = 0;
+        IntrusiveHeap<WaitNode, WaitNodeComparer> m_stHeap;
+        std::unordered_map<lua_State*, WaitNode*> m_stWaiting;
+        std::vector<std::unique_ptr<WaitNode>> m_stNodes;
+        std::vector<WaitNode*> m_stFreeNodes;
+    };
+}
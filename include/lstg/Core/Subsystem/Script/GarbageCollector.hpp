@@ -0,0 +1,80 @@
+/**
+ * @file
+ * @date 2022/10/4
+ * @author 9chu
+ * 此文件为 LuaSTGPlus 项目的一部分，版权与许可声明详见 COPYRIGHT.txt。
+ */
+#pragma once
+#include "LuaStack.hpp"
+
+namespace lstg::Subsystem::Script
+{
+    /**
+     * GC 调度器
+     *
+     * 分配触发的增量回收保持开启，作为内存增长的兜底；每帧再利用空闲时间按预算主动推进回收，
+     * 使得大部分回收工作发生在帧间，而不是落在繁忙帧的分配点上。
+     */
+    class GarbageCollector
+    {
+    public:
+        GarbageCollector(LuaStack mainThread) noexcept;
+        GarbageCollector(const GarbageCollector&) = delete;
+        GarbageCollector(GarbageCollector&&) = delete;
+
+    public:
+        /**
+         * 暂停 GC
+         * 暂停期间既不进行分配触发的自动回收，也不进行每帧的增量回收，用于保护对卡顿敏感的代码段。
+         * 可以嵌套调用，需要与 Resume 配对。
+         */
+        void Suspend() noexcept;
+
+        /**
+         * 恢复 GC
+         */
+        void Resume() noexcept;
+
+        /**
+         * GC 是否被暂停
+         */
+        [[nodiscard]] bool IsSuspended() const noexcept { return m_uSuspendCount > 0; }
+
+        /**
+         * 设置调度参数
+         * 每帧从上一帧的空闲时间中取出 ratio 比例用于增量回收，并限制在 [minTime, maxTime] 之间。
+         * minTime 保证在没有空闲时间时回收依然能够推进。
+         * @param ratio 空闲时间占比
+         * @param minTime 每帧最短回收时间（秒）
+         * @param maxTime 每帧最长回收时间（秒）
+         */
+        void SetBudget(double ratio, double minTime, double maxTime) noexcept;
+
+        /**
+         * 获取上一帧的预算（秒）
+         */
+        [[nodiscard]] double GetLastBudget() const noexcept { return m_dLastBudget; }
+
+        /**
+         * 获取上一帧的回收耗时（秒）
+         */
+        [[nodiscard]] double GetLastTime() const noexcept { return m_dLastTime; }
+
+        /**
+         * 按预算推进回收
+         * @param idleTime 上一帧的空闲时间（秒）
+         * @return 回收耗时（秒）
+         */
+        double Update(double idleTime) noexcept;
+
+    private:
+        LuaStack m_stMainThread;
+        uint32_t m_uSuspendCount = 0;
+        double m_dBudgetRatio = 0.5;
+        double m_dMinTime = 0.0002;
+        double m_dMaxTime = 0.004;
+        double m_dLastBudget = 0.;
+        double m_dLastTime = 0.;
+        int m_iBaselineKb = 0;  // 上一个由 Update 完成的回收周期结束时的堆大小
+    };
+}
@@ -8,6 +8,7 @@
 #include <memory>
 #include <variant>
 #include <optional>
+#include <type_traits>
 #include "LuaStack.hpp"
 
 namespace lstg::Subsystem::Script
@@ -622,6 +623,144 @@ namespace lstg::Subsystem::Script
         return LuaPush(stack, detail::FunctionCallHelper<StackIndices, TRet, TArgs...>::Wrapper, reinterpret_cast<void*>(v));
     }
 
+    /**
+     * 编译期绑定的自由函数
+     * 与直接推入函数指针相比，函数地址作为模板参数，调用时无需从上值取出函数指针，被调函数可以内联进包装函数。
+     * 常见的 std::optional / std::variant 参数会直接解码，其他参数及解码失败的情况回退到通用的 LuaRead，行为保持一致。
+     * 若 Func 本身即为 lua_CFunction，则直接推入，不做包装。
+     * @tparam Func 函数指针
+     */
+    template <auto Func>
+    struct StaticFunction {};
+
+    namespace detail
+    {
+        /**
+         * 参数快速解码
+         * 默认使用通用读取方法。
+         */
+        template <typename T>
+        struct FastArgumentReader
+        {
+            static T Read(LuaStack& st, int idx)
+            {
+                return st.ReadValue<T>(idx);
+            }
+        };
+
+        template <>
+        struct FastArgumentReader<std::optional<double>>
+        {
+            static std::optional<double> Read(LuaStack& st, int idx)
+            {
+                // 非零时必然是数字或者可以转换为数字的字符串，与通用路径结果一致，只需要一次 API 调用
+                auto d = lua_tonumber(st, idx);
+                if (d != 0)
+                    return d;
+                if (lua_isnoneornil(st, idx))
+                    return std::nullopt;
+                return luaL_checknumber(st, idx);  // 0 或者类型错误
+            }
+        };
+
+        template <>
+        struct FastArgumentReader<std::optional<bool>>
+        {
+            static std::optional<bool> Read(LuaStack& st, int idx)
+            {
+                if (lua_toboolean(st, idx))
+                    return true;
+                if (lua_isnoneornil(st, idx))
+                    return std::nullopt;
+                return false;
+            }
+        };
+
+        template <>
+        struct FastArgumentReader<std::variant<double, LuaStack::AbsIndex>>
+        {
+            static std::variant<double, LuaStack::AbsIndex> Read(LuaStack& st, int idx)
+            {
+                assert(idx > 0);
+                auto d = lua_tonumber(st, idx);
+                if (d != 0 || lua_isnumber(st, idx))
+                    return d;
+                return LuaStack::AbsIndex { static_cast<unsigned>(idx) };
+            }
+        };
+
+        template <auto Func, typename StackIndices, typename TRet, typename... TArgs>
+        struct StaticFunctionCallHelperImpl;
+
+        template <auto Func, int... Indices, typename TRet, typename... TArgs>
+        struct StaticFunctionCallHelperImpl<Func, StackIndexSequence<Indices...>, TRet, TArgs...>
+        {
+            static_assert(sizeof...(Indices) == sizeof...(TArgs));
+
+            static int Wrapper(lua_State* L)
+            {
+                LuaStack st(L);
+                if constexpr (std::is_void_v<TRet>)
+                {
+                    try
+                    {
+                        Func(FastArgumentReader<TArgs>::Read(st, Indices)...);
+                        return 0;
+                    }
+                    catch (const std::exception& ex)
+                    {
+                        st.Error("%s", ex.what());
+                    }
+                }
+                else
+                {
+                    try
+                    {
+                        return st.PushValue(Func(FastArgumentReader<TArgs>::Read(st, Indices)...));
+                    }
+                    catch (const std::exception& ex)
+                    {
+                        st.Error("%s", ex.what());
+                    }
+                }
+            }
+        };
+
+        template <auto Func, typename TFunc = decltype(Func)>
+        struct StaticFunctionCallHelper;
+
+        template <auto Func, typename TRet, typename... TArgs>
+        struct StaticFunctionCallHelper<Func, TRet(*)(TArgs...)> :
+            public StaticFunctionCallHelperImpl<Func, typename MakeStackIndexSequence<1, TArgs...>::Sequence, TRet, TArgs...>
+        {
+        };
+
+        template <auto Func, typename TRet, typename... TArgs>
+        struct StaticFunctionCallHelper<Func, TRet(*)(TArgs...) noexcept> :
+            public StaticFunctionCallHelperImpl<Func, typename MakeStackIndexSequence<1, TArgs...>::Sequence, TRet, TArgs...>
+        {
+        };
+    }
+
+    /**
+     * 推入一个编译期绑定的自由函数
+     * @tparam Func 函数指针
+     * @param stack Lua 栈
+     * @return 推入元素个数
+     *
+     * [-0, +1]
+     */
+    template <auto Func>
+    inline int LuaPush(LuaStack& stack, StaticFunction<Func>) noexcept
+    {
+        // 原生 C 函数自行读取参数并返回结果个数，不能经过参数解码
+        if constexpr (std::is_convertible_v<decltype(Func), lua_CFunction>)
+            lua_pushcfunction(stack, static_cast<lua_CFunction>(Func));
+        else
+            lua_pushcfunction(stack, detail::StaticFunctionCallHelper<Func>::Wrapper);
+        return 1;
+    }
+
     namespace detail
     {
         template <int Qualifier, typename TClass, typename TRet, typename... TArgs>
@@ -8,6 +8,7 @@
 #include <map>
 #include "LuaStack.hpp"
 #include "LuaReference.hpp"
+#include "BytecodeCache.hpp"
 #include "../VFS/Path.hpp"
 #include "../VirtualFileSystem.hpp"
 
@@ -36,6 +37,11 @@ namespace lstg::Subsystem::Script
         [[nodiscard]] LuaStack& GetMainThread() noexcept { return m_stMainThread; }
         [[nodiscard]] const LuaStack& GetMainThread() const noexcept { return m_stMainThread; }
 
+        /**
+         * 获取字节码缓存
+         */
+        [[nodiscard]] BytecodeCache& GetBytecodeCache() noexcept { return m_stBytecodeCache; }
+
         /**
          * 获取检查间隔
          */
@@ -97,6 +103,7 @@ namespace lstg::Subsystem::Script
     private:
         VirtualFileSystem& m_stFileSystem;
         LuaStack m_stMainThread;
+        BytecodeCache m_stBytecodeCache;
 
         double m_dCheckInterval = 0;
 
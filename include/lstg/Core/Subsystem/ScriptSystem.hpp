@@ -8,6 +8,8 @@
 #include "ISubsystem.hpp"
 #include "Script/LuaState.hpp"
 #include "Script/SandBox.hpp"
+#include "Script/CoroutineScheduler.hpp"
+#include "Script/GarbageCollector.hpp"
 #include "VFS/Path.hpp"
 
 namespace lstg::Subsystem
@@ -115,6 +117,51 @@ namespace lstg::Subsystem
             }
         }
 
+        /**
+         * 压入 FFI 模块
+         * FFI 模块不对脚本开放，仅在启用 LSTG_LUAJIT_FFI 时可供引擎内部使用。
+         * @return 是否成功，失败时不压入任何值
+         *
+         * [-0, +(0|1)]
+         */
+        bool PushFFIModule() noexcept;
+
+        /**
+         * 暂停 GC
+         * @see Script::GarbageCollector::Suspend
+         */
+        void SuspendGarbageCollection() noexcept { m_stGarbageCollector.Suspend(); }
+
+        /**
+         * 恢复 GC
+         */
+        void ResumeGarbageCollection() noexcept { m_stGarbageCollector.Resume(); }
+
+        /**
+         * GC 是否被暂停
+         */
+        [[nodiscard]] bool IsGarbageCollectionSuspended() const noexcept { return m_stGarbageCollector.IsSuspended(); }
+
+        /**
+         * 设置 GC 调度参数
+         * @see Script::GarbageCollector::SetBudget
+         */
+        void SetGarbageCollectionBudget(double ratio, double minTime, double maxTime) noexcept
+        {
+            m_stGarbageCollector.SetBudget(ratio, minTime, maxTime);
+        }
+
+        /**
+         * 获取上一帧的 GC 耗时（秒）
+         */
+        [[nodiscard]] double GetLastGarbageCollectionTime() const noexcept { return m_stGarbageCollector.GetLastTime(); }
+
+        /**
+         * 获取协程调度器
+         * 调度器在每个逻辑帧开始时推进一次，由游戏循环驱动。
+         */
+        [[nodiscard]] Script::CoroutineScheduler& GetCoroutineScheduler() noexcept { return m_stCoroutineScheduler; }
+
     protected:  // ISubsystem
         /**
          * 更新状态
@@ -124,10 +171,13 @@ namespace lstg::Subsystem
 
     private:
         void LogCallFail(const char* func, const char* what) noexcept;
+        void RunGarbageCollection() noexcept;
 
     private:
         Script::LuaState m_stState;
         Script::SandBox m_stSandBox;
+        Script::CoroutineScheduler m_stCoroutineScheduler;
+        Script::GarbageCollector m_stGarbageCollector;
         std::string m_stIoWorkingDirectory;
     };
 }
@@ -0,0 +1,122 @@
+/**
+ * @file
+ * @date 2022/9/5
+ * @author 9chu
+ * 此文件为 LuaSTGPlus 项目的一部分，版权与许可声明详见 COPYRIGHT.txt。
+ */
+#pragma once
+#include <deque>
+#include <memory>
+#include <functional>
+#include <unordered_map>
+#include "../../ThreadPool.hpp"
+#include "IFileSystem.hpp"
+
+namespace lstg::Subsystem::VFS
+{
+    namespace detail
+    {
+        class IoUring;
+    }
+
+    /**
+     * 异步读取完成回调
+     * 读取到的数据可能因到达文件结尾而短于请求的长度。
+     */
+    using AsyncReadCallback = std::function<void(std::error_code, std::vector<uint8_t>)>;
+
+    /**
+     * 异步写入完成回调
+     */
+    using AsyncWriteCallback = std::function<void(std::error_code)>;
+
+    /**
+     * 异步 I/O 服务
+     * 文件能够映射到本地路径（见 IFileSystem::GetNativePath）时，在 Linux 下经由 io_uring 提交，不占用任何线程；
+     * 其他情况（其他平台、ZIP 档案中的文件、内核不支持等）回退到专用的 I/O 线程池，通过文件系统同步读写。
+     * 请求只能在主线程发起，完成回调总是在主线程调用 Update 时执行。
+     */
+    class AsyncIOService
+    {
+    public:
+        /**
+         * 读取到文件结尾
+         */
+        static constexpr size_t kReadToEnd = static_cast<size_t>(-1);
+
+        /**
+         * io_uring 提交队列大小
+         */
+        static constexpr uint32_t kQueueDepth = 64;
+
+        /**
+         * 回退线程池的线程数
+         */
+        static constexpr uint32_t kFallbackThreadCount = 2;
+
+    public:
+        /**
+         * 构造异步 I/O 服务
+         * @param fileSystem 文件系统，需要保证生命周期长于服务对象
+         */
+        AsyncIOService(IFileSystem& fileSystem) noexcept;
+        AsyncIOService(const AsyncIOService&) = delete;
+        AsyncIOService(AsyncIOService&&) = delete;
+        ~AsyncIOService();
+
+    public:
+        /**
+         * 发起异步读取
+         * @param path 路径
+         * @param offset 文件偏移
+         * @param length 读取长度，为 kReadToEnd 时读取到文件结尾
+         * @param callback 完成回调
+         * @return 是否成功发起
+         */
+        Result<void> Read(Path path, uint64_t offset, size_t length, AsyncReadCallback callback) noexcept;
+
+        /**
+         * 发起异步写入
+         * 以截断方式打开文件并写入全部数据，文件不存在时创建。
+         * @param path 路径
+         * @param data 数据
+         * @param callback 完成回调
+         * @return 是否成功发起
+         */
+        Result<void> Write(Path path, std::vector<uint8_t> data, AsyncWriteCallback callback) noexcept;
+
+        /**
+         * 推进请求并执行完成回调
+         */
+        void Update() noexcept;
+
+        /**
+         * 获取尚未完成的请求数
+         */
+        [[nodiscard]] size_t GetPendingCount() const noexcept;
+
+    private:
+        struct NativeRequest;
+        using NativeRequestPtr = std::unique_ptr<NativeRequest>;
+
+        bool IsNativeAvailable() noexcept;
+        Result<void> CommitNative(NativeRequestPtr request) noexcept;
+        bool PrepareNativeStage(uint64_t id, NativeRequest& request) noexcept;
+        bool OnNativeCompleted(NativeRequest& request, int32_t result) noexcept;
+        ThreadPool<>* GetThreadPool() noexcept;
+
+    private:
+        IFileSystem& m_stFileSystem;
+
+        // io_uring
+        bool m_bRingInitialized = false;
+        std::unique_ptr<detail::IoUring> m_pRing;
+        uint64_t m_ullNextRequestId = 1;
+        std::unordered_map<uint64_t, NativeRequestPtr> m_stNativeRequests;
+        std::deque<uint64_t> m_stBacklog;  // 等待提交队列空位的请求
+
+        // 回退
+        std::unique_ptr<ThreadPool<>> m_pThreadPool;  // 首次使用时创建
+        size_t m_uFallbackPending = 0;
+    };
+}
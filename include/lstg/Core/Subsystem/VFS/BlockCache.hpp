@@ -0,0 +1,147 @@
+/**
+ * @file
+ * @date 2022/9/3
+ * @author 9chu
+ * 此文件为 LuaSTGPlus 项目的一部分，版权与许可声明详见 COPYRIGHT.txt。
+ */
+#pragma once
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <unordered_map>
+
+namespace lstg::Subsystem::VFS
+{
+    /**
+     * 数据块缓存
+     * 以 (档案, 条目, 块序号) 为键缓存解压后的数据块，按 LRU 策略淘汰，容量以字节计。
+     * 缓存可以在多个文件系统、多个线程之间共享。
+     */
+    class BlockCache
+    {
+    public:
+        /**
+         * 块大小
+         */
+        static constexpr size_t kBlockSize = 64 * 1024;
+
+        /**
+         * 默认容量
+         */
+        static constexpr size_t kDefaultCapacity = 16 * 1024 * 1024;
+
+        using BlockPtr = std::shared_ptr<const std::vector<uint8_t>>;
+
+        /**
+         * 块的键
+         */
+        struct Key
+        {
+            uint64_t Archive = 0;
+            uint64_t Entry = 0;
+            uint64_t Block = 0;
+
+            bool operator==(const Key& rhs) const noexcept
+            {
+                return Archive == rhs.Archive && Entry == rhs.Entry && Block == rhs.Block;
+            }
+        };
+
+        /**
+         * 统计数据
+         */
+        struct Statistics
+        {
+            uint64_t Hits = 0;
+            uint64_t Misses = 0;
+            size_t UsedBytes = 0;
+            size_t Capacity = 0;
+        };
+
+        /**
+         * 分配档案 ID
+         * 每个档案使用唯一的 ID，避免档案释放后地址或偏移被复用造成误命中。
+         */
+        static uint64_t AllocArchiveId() noexcept;
+
+    public:
+        BlockCache(size_t capacity = kDefaultCapacity) noexcept;
+        BlockCache(const BlockCache&) = delete;
+        BlockCache(BlockCache&&) = delete;
+
+    public:
+        /**
+         * 获取容量
+         */
+        [[nodiscard]] size_t GetCapacity() const noexcept;
+
+        /**
+         * 设置容量
+         * 超出部分立即淘汰。
+         * @param capacity 容量（字节）
+         */
+        void SetCapacity(size_t capacity) noexcept;
+
+        /**
+         * 查找数据块
+         * 命中时将块移动到队首，同时计入命中率。
+         * @param key 键
+         * @return 数据块，未命中时返回 nullptr
+         */
+        BlockPtr Get(const Key& key) noexcept;
+
+        /**
+         * 放入数据块
+         * 已存在相同的键时替换。
+         * @param key 键
+         * @param block 数据块
+         */
+        void Put(const Key& key, BlockPtr block) noexcept;
+
+        /**
+         * 清除档案的所有数据块
+         * @param archive 档案 ID
+         */
+        void Purge(uint64_t archive) noexcept;
+
+        /**
+         * 清空缓存
+         */
+        void Clear() noexcept;
+
+        /**
+         * 获取统计数据
+         */
+        [[nodiscard]] Statistics GetStatistics() const noexcept;
+
+    private:
+        struct KeyHasher
+        {
+            size_t operator()(const Key& key) const noexcept
+            {
+                auto h = std::hash<uint64_t>{}(key.Archive);
+                h ^= std::hash<uint64_t>{}(key.Entry) + 0x9E3779B9u + (h << 6) + (h >> 2);
+                h ^= std::hash<uint64_t>{}(key.Block) + 0x9E3779B9u + (h << 6) + (h >> 2);
+                return h;
+            }
+        };
+
+        using NodeContainer = std::list<std::pair<Key, BlockPtr>>;
+
+        void Evict() noexcept;
+
+    private:
+        mutable std::mutex m_stMutex;
+        size_t m_uCapacity = 0;
+        size_t m_uUsedBytes = 0;
+        NodeContainer m_stNodes;  // 队首为最近使用
+        std::unordered_map<Key, NodeContainer::iterator, KeyHasher> m_stLookupTable;
+        std::atomic<uint64_t> m_ullHits;
+        std::atomic<uint64_t> m_ullMisses;
+    };
+
+    using BlockCachePtr = std::shared_ptr<BlockCache>;
+}
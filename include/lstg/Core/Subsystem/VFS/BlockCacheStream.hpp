@@ -0,0 +1,67 @@
+/**
+ * @file
+ * @date 2022/9/3
+ * @author 9chu
+ * 此文件为 LuaSTGPlus 项目的一部分，版权与许可声明详见 COPYRIGHT.txt。
+ */
+#pragma once
+#include "IStream.hpp"
+#include "BlockCache.hpp"
+
+namespace lstg::Subsystem::VFS
+{
+    /**
+     * 块缓存流
+     * 以 BlockCache::kBlockSize 为单位读取底层流并放入共享的块缓存，之后对同一数据的读取（包括重复打开同一文件）直接从缓存拷贝。
+     * 用于包装代价较高的底层流（例如解压流），底层流需要从开头开始、并支持随机访问。
+     */
+    class BlockCacheStream :
+        public IStream
+    {
+    public:
+        /**
+         * 构造块缓存流
+         * @param underlay 底层数据流，读写位置需要位于开头
+         * @param cache 块缓存
+         * @param archive 档案 ID
+         * @param entry 条目 ID，同一档案中唯一
+         * @param length 流长度
+         */
+        BlockCacheStream(StreamPtr underlay, BlockCachePtr cache, uint64_t archive, uint64_t entry, uint64_t length) noexcept;
+        BlockCacheStream(const BlockCacheStream& org);
+
+    public:  // IStream
+        bool IsReadable() const noexcept override;
+        bool IsWriteable() const noexcept override;
+        bool IsSeekable() const noexcept override;
+        Result<uint64_t> GetLength() const noexcept override;
+        Result<void> SetLength(uint64_t length) noexcept override;
+        Result<uint64_t> GetPosition() const noexcept override;
+        Result<void> Seek(int64_t offset, StreamSeekOrigins origin) noexcept override;
+        Result<bool> IsEof() const noexcept override;
+        Result<void> Flush() noexcept override;
+        Result<size_t> Read(uint8_t* buffer, size_t length) noexcept override;
+        Result<void> Write(const uint8_t* buffer, size_t length) noexcept override;
+        Result<StreamPtr> Clone() const noexcept override;
+
+    public:
+        /**
+         * 获取底层数据流
+         */
+        [[nodiscard]] const StreamPtr& GetUnderlayStream() const noexcept { return m_pUnderlayStream; }
+
+    private:
+        Result<void> LoadBlock(uint64_t index) noexcept;
+
+    private:
+        StreamPtr m_pUnderlayStream;
+        BlockCachePtr m_pCache;
+        uint64_t m_ullArchiveId = 0;
+        uint64_t m_ullEntryId = 0;
+        uint64_t m_ullLength = 0;
+        uint64_t m_ullPosition = 0;
+        uint64_t m_ullUnderlayPosition = 0;
+        uint64_t m_ullCurrentBlockIndex = 0;
+        BlockCache::BlockPtr m_pCurrentBlock;  // 持有当前块，块内的连续小读取无需查询缓存
+    };
+}
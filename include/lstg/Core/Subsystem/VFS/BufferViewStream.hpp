@@ -14,7 +14,7 @@ namespace lstg::Subsystem::VFS
 {
     /**
      * 指向定长缓冲区的 Stream
-     * 不持有 Buffer 对象
+     * 不持有 Buffer 对象，可以通过 owner 保持缓冲区所属对象（例如内存映射）的生命周期。
      */
     template <typename T>
     class BufferViewStream : public IStream
@@ -25,13 +25,18 @@ namespace lstg::Subsystem::VFS
         {
         }
 
+        BufferViewStream(Span<T> buffer, std::shared_ptr<const void> owner) noexcept
+            : m_stBuffer(buffer), m_pOwner(std::move(owner))
+        {
+        }
+
         BufferViewStream(const BufferViewStream& rhs) noexcept
-            : m_stBuffer(rhs.m_stBuffer), m_uPosition(rhs.m_uPosition)
+            : m_stBuffer(rhs.m_stBuffer), m_pOwner(rhs.m_pOwner), m_uPosition(rhs.m_uPosition)
         {
         }
 
         BufferViewStream(BufferViewStream&& rhs) noexcept
-            : m_stBuffer(rhs.m_stBuffer), m_uPosition(rhs.m_uPosition)
+            : m_stBuffer(rhs.m_stBuffer), m_pOwner(std::move(rhs.m_pOwner)), m_uPosition(rhs.m_uPosition)
         {
             rhs.m_stBuffer = {};
             rhs.m_uPosition = 0;
@@ -43,6 +48,7 @@ namespace lstg::Subsystem::VFS
                 return *this;
 
             m_stBuffer = rhs.m_stBuffer;
+            m_pOwner = rhs.m_pOwner;
             m_uPosition = rhs.m_uPosition;
             return *this;
         }
@@ -53,6 +59,7 @@ namespace lstg::Subsystem::VFS
                 return *this;
 
             m_stBuffer = rhs.m_stBuffer;
+            m_pOwner = std::move(rhs.m_pOwner);
             m_uPosition = rhs.m_uPosition;
             rhs.m_stBuffer = {};
             rhs.m_uPosition = 0u;
@@ -171,8 +178,14 @@ namespace lstg::Subsystem::VFS
             }
         }
 
+        Result<Span<const uint8_t>> GetMemoryView() const noexcept override
+        {
+            return Span<const uint8_t> { reinterpret_cast<const uint8_t*>(m_stBuffer.GetData()), m_stBuffer.GetSize() * sizeof(T) };
+        }
+
     private:
         Span<T> m_stBuffer;
+        std::shared_ptr<const void> m_pOwner;
         size_t m_uPosition = 0u;
     };
 }  // namespace lstg::Subsystem::VFS
@@ -0,0 +1,74 @@
+/**
+ * @file
+ * @date 2022/9/3
+ * @author 9chu
+ * 此文件为 LuaSTGPlus 项目的一部分，版权与许可声明详见 COPYRIGHT.txt。
+ */
+#pragma once
+#include <vector>
+#include "IStream.hpp"
+
+namespace lstg::Subsystem::VFS
+{
+    /**
+     * 带读缓冲的流
+     * 每次从底层流预读一整个缓冲区，解码器发出的大量小读取和缓冲区内的 Seek 不再穿透到底层流。
+     * 只读，超过缓冲区大小的读取直接交给底层流。
+     */
+    class BufferedStream :
+        public IStream
+    {
+    public:
+        /**
+         * 默认缓冲区大小
+         */
+        static constexpr size_t kDefaultBufferSize = 64 * 1024;
+
+    public:
+        /**
+         * 构造带缓冲的流
+         * 从底层流的当前位置开始读取。
+         * @param underlay 底层数据流
+         * @param bufferSize 缓冲区大小
+         */
+        BufferedStream(StreamPtr underlay, size_t bufferSize = kDefaultBufferSize);
+        BufferedStream(const BufferedStream& org);
+
+    public:  // IStream
+        bool IsReadable() const noexcept override;
+        bool IsWriteable() const noexcept override;
+        bool IsSeekable() const noexcept override;
+        Result<uint64_t> GetLength() const noexcept override;
+        Result<void> SetLength(uint64_t length) noexcept override;
+        Result<uint64_t> GetPosition() const noexcept override;
+        Result<void> Seek(int64_t offset, StreamSeekOrigins origin) noexcept override;
+        Result<bool> IsEof() const noexcept override;
+        Result<void> Flush() noexcept override;
+        Result<size_t> Read(uint8_t* buffer, size_t length) noexcept override;
+        Result<void> Write(const uint8_t* buffer, size_t length) noexcept override;
+        Result<StreamPtr> Clone() const noexcept override;
+        Result<Span<const uint8_t>> GetMemoryView() const noexcept override;
+
+    public:
+        /**
+         * 获取底层数据流
+         */
+        [[nodiscard]] const StreamPtr& GetUnderlayStream() const noexcept { return m_pUnderlayStream; }
+
+    private:
+        StreamPtr m_pUnderlayStream;
+        std::vector<uint8_t> m_stBuffer;
+        uint64_t m_ullBufferStart = 0;  // 缓冲区开头在底层流中的位置
+        size_t m_uBufferLength = 0;  // 缓冲区有效数据长度，底层流总是位于 m_ullBufferStart + m_uBufferLength
+        size_t m_uBufferOffset = 0;  // 缓冲区内的读取位置
+    };
+
+    /**
+     * 为流添加读缓冲
+     * 流本身位于内存中或已经带有缓冲时原样返回。
+     * @param stream 流
+     * @param bufferSize 缓冲区大小
+     * @return 流对象
+     */
+    Result<StreamPtr> MakeBufferedStream(StreamPtr stream, size_t bufferSize = BufferedStream::kDefaultBufferSize) noexcept;
+}
@@ -0,0 +1,100 @@
+/**
+ * @file
+ * @date 2022/8/28
+ * @author 9chu
+ * 此文件为 LuaSTGPlus 项目的一部分，版权与许可声明详见 COPYRIGHT.txt。
+ */
+#pragma once
+#include <vector>
+#include "IFileSystem.hpp"
+
+namespace lstg::Subsystem::VFS
+{
+    namespace detail
+    {
+        /**
+         * 资源束文件头
+         */
+        struct BundleHeader
+        {
+            char Magic[8];  // "LSTGBDL\0"
+            uint32_t Version;
+            uint32_t FileCount;
+            uint64_t IndexSize;  // 文件表与路径字符串表的总大小，紧跟在文件头之后
+            uint64_t Reserved;
+        };
+        static_assert(sizeof(BundleHeader) == 32);
+
+        /**
+         * 资源束文件表项
+         */
+        struct BundleFileEntry
+        {
+            uint64_t DataOffset;  // 数据相对于资源束开头的偏移，按 kBundleDataAlignment 对齐
+            uint64_t DataSize;
+            int64_t LastModified;
+            uint32_t PathOffset;  // 路径相对于路径字符串表开头的偏移
+            uint32_t PathLength;
+        };
+        static_assert(sizeof(BundleFileEntry) == 32);
+    }
+
+    /**
+     * 资源束文件系统
+     * 资源束由离线工具（tool/AssetBundleTool）生成，是面向快速加载的只读档案格式：
+     *  - 所有数值按小端序存储，文件头之后紧跟定长的文件表和路径字符串表
+     *  - 文件表按路径的字节序排序，查找时直接二分，无需构建目录树
+     *  - 文件数据不压缩，并按 16 字节对齐存放，可直接映射到内存使用
+     */
+    class BundleFileSystem :
+        public IFileSystem
+    {
+    public:
+        static const uint32_t kBundleVersion = 1;
+        static const uint32_t kBundleDataAlignment = 16;
+
+    public:
+        /**
+         * 构造资源束文件系统
+         * 构造时只会读取文件头和文件表，失败时抛出 system_error。
+         * @param underlayStream 底层流，需要可以 Seek 和 Clone
+         */
+        BundleFileSystem(StreamPtr underlayStream);
+        BundleFileSystem(const BundleFileSystem&) = delete;
+
+    public:  // IFileSystem
+        Result<void> CreateDirectory(Path path) noexcept override;
+        Result<void> Remove(Path path) noexcept override;
+        Result<void> Rename(Path from, Path to) noexcept override;
+        Result<FileAttribute> GetFileAttribute(Path path) noexcept override;
+        Result<DirectoryIteratorPtr> VisitDirectory(Path path) noexcept override;
+        Result<StreamPtr> OpenFile(Path path, FileAccessMode access, FileOpenFlags flags) noexcept override;
+        Result<void> EnumerateImmutableEntries(std::vector<std::string_view>& out) noexcept override;
+        const std::string& GetUserData() const noexcept override;
+        void SetUserData(std::string ud) noexcept override;
+
+    public:
+        /**
+         * 获取文件数量
+         */
+        [[nodiscard]] size_t GetFileCount() const noexcept { return m_stEntries.size(); }
+
+        /**
+         * 获取文件路径
+         * @param index 索引
+         */
+        [[nodiscard]] std::string_view GetFilePath(size_t index) const noexcept;
+
+    private:
+        [[nodiscard]] std::string_view GetEntryPath(const detail::BundleFileEntry& entry) const noexcept;
+        [[nodiscard]] const detail::BundleFileEntry* LocateFile(std::string_view path) const noexcept;
+        [[nodiscard]] size_t LowerBound(std::string_view path) const noexcept;
+        [[nodiscard]] bool IsDirectory(std::string_view path) const noexcept;
+
+    private:
+        std::string m_stUserData;
+        StreamPtr m_pUnderlayStream;
+        std::vector<detail::BundleFileEntry> m_stEntries;
+        std::string m_stPathTable;
+    };
+}
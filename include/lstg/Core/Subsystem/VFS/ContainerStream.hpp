@@ -242,6 +242,11 @@ namespace lstg::Subsystem::VFS
             }
         }
 
+        Result<Span<const uint8_t>> GetMemoryView() const noexcept override
+        {
+            return Span<const uint8_t> { reinterpret_cast<const uint8_t*>(m_pContainer->data()), m_pContainer->size() };
+        }
+
     public:
         /**
          * @brief 获取底层容器
@@ -5,6 +5,7 @@
  * 此文件为 LuaSTGPlus 项目的一部分，版权与许可声明详见 COPYRIGHT.txt。
  */
 #pragma once
+#include <filesystem>
 #include "Path.hpp"
 #include "IStream.hpp"
 #include "../../Flag.hpp"
@@ -68,10 +69,15 @@ namespace lstg::Subsystem::VFS
 
     /**
      * 文件打开标志位
+     *
+     * MemoryMap 仅对只读打开有效，文件系统可以据此将文件映射到内存，不支持时退化为普通的流。
+     * 调用方需保证文件在流存活期间不被外部修改：Linux 下截断已映射的文件会导致访问时产生 SIGBUS，
+     * Windows 下已映射的文件无法被覆盖。因此只应对资源包等不可变文件使用。
      */
     LSTG_FLAG_BEGIN(FileOpenFlags)
         None = 0,
         Truncate = 1,
+        MemoryMap = 2,
     LSTG_FLAG_END(FileOpenFlags)
 
     /**
@@ -139,6 +145,66 @@ namespace lstg::Subsystem::VFS
          */
         virtual Result<StreamPtr> OpenFile(Path path, FileAccessMode access, FileOpenFlags flags) noexcept = 0;
 
+        /**
+         * 监视文件变化
+         * 文件系统支持变化通知时，此后该文件的修改会通过 PollChangedFiles 返回。
+         * 默认实现不支持变化通知，调用方应当回退到轮询 GetFileAttribute。
+         * @param path 传入路径，调用方保证一定是相对路径
+         * @return 错误码，不支持时返回 errc::not_supported
+         */
+        virtual Result<void> WatchFile(Path path) noexcept
+        {
+            static_cast<void>(path);
+            return make_error_code(std::errc::not_supported);
+        }
+
+        /**
+         * 取消监视文件
+         * 释放 WatchFile 占用的系统资源，未被监视的文件直接忽略。
+         * @param path 传入路径，调用方保证一定是相对路径
+         * @return 错误码
+         */
+        virtual Result<void> UnwatchFile(Path path) noexcept
+        {
+            static_cast<void>(path);
+            return {};
+        }
+
+        /**
+         * 取出自上次调用以来发生变化的被监视文件
+         * @param out 输出，路径追加到末尾
+         * @return 错误码
+         */
+        virtual Result<void> PollChangedFiles(std::vector<Path>& out) noexcept
+        {
+            static_cast<void>(out);
+            return {};
+        }
+
+        /**
+         * 获取文件在本地文件系统中的路径
+         * 用于绕过流对象直接交给操作系统进行 I/O（例如异步读写），文件可以尚不存在。
+         * @param path 传入路径，调用方保证一定是相对路径
+         * @return 本地路径，文件不以本地文件的形式存在时返回 errc::not_supported
+         */
+        virtual Result<std::filesystem::path> GetNativePath(Path path) noexcept
+        {
+            static_cast<void>(path);
+            return make_error_code(std::errc::not_supported);
+        }
+
+        /**
+         * 枚举文件系统中的所有条目
+         * 仅内容在生命周期内不会变化的文件系统（例如 ZIP 档案、资源束）需要实现，OverlayFileSystem 据此建立合并的查找表。
+         * @param out 输出，追加所有文件和文件夹的规格化相对路径（不以 '/' 开头，不含 '.'），视图在文件系统存活期间有效
+         * @return 错误码，内容可能变化的文件系统返回 errc::not_supported
+         */
+        virtual Result<void> EnumerateImmutableEntries(std::vector<std::string_view>& out) noexcept
+        {
+            static_cast<void>(out);
+            return make_error_code(std::errc::not_supported);
+        }
+
         /**
          * 获取用户关联数据
          */
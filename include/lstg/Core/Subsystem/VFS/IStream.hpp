@@ -7,6 +7,9 @@
 #pragma once
 #include <cstring>
 #include <memory>
+#include <algorithm>
+#include <vector>
+#include "../../Span.hpp"
 #include "../../Result.hpp"
 
 namespace lstg::Subsystem::VFS
@@ -110,6 +113,17 @@ namespace lstg::Subsystem::VFS
          * 复制后的流应当具备单独的读写位置和线程安全性。
          */
         virtual Result<StreamPtr> Clone() const noexcept = 0;
+
+        /**
+         * 获取流的内存视图
+         * 若流的全部内容直接位于内存中（例如内存映射的文件），返回指向 [0, GetLength()) 的视图，调用方可以直接访问而无需拷贝。
+         * 视图在流对象存活且未被写入期间有效，不影响读写位置。
+         * @return 内存视图，不支持时返回 errc::not_supported
+         */
+        virtual Result<Span<const uint8_t>> GetMemoryView() const noexcept
+        {
+            return make_error_code(std::errc::not_supported);
+        }
     };
 
     struct LittleEndianTag {};
@@ -690,6 +704,26 @@ namespace lstg::Subsystem::VFS
         assert(stream);
         out.clear();
 
+        // 内存中的流直接整块复制
+        auto view = stream->GetMemoryView();
+        if (view)
+        {
+            auto position = stream->GetPosition();
+            if (!position)
+                return position.GetError();
+            auto offset = static_cast<size_t>(std::min<uint64_t>(*position, view->GetSize()));
+            try
+            {
+                out.resize(view->GetSize() - offset);
+            }
+            catch (...)
+            {
+                return make_error_code(std::errc::not_enough_memory);
+            }
+            ::memcpy(out.data(), view->GetData() + offset, out.size());
+            return stream->Seek(0, StreamSeekOrigins::End);
+        }
+
         try
         {
             while (true)
@@ -713,6 +747,16 @@ namespace lstg::Subsystem::VFS
         return {};
     }
 
+    /**
+     * 读取流中剩余的所有数据，尽可能避免拷贝
+     * 若流支持 GetMemoryView，直接返回指向其内存的视图，此时需要在使用视图期间保持流对象存活；
+     * 否则读入 storage，返回指向 storage 的视图。
+     * @param storage 无法直接访问内存时使用的缓冲区
+     * @param stream 流
+     * @return 数据视图
+     */
+    Result<Span<const uint8_t>> ReadAllView(std::vector<uint8_t>& storage, IStream* stream) noexcept;
+
     /**
      * 转换到可随机访问流
      * 如果输入流是一个不能随机访问的流，则将其加载到内存中，产生内存流并返回。
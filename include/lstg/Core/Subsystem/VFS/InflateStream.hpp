@@ -15,14 +15,27 @@ namespace lstg::Subsystem::VFS
     {
         class ZStream;
         using ZStreamPtr = std::shared_ptr<ZStream>;
+
+        class InflateIndex;
+        using InflateIndexPtr = std::shared_ptr<InflateIndex>;
     }
 
     /**
      * 解压流
+     * 当底层流可以随机访问时，解压流也可以随机访问。
+     * 读取过程中会每隔 kIndexSpan 字节在 deflate 块边界处记录一个检查点，Seek 时从目标位置之前最近的检查点开始解压，
+     * 因此一次随机访问至多需要解压 kIndexSpan 字节的数据。检查点索引由流的所有副本共享。
      */
     class InflateStream :
         public IStream
     {
+    public:
+        /**
+         * 检查点间隔
+         * 每个检查点需要保存至多 32K 的滑动窗口。
+         */
+        static const uint64_t kIndexSpan = 256 * 1024;
+
     public:
         InflateStream(StreamPtr underlayStream, std::optional<uint64_t> uncompressedSize = {});
         InflateStream(const InflateStream& org);
@@ -53,8 +66,14 @@ namespace lstg::Subsystem::VFS
          */
         Result<void> Reset() noexcept;
 
+    private:
+        Result<void> RestoreAccessPoint(uint64_t target) noexcept;
+        void AddAccessPoint() noexcept;
+        Result<void> Skip(uint64_t count) noexcept;
+
     private:
         detail::ZStreamPtr m_pZStream;
+        detail::InflateIndexPtr m_pIndex;
         StreamPtr m_pUnderlayStream;
         bool m_bFinished = false;
         std::optional<uint64_t> m_stUncompressedSize;
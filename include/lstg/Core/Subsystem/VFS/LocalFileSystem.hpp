@@ -5,13 +5,20 @@
  * 此文件为 LuaSTGPlus 项目的一部分，版权与许可声明详见 COPYRIGHT.txt。
  */
 #pragma once
+#include <memory>
 #include <filesystem>
 #include "IFileSystem.hpp"
 
 namespace lstg::Subsystem::VFS
 {
+    namespace detail
+    {
+        class LocalFileWatcher;
+    }
+
     /**
      * 本地文件系统
+     * 在 Linux 下支持通过 inotify 监视文件变化。
      */
     class LocalFileSystem :
         public IFileSystem
@@ -22,6 +29,7 @@ namespace lstg::Subsystem::VFS
          * @param root 根路径
          */
         LocalFileSystem(std::filesystem::path root) noexcept;
+        ~LocalFileSystem() override;
 
     public:  // IFileSystem
         Result<void> CreateDirectory(Path path) noexcept override;
@@ -30,6 +38,10 @@ namespace lstg::Subsystem::VFS
         Result<FileAttribute> GetFileAttribute(Path path) noexcept override;
         Result<DirectoryIteratorPtr> VisitDirectory(Path path) noexcept override;
         Result<StreamPtr> OpenFile(Path path, FileAccessMode access, FileOpenFlags flags) noexcept override;
+        Result<std::filesystem::path> GetNativePath(Path path) noexcept override;
+        Result<void> WatchFile(Path path) noexcept override;
+        Result<void> UnwatchFile(Path path) noexcept override;
+        Result<void> PollChangedFiles(std::vector<Path>& out) noexcept override;
         const std::string& GetUserData() const noexcept override;
         void SetUserData(std::string ud) noexcept override;
 
@@ -39,5 +51,6 @@ namespace lstg::Subsystem::VFS
     private:
         std::string m_stUserData;
         std::filesystem::path m_stRoot;
+        std::unique_ptr<detail::LocalFileWatcher> m_pWatcher;  // 首次 WatchFile 时创建
     };
 }
@@ -0,0 +1,58 @@
+/**
+ * @file
+ * @date 2022/8/30
+ * @author 9chu
+ * 此文件为 LuaSTGPlus 项目的一部分，版权与许可声明详见 COPYRIGHT.txt。
+ */
+#pragma once
+#include <filesystem>
+#include "IStream.hpp"
+
+namespace lstg::Subsystem::VFS
+{
+    /**
+     * 只读内存映射文件
+     * 映射对象通过 shared_ptr 在所有由其产生的流之间共享，最后一个流释放时解除映射。
+     */
+    class MemoryMappedFile
+    {
+    public:
+        /**
+         * 当前平台是否支持
+         */
+        static bool IsSupported() noexcept;
+
+        /**
+         * 以内存映射的方式打开文件
+         * 返回的流为 BufferViewStream，其 GetMemoryView 直接指向映射的内存。
+         * @param path 路径
+         * @return 流对象，不支持或映射失败时返回错误码，调用方应当回退到 FileStream
+         */
+        static Result<StreamPtr> OpenStream(const std::filesystem::path& path) noexcept;
+
+    public:
+        /**
+         * 映射文件
+         * 失败时抛出 system_error。
+         * @param path 路径
+         */
+        MemoryMappedFile(const std::filesystem::path& path);
+        MemoryMappedFile(const MemoryMappedFile&) = delete;
+        MemoryMappedFile(MemoryMappedFile&&) = delete;
+        ~MemoryMappedFile();
+
+    public:
+        /**
+         * 获取映射的内存
+         */
+        [[nodiscard]] Span<const uint8_t> GetView() const noexcept { return { m_pData, m_uSize }; }
+
+    private:
+        const uint8_t* m_pData = nullptr;
+        size_t m_uSize = 0;
+#ifdef LSTG_PLATFORM_WIN32
+        void* m_pFileHandle = nullptr;
+        void* m_pMappingHandle = nullptr;
+#endif
+    };
+}
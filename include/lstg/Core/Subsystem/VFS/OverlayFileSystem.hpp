@@ -6,6 +6,8 @@
  */
 #pragma once
 #include <vector>
+#include <optional>
+#include <unordered_map>
 #include "IFileSystem.hpp"
 
 namespace lstg::Subsystem::VFS
@@ -13,6 +15,8 @@ namespace lstg::Subsystem::VFS
     /**
      * 多层文件系统
      * 实现在多个文件系统中对文件进行操作，最先加入的文件系统会在最后参与查找（栈）。
+     * 对于内容不可变的文件系统（见 IFileSystem::EnumerateImmutableEntries），会在增删文件系统时建立合并的查找表，
+     * 查找时直接定位到包含路径的最上层，而无需逐层尝试。
      */
     class OverlayFileSystem :
         public IFileSystem
@@ -60,11 +64,19 @@ namespace lstg::Subsystem::VFS
         Result<FileAttribute> GetFileAttribute(Path path) noexcept override;
         Result<DirectoryIteratorPtr> VisitDirectory(Path path) noexcept override;
         Result<StreamPtr> OpenFile(Path path, FileAccessMode access, FileOpenFlags flags) noexcept override;
+        Result<std::filesystem::path> GetNativePath(Path path) noexcept override;
         const std::string& GetUserData() const noexcept override;
         void SetUserData(std::string ud) noexcept override;
 
+    private:
+        void RebuildMergedIndex() noexcept;
+        bool LookupMergedIndex(const Path& path, std::optional<size_t>& hit) const noexcept;
+
     private:
         std::string m_stUserData;
         std::vector<FileSystemPtr> m_stFileSystems;
+        bool m_bMergedIndexValid = false;
+        std::vector<bool> m_stImmutableLayers;  // 对应层是否参与合并查找表
+        std::unordered_map<std::string_view, size_t> m_stMergedIndex;  // 路径 -> 包含该路径的最上层不可变文件系统
     };
 }
@@ -41,6 +41,10 @@ namespace lstg::Subsystem::VFS
         Result<FileAttribute> GetFileAttribute(Path path) noexcept override;
         Result<DirectoryIteratorPtr> VisitDirectory(Path path) noexcept override;
         Result<StreamPtr> OpenFile(Path path, FileAccessMode access, FileOpenFlags flags) noexcept override;
+        Result<std::filesystem::path> GetNativePath(Path path) noexcept override;
+        Result<void> WatchFile(Path path) noexcept override;
+        Result<void> UnwatchFile(Path path) noexcept override;
+        Result<void> PollChangedFiles(std::vector<Path>& out) noexcept override;
         const std::string& GetUserData() const noexcept override;
         void SetUserData(std::string ud) noexcept override;
 
@@ -53,6 +57,7 @@ namespace lstg::Subsystem::VFS
         };
 
         [[nodiscard]] std::tuple<FileSystemPtr, Path> FindMountPoint(const Path& path) const noexcept;
+        static Result<void> PollChangedFiles(const MountingPoint& mp, const Path& prefix, std::vector<Path>& out) noexcept;
 
     private:
         std::string m_stUserData;
@@ -39,6 +39,7 @@ namespace lstg::Subsystem::VFS
         Result<size_t> Read(uint8_t* buffer, size_t length) noexcept override;
         Result<void> Write(const uint8_t* buffer, size_t length) noexcept override;
         Result<StreamPtr> Clone() const noexcept override;
+        Result<Span<const uint8_t>> GetMemoryView() const noexcept override;
 
     private:
         StreamPtr m_pUnderlay;
@@ -6,8 +6,11 @@
  */
 #pragma once
 #include <map>
+#include <deque>
 #include <variant>
+#include <unordered_map>
 #include "IFileSystem.hpp"
+#include "BlockCache.hpp"
 
 namespace lstg::Subsystem::VFS
 {
@@ -29,6 +32,7 @@ namespace lstg::Subsystem::VFS
     /**
      * ZIP 档案文件系统
      * 仅支持从 ZIP 文档中读取文件。
+     * 除文件树外，额外以完整路径建立哈希索引，规格化的路径可以直接查表而无需逐级查找。
      */
     class ZipArchiveFileSystem :
         public IFileSystem
@@ -45,18 +49,35 @@ namespace lstg::Subsystem::VFS
         Result<FileAttribute> GetFileAttribute(Path path) noexcept override;
         Result<DirectoryIteratorPtr> VisitDirectory(Path path) noexcept override;
         Result<StreamPtr> OpenFile(Path path, FileAccessMode access, FileOpenFlags flags) noexcept override;
+        Result<void> EnumerateImmutableEntries(std::vector<std::string_view>& out) noexcept override;
         const std::string& GetUserData() const noexcept override;
         void SetUserData(std::string ud) noexcept override;
 
+    public:
+        /**
+         * 获取块缓存
+         */
+        [[nodiscard]] const BlockCachePtr& GetBlockCache() const noexcept;
+
+        /**
+         * 设置块缓存
+         * 设置后，压缩文件解压得到的数据会按块缓存，重复打开同一文件时直接从缓存读取。
+         * @param cache 块缓存，为 nullptr 时不缓存
+         */
+        void SetBlockCache(BlockCachePtr cache) noexcept;
+
     private:
         [[nodiscard]] detail::ConstZipEntry LocatePath(const Path& path) const noexcept;
         void ClearFileTree();
         detail::ZipDirectoryEntry* CreateTree(const Path& path);
+        void AddPathIndex(std::string key, detail::ConstZipEntry entry, bool overwrite);
 
     private:
         std::string m_stUserData;
         detail::ZipFile* m_pZipFile = nullptr;
         detail::ZipDirectoryEntry m_stRoot;
+        std::deque<std::string> m_stPathIndexKeys;  // 保证 string_view 指向的内存不发生移动
+        std::unordered_map<std::string_view, detail::ConstZipEntry> m_stPathIndex;
         std::string m_stPassword;
     };
 }
@@ -7,6 +7,8 @@
 #pragma once
 #include "ISubsystem.hpp"
 #include "VFS/RootFileSystem.hpp"
+#include "VFS/BlockCache.hpp"
+#include "VFS/AsyncIOService.hpp"
 
 namespace lstg::Subsystem
 {
@@ -36,6 +38,12 @@ namespace lstg::Subsystem
          */
         void SetAssetBaseDirectory(std::string_view path) { m_stAssetBaseDirectory = path; }
 
+        /**
+         * 获取共享的块缓存
+         * 挂载档案类文件系统时可以设置此缓存，以便在内存中保留解压后的数据。
+         */
+        [[nodiscard]] const VFS::BlockCachePtr& GetBlockCache() const noexcept { return m_pBlockCache; }
+
         /**
          * 创建文件夹
          * @param path 路径
@@ -90,6 +98,54 @@ namespace lstg::Subsystem
          */
         Result<size_t> ReadFile(std::vector<uint8_t>& out, std::string_view path);
 
+        /**
+         * 异步读取文件
+         * 完成回调在主线程的 Update 中执行。
+         * @param path 路径
+         * @param offset 文件偏移
+         * @param length 读取长度，为 VFS::AsyncIOService::kReadToEnd 时读取到文件结尾
+         * @param callback 完成回调
+         * @return 是否成功发起
+         */
+        Result<void> ReadFileAsync(std::string_view path, uint64_t offset, size_t length, VFS::AsyncReadCallback callback) noexcept;
+
+        /**
+         * 异步写入文件
+         * 以截断方式写入全部数据，完成回调在主线程的 Update 中执行。
+         * @param path 路径
+         * @param data 数据
+         * @param callback 完成回调
+         * @return 是否成功发起
+         */
+        Result<void> WriteFileAsync(std::string_view path, std::vector<uint8_t> data, VFS::AsyncWriteCallback callback) noexcept;
+
+        /**
+         * 获取异步 I/O 服务
+         */
+        VFS::AsyncIOService& GetAsyncIOService() noexcept { return m_stAsyncIOService; }
+
+        /**
+         * 监视文件变化
+         * 仅部分文件系统（如 Linux 下的本地文件系统）支持，不支持时返回 errc::not_supported。
+         * @param path 路径
+         * @return 是否成功
+         */
+        Result<void> WatchFile(std::string_view path) noexcept;
+
+        /**
+         * 取消监视文件
+         * @param path 路径
+         * @return 是否成功
+         */
+        Result<void> UnwatchFile(std::string_view path) noexcept;
+
+        /**
+         * 取出发生变化的被监视文件
+         * @param out 输出，规格化后的路径追加到末尾
+         * @return 是否成功
+         */
+        Result<void> PollChangedFiles(std::vector<VFS::Path>& out) noexcept;
+
         /**
          * 挂载文件系统
          * @param path 路径
@@ -104,8 +160,13 @@ namespace lstg::Subsystem
          */
         Result<bool> Unmount(std::string_view path) noexcept;
 
+    protected:  // ISubsystem
+        void OnUpdate(double elapsedTime) noexcept override;
+
     private:
         VFS::RootFileSystem m_stRootFileSystem;
         std::string m_stAssetBaseDirectory;
+        VFS::BlockCachePtr m_pBlockCache;
+        VFS::AsyncIOService m_stAsyncIOService;
     };
 }
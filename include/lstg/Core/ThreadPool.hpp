@@ -7,11 +7,13 @@
 #pragma once
 #include <cstdint>
 #include <cassert>
+#include <atomic>
 #include <chrono>
 #include <system_error>
 #include <variant>
 #include <deque>
 #include <vector>
+#include <memory>
 #include <functional>
 #if !(defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_PTHREADS__))
 #include <thread>
@@ -89,17 +91,17 @@ namespace lstg
             {
                 try
                 {
-                    m_stResult.emplace(std::in_place_index_t<1>{}, m_stJob());
+                    m_stResult.template emplace<1>(m_stJob());
                 }
                 catch (const std::system_error& ex)
                 {
-                    m_stResult.emplace(std::in_place_index_t<0>{}, ex.code());
+                    m_stResult.template emplace<0>(ex.code());
                 }
                 catch (...)
                 {
                     // 不明原因异常均按照内存不足处理
                     // FIXME: 考虑增加错误类型
-                    m_stResult.emplace(std::in_place_index_t<0>{}, make_error_code(std::errc::not_enough_memory));
+                    m_stResult.template emplace<0>(make_error_code(std::errc::not_enough_memory));
                 }
             }
 
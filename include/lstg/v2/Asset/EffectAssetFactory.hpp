@@ -9,12 +9,34 @@
 
 namespace lstg::v2::Asset
 {
+    class EffectAsset;
+
+    /**
+     * FX 资产创建参数
+     */
+    struct EffectAssetArguments
+    {
+        std::string_view Path;  // FX 文件路径
+    };
+
     /**
      * FX 资产工厂
      */
     class EffectAssetFactory :
         public Subsystem::Asset::IAssetFactory
     {
+    public:
+        using AssetType = EffectAsset;
+        using ArgumentsType = EffectAssetArguments;
+
+        /**
+         * 通过类型化参数创建资产
+         * 供引擎内部使用，可以避免构造和解析 json 参数。
+         * @see IAssetFactory::CreateAsset
+         */
+        Result<Subsystem::Asset::CreateAssetResult> CreateAsset(Subsystem::AssetSystem& assetSystem, Subsystem::Asset::AssetPoolPtr pool,
+            std::string_view name, const EffectAssetArguments& arguments, Subsystem::Asset::IAssetDependencyResolver* resolver) noexcept;
+
     public:  // IAssetFactory
         std::string_view GetAssetTypeName() const noexcept override;
         Subsystem::Asset::AssetTypeId GetAssetTypeId() const noexcept override;
@@ -29,6 +29,7 @@ namespace lstg::v2::Asset
         bool SupportHotReload() const noexcept override;
         bool CheckIsOutdated() const noexcept override;
         void PrepareToReload() noexcept override;
+        std::string_view GetWatchedPath() const noexcept override;
 #endif
 
     private:
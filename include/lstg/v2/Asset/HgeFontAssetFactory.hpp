@@ -10,6 +10,17 @@
 
 namespace lstg::v2::Asset
 {
+    class HgeFontAsset;
+
+    /**
+     * HGE 字体资产创建参数
+     */
+    struct HgeFontAssetArguments
+    {
+        std::string_view Path;  // 字体文件路径
+        bool Mipmaps = true;
+    };
+
     /**
      * HGE 字体资产工厂
      */
@@ -19,6 +30,18 @@ namespace lstg::v2::Asset
     public:
         HgeFontAssetFactory();
 
+    public:
+        using AssetType = HgeFontAsset;
+        using ArgumentsType = HgeFontAssetArguments;
+
+        /**
+         * 通过类型化参数创建资产
+         * 供引擎内部使用，可以避免构造和解析 json 参数。
+         * @see IAssetFactory::CreateAsset
+         */
+        Result<Subsystem::Asset::CreateAssetResult> CreateAsset(Subsystem::AssetSystem& assetSystem, Subsystem::Asset::AssetPoolPtr pool,
+            std::string_view name, const HgeFontAssetArguments& arguments, Subsystem::Asset::IAssetDependencyResolver* resolver) noexcept;
+
     public:  // IAssetFactory
         std::string_view GetAssetTypeName() const noexcept override;
         Subsystem::Asset::AssetTypeId GetAssetTypeId() const noexcept override;
@@ -5,10 +5,27 @@
  * 此文件为 LuaSTGPlus 项目的一部分，版权与许可声明详见 COPYRIGHT.txt。
  */
 #pragma once
+#include <optional>
 #include <lstg/Core/Subsystem/Asset/IAssetFactory.hpp>
+#include <lstg/Core/Subsystem/Render/Drawing2D/ParticleConfig.hpp>
 
 namespace lstg::v2::Asset
 {
+    class HgeParticleAsset;
+
+    /**
+     * HGE 粒子资产创建参数
+     */
+    struct HgeParticleAssetArguments
+    {
+        std::string_view Path;  // 粒子文件路径
+        std::string_view Sprite;  // 精灵资产名
+        double ColliderHalfSizeX = 0.;
+        double ColliderHalfSizeY = 0.;
+        bool ColliderIsRect = false;
+        std::optional<Subsystem::Render::Drawing2D::ParticleEmitDirection> EmitDirectionOverride;  // 覆盖粒子文件中的发射方向
+    };
+
     /**
      * HGE 粒子资产工厂
      */
@@ -18,6 +35,18 @@ namespace lstg::v2::Asset
     public:
         HgeParticleAssetFactory() = default;
 
+    public:
+        using AssetType = HgeParticleAsset;
+        using ArgumentsType = HgeParticleAssetArguments;
+
+        /**
+         * 通过类型化参数创建资产
+         * 供引擎内部使用，可以避免构造和解析 json 参数。
+         * @see IAssetFactory::CreateAsset
+         */
+        Result<Subsystem::Asset::CreateAssetResult> CreateAsset(Subsystem::AssetSystem& assetSystem, Subsystem::Asset::AssetPoolPtr pool,
+            std::string_view name, const HgeParticleAssetArguments& arguments, Subsystem::Asset::IAssetDependencyResolver* resolver) noexcept;
+
     public:  // IAssetFactory
         std::string_view GetAssetTypeName() const noexcept override;
         Subsystem::Asset::AssetTypeId GetAssetTypeId() const noexcept override;
@@ -26,6 +26,7 @@ namespace lstg::v2::Asset
         Result<void> AsyncLoad() noexcept override;
         Result<void> PostLoad() noexcept override;
         void Update() noexcept override;
+        void GetDependencies(std::vector<Subsystem::Asset::AssetPtr>& out) const override;
 
 #if LSTG_ASSET_HOT_RELOAD
         bool SupportHotReload() const noexcept override;
@@ -5,16 +5,41 @@
  * 此文件为 LuaSTGPlus 项目的一部分，版权与许可声明详见 COPYRIGHT.txt。
  */
 #pragma once
+#include <limits>
 #include <lstg/Core/Subsystem/Asset/IAssetFactory.hpp>
 
 namespace lstg::v2::Asset
 {
+    class MusicAsset;
+
+    /**
+     * 音乐资产创建参数
+     */
+    struct MusicAssetArguments
+    {
+        std::string_view Path;  // 音频文件路径
+        uint32_t LoopBeginMs = 0;
+        uint32_t LoopEndMs = std::numeric_limits<uint32_t>::max();
+    };
+
     /**
      * 音乐资产工厂
      */
     class MusicAssetFactory :
         public Subsystem::Asset::IAssetFactory
     {
+    public:
+        using AssetType = MusicAsset;
+        using ArgumentsType = MusicAssetArguments;
+
+        /**
+         * 通过类型化参数创建资产
+         * 供引擎内部使用，可以避免构造和解析 json 参数。
+         * @see IAssetFactory::CreateAsset
+         */
+        Result<Subsystem::Asset::CreateAssetResult> CreateAsset(Subsystem::AssetSystem& assetSystem, Subsystem::Asset::AssetPoolPtr pool,
+            std::string_view name, const MusicAssetArguments& arguments, Subsystem::Asset::IAssetDependencyResolver* resolver) noexcept;
+
     public:  // IAssetFactory
         std::string_view GetAssetTypeName() const noexcept override;
         Subsystem::Asset::AssetTypeId GetAssetTypeId() const noexcept override;
@@ -9,12 +9,41 @@
 
 namespace lstg::v2::Asset
 {
+    class SpriteAsset;
+
+    /**
+     * 精灵资产创建参数
+     */
+    struct SpriteAssetArguments
+    {
+        std::string_view Texture;  // 纹理资产名
+        float Left = 0.f;
+        float Top = 0.f;
+        float Width = 0.f;
+        float Height = 0.f;
+        double ColliderHalfSizeX = 0.;
+        double ColliderHalfSizeY = 0.;
+        bool ColliderIsRect = false;
+    };
+
     /**
      * 精灵资产工厂
      */
     class SpriteAssetFactory :
         public Subsystem::Asset::IAssetFactory
     {
+    public:
+        using AssetType = SpriteAsset;
+        using ArgumentsType = SpriteAssetArguments;
+
+        /**
+         * 通过类型化参数创建资产
+         * 供引擎内部使用，可以避免构造和解析 json 参数。
+         * @see IAssetFactory::CreateAsset
+         */
+        Result<Subsystem::Asset::CreateAssetResult> CreateAsset(Subsystem::AssetSystem& assetSystem, Subsystem::Asset::AssetPoolPtr pool,
+            std::string_view name, const SpriteAssetArguments& arguments, Subsystem::Asset::IAssetDependencyResolver* resolver) noexcept;
+
     public:  // IAssetFactory
         std::string_view GetAssetTypeName() const noexcept override;
         Subsystem::Asset::AssetTypeId GetAssetTypeId() const noexcept override;
@@ -9,12 +9,44 @@
 
 namespace lstg::v2::Asset
 {
+    class SpriteSequenceAsset;
+
+    /**
+     * 精灵序列动画资产创建参数
+     */
+    struct SpriteSequenceAssetArguments
+    {
+        std::string_view Texture;  // 纹理资产名
+        float Left = 0.f;
+        float Top = 0.f;
+        float FrameWidth = 0.f;
+        float FrameHeight = 0.f;
+        int32_t Row = 0;
+        int32_t Column = 0;
+        int32_t Interval = 0;
+        double ColliderHalfSizeX = 0.;
+        double ColliderHalfSizeY = 0.;
+        bool ColliderIsRect = false;
+    };
+
     /**
      * 精灵序列动画资产工厂
      */
     class SpriteSequenceAssetFactory :
         public Subsystem::Asset::IAssetFactory
     {
+    public:
+        using AssetType = SpriteSequenceAsset;
+        using ArgumentsType = SpriteSequenceAssetArguments;
+
+        /**
+         * 通过类型化参数创建资产
+         * 供引擎内部使用，可以避免构造和解析 json 参数。
+         * @see IAssetFactory::CreateAsset
+         */
+        Result<Subsystem::Asset::CreateAssetResult> CreateAsset(Subsystem::AssetSystem& assetSystem, Subsystem::Asset::AssetPoolPtr pool,
+            std::string_view name, const SpriteSequenceAssetArguments& arguments, Subsystem::Asset::IAssetDependencyResolver* resolver) noexcept;
+
     public:  // IAssetFactory
         std::string_view GetAssetTypeName() const noexcept override;
         Subsystem::Asset::AssetTypeId GetAssetTypeId() const noexcept override;
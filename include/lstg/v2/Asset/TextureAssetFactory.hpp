@@ -12,12 +12,35 @@ namespace lstg::v2::Asset
 {
     class TextureAsset;
 
+    /**
+     * 纹理资产创建参数
+     */
+    struct TextureAssetArguments
+    {
+        bool RenderTarget = false;  // 是否创建为 RT，此时忽略 Path 和 Mipmaps
+        std::string_view Path;  // 纹理文件路径
+        bool Mipmaps = true;
+        float PixelPerUnit = 1.f;
+    };
+
     /**
      * 纹理资产工厂
      */
     class TextureAssetFactory :
         public Subsystem::Asset::IAssetFactory
     {
+    public:
+        using AssetType = TextureAsset;
+        using ArgumentsType = TextureAssetArguments;
+
+        /**
+         * 通过类型化参数创建资产
+         * 供引擎内部使用，可以避免构造和解析 json 参数。
+         * @see IAssetFactory::CreateAsset
+         */
+        Result<Subsystem::Asset::CreateAssetResult> CreateAsset(Subsystem::AssetSystem& assetSystem, Subsystem::Asset::AssetPoolPtr pool,
+            std::string_view name, const TextureAssetArguments& arguments, Subsystem::Asset::IAssetDependencyResolver* resolver) noexcept;
+
     public:  // IAssetFactory
         std::string_view GetAssetTypeName() const noexcept override;
         Subsystem::Asset::AssetTypeId GetAssetTypeId() const noexcept override;
@@ -10,6 +10,17 @@
 
 namespace lstg::v2::Asset
 {
+    class TrueTypeFontAsset;
+
+    /**
+     * TrueType 字体资产创建参数
+     */
+    struct TrueTypeFontAssetArguments
+    {
+        std::string_view Path;  // 字体文件路径
+        uint32_t Size = 0;  // 字号
+    };
+
     /**
      * TrueType 字体资产工厂
      */
@@ -19,6 +30,18 @@ namespace lstg::v2::Asset
     public:
         TrueTypeFontAssetFactory();
 
+    public:
+        using AssetType = TrueTypeFontAsset;
+        using ArgumentsType = TrueTypeFontAssetArguments;
+
+        /**
+         * 通过类型化参数创建资产
+         * 供引擎内部使用，可以避免构造和解析 json 参数。
+         * @see IAssetFactory::CreateAsset
+         */
+        Result<Subsystem::Asset::CreateAssetResult> CreateAsset(Subsystem::AssetSystem& assetSystem, Subsystem::Asset::AssetPoolPtr pool,
+            std::string_view name, const TrueTypeFontAssetArguments& arguments, Subsystem::Asset::IAssetDependencyResolver* resolver) noexcept;
+
     public:  // IAssetFactory
         std::string_view GetAssetTypeName() const noexcept override;
         Subsystem::Asset::AssetTypeId GetAssetTypeId() const noexcept override;
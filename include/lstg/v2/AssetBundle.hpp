@@ -0,0 +1,69 @@
+/**
+ * @file
+ * @author 9chu
+ * @date 2022/8/28
+ * 此文件为 LuaSTGPlus 项目的一部分，版权与许可声明详见 COPYRIGHT.txt。
+ */
+#pragma once
+#include <lstg/Core/Subsystem/AssetSystem.hpp>
+#include <lstg/Core/Subsystem/VFS/IFileSystem.hpp>
+#include "AssetNaming.hpp"
+
+namespace lstg::v2
+{
+    namespace detail
+    {
+        /**
+         * 资源束清单文件头
+         */
+        struct AssetBundleManifestHeader
+        {
+            char Magic[4];  // "LSAM"
+            uint32_t Version;
+            uint32_t RecordCount;
+            uint32_t StringTableSize;  // 字符串表紧跟在记录表之后
+        };
+        static_assert(sizeof(AssetBundleManifestHeader) == 16);
+
+        /**
+         * 资源束清单记录
+         * 字段与各资产工厂的类型化参数一一对应，字符串字段为字符串表中以 '\0' 结尾的字符串的偏移，不存在时为 kNoString。
+         */
+        struct AssetBundleRecord
+        {
+            uint32_t Type;  // AssetTypes
+            uint32_t Flags;  // AssetBundleRecordFlags
+            uint32_t Name;  // 脚本系统中所用资产名
+            uint32_t Path;  // 资产文件路径，相对资产根目录
+            uint32_t Reference;  // 引用的资产名：精灵、动画为纹理名，粒子为精灵名
+            float Rect[4];  // 精灵为 Left, Top, Width, Height；动画为 Left, Top, FrameWidth, FrameHeight
+            int32_t Params[3];  // 动画为 Row, Column, Interval；音乐为 LoopBeginMs, LoopEndMs；TTF 为 Size
+            double Collider[2];  // 碰撞盒半宽、半高
+        };
+        static_assert(sizeof(AssetBundleRecord) == 64);
+
+        enum AssetBundleRecordFlags : uint32_t
+        {
+            Mipmaps = 1,
+            ColliderIsRect = 2,
+        };
+    }
+
+    /**
+     * 资源束中清单文件的路径
+     * 清单由 tool/AssetBundleTool 生成，描述资源束中所有资产的创建参数。
+     */
+    static const char* const kAssetBundleManifestPath = ".manifest";
+
+    /**
+     * 按照资源束清单创建资产
+     * 资源束需要已经挂载到资产根目录，清单中的资产按照记录顺序创建（工具保证被引用的资产排在前面）。
+     * 已经存在于资产池中的资产会被跳过。
+     * @param assetSystem 资产系统
+     * @param pool 资产池
+     * @param bundle 资源束文件系统
+     * @return 新创建的资产个数
+     */
+    Result<size_t> CreateAssetsFromBundle(Subsystem::AssetSystem& assetSystem, Subsystem::Asset::AssetPoolPtr pool,
+        Subsystem::VFS::IFileSystem& bundle) noexcept;
+}
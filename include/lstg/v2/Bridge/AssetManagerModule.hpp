@@ -281,6 +281,15 @@ namespace lstg::v2::Bridge
         LSTG_METHOD()
         static void LoadFX(LuaStack& stack, const char* name, const char* path);
 
+        /**
+         * 装载资源束
+         * 挂载由 AssetBundleTool 生成的资源束，并在当前资源池中创建其清单中记录的所有资产。
+         * @param path 路径
+         * @return 新创建的资产个数
+         */
+        LSTG_METHOD()
+        static int32_t LoadBundle(LuaStack& stack, const char* path);
+
         /**
          * 创建RT
          * @param name 纹理资产名
@@ -78,6 +78,23 @@ namespace lstg::v2::Bridge
         LSTG_METHOD()
         static void SetBound(double left, double right, double bottom, double top);
 
+        /**
+         * 设置是否并行构建默认渲染对象的绘制数据
+         * 开启后，连续的、未定义 render 回调的对象会在工作线程上进行顶点变换，绘制顺序与串行时一致。
+         * @param enabled 是否开启
+         */
+        LSTG_METHOD()
+        static void SetParallelRender(bool enabled);
+
+        /**
+         * 设置是否回收对象表
+         * 开启后，被删除对象的 table 会被清空并分配给新的对象，脚本不应在对象删除后继续持有其引用。
+         * @param stack Lua栈
+         * @param enabled 是否开启
+         */
+        LSTG_METHOD()
+        static void SetObjectTableRecycle(LuaStack& stack, bool enabled);
+
         /**
          * 执行边界检查
          * @note BoundCheck只保证对象中心还在范围内，不进行碰撞盒检查
@@ -295,6 +312,101 @@ namespace lstg::v2::Bridge
         LSTG_METHOD(ObjList)
         static Unpack<AbsIndex, int32_t, double> EnumerateObjectList(LuaStack& stack, int32_t groupId);
 
+        /**
+         * 批量查询对象
+         * 选中组中状态为 normal 的对象，供 ObjBatch 系列方法在 C++ 侧批量操作，再次查询时覆盖上一次的结果。
+         * @param groupId 组ID，若为无效的碰撞组则查询所有对象
+         * @param layerMin 图层下界（含）
+         * @param layerMax 图层上界（含）
+         * @return 选中的对象数量
+         */
+        LSTG_METHOD(ObjQuery)
+        static int32_t QueryObjects(int32_t groupId, std::optional<double> layerMin, std::optional<double> layerMax);
+
+        /**
+         * 在矩形区域内批量查询对象
+         * 以对象中心判断，包含边界。
+         * @param groupId 组ID，若为无效的碰撞组则查询所有对象
+         * @param left 左边
+         * @param right 右边
+         * @param bottom 底边
+         * @param top 顶边
+         * @param layerMin 图层下界（含）
+         * @param layerMax 图层上界（含）
+         * @return 选中的对象数量
+         */
+        LSTG_METHOD(ObjQueryRect)
+        static int32_t QueryObjectsInRect(int32_t groupId, double left, double right, double bottom, double top,
+            std::optional<double> layerMin, std::optional<double> layerMax);
+
+        /**
+         * 在圆形区域内批量查询对象
+         * 以对象中心判断。
+         * @param groupId 组ID，若为无效的碰撞组则查询所有对象
+         * @param x 圆心X
+         * @param y 圆心Y
+         * @param radius 半径
+         * @param layerMin 图层下界（含）
+         * @param layerMax 图层上界（含）
+         * @return 选中的对象数量
+         */
+        LSTG_METHOD(ObjQueryCircle)
+        static int32_t QueryObjectsInCircle(int32_t groupId, double x, double y, double radius, std::optional<double> layerMin,
+            std::optional<double> layerMax);
+
+        /**
+         * 获取查询结果
+         * @param stack Lua栈
+         * @return 由对象构成的数组
+         */
+        LSTG_METHOD(ObjBatchList)
+        static AbsIndex GetBatchObjects(LuaStack& stack);
+
+        /**
+         * 设置查询结果中所有对象的速度
+         * @param velocity 速度
+         * @param angle 角度
+         * @param track 是否同时设置旋转
+         */
+        LSTG_METHOD(ObjBatchSetV)
+        static void BatchSetVelocity(double velocity, double angle, std::optional<bool> track);
+
+        /**
+         * 向查询结果中的对象施加径向冲量
+         * @param x 中心X
+         * @param y 中心Y
+         * @param strength 冲量大小，为负时指向中心
+         * @param radius 作用半径，若指定则冲量随距离线性衰减，半径外的对象不受影响
+         */
+        LSTG_METHOD(ObjBatchImpulse)
+        static void BatchApplyImpulse(double x, double y, double strength, std::optional<double> radius);
+
+        /**
+         * 修改查询结果中所有对象的碰撞组
+         * @param stack Lua栈
+         * @param groupId 组ID
+         */
+        LSTG_METHOD(ObjBatchSetGroup)
+        static void BatchSetGroup(LuaStack& stack, int32_t groupId);
+
+        /**
+         * 删除查询结果中的所有对象
+         * @param stack Lua栈
+         * @param callback 是否调用 del 回调，默认调用
+         * @return 删除的对象数量
+         */
+        LSTG_METHOD(ObjBatchDel)
+        static int32_t BatchDelete(LuaStack& stack, std::optional<bool> callback);
+
+        /**
+         * 击杀查询结果中的所有对象
+         * @param stack Lua栈
+         * @param callback 是否调用 kill 回调，默认调用
+         * @return 击杀的对象数量
+         */
+        LSTG_METHOD(ObjBatchKill)
+        static int32_t BatchKill(LuaStack& stack, std::optional<bool> callback);
+
         /**
          * __index 方法
          * @param L 栈
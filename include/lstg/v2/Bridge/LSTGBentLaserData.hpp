@@ -79,6 +79,38 @@ namespace lstg::v2::Bridge
         LSTG_METHOD()
         bool BoundCheck() const;
 
+        /**
+         * 绑定发射对象
+         * 绑定后由 BentLaserUpdateAll / BentLaserRenderAll / BentLaserCollisionCheck 批量处理，无需逐个调用 Update。
+         * 发射对象失效时自动解绑。
+         * @param stack Lua栈
+         * @param baseObject 基准对象，以基准对象为起始点构造曲光
+         * @param length 节点数
+         * @param width 曲光宽度，同时用于影响碰撞
+         */
+        LSTG_METHOD()
+        void Bind(LuaStack& stack, AbsIndex baseObject, int32_t length, uint32_t width);
+
+        /**
+         * 解除绑定
+         */
+        LSTG_METHOD()
+        void Unbind();
+
+        /**
+         * 是否已经绑定
+         */
+        LSTG_METHOD()
+        bool IsBound() const;
+
+        /**
+         * 设置批量渲染状态
+         * 参数同 Render，设置后由 BentLaserRenderAll 渲染。
+         */
+        LSTG_METHOD()
+        void SetRenderState(const char* texture, const char* blend, LSTGColor* color, double texLeft, double texTop,
+            double texWidth, double texHeight, std::optional<double> scale /* =1 */);
+
         /**
          * 对象转字符串表示
          */
@@ -43,4 +43,10 @@ namespace lstg::v2::Bridge
         LSTG_METHOD(__tostring)
         std::string ToString() const;
     };
+
+    // 颜色既可以是 userdata，也可以是 FFI 实现的值类型（见 ValueTypes.hpp），通过 ADL 覆盖默认的类指针读取
+    int LuaRead(Subsystem::Script::LuaStack& stack, int idx, Result<LSTGColor*>& out);
+    int LuaRead(Subsystem::Script::LuaStack& stack, int idx, Result<const LSTGColor*>& out);
+    int LuaRead(Subsystem::Script::LuaStack& stack, int idx, LSTGColor*& out);
+    int LuaRead(Subsystem::Script::LuaStack& stack, int idx, const LSTGColor*& out);
 }
@@ -66,5 +66,31 @@ namespace lstg::v2::Bridge
          */
         LSTG_METHOD(BentLaserData)
         static LSTGBentLaserData NewBentLaserData();
+
+        /**
+         * 更新所有绑定的曲线激光
+         * 发射对象失效的曲线激光会被自动解绑。
+         * @return 更新的曲线激光数量
+         */
+        LSTG_METHOD()
+        static int32_t BentLaserUpdateAll();
+
+        /**
+         * 渲染所有绑定且设置了渲染状态的曲线激光
+         * @param stack Lua栈
+         */
+        LSTG_METHOD()
+        static void BentLaserRenderAll(Subsystem::Script::LuaStack& stack);
+
+        /**
+         * 检查所有绑定的曲线激光与对象的碰撞
+         * 使用对象自身的碰撞体。
+         * @param stack Lua栈
+         * @param object 被检查对象
+         * @return 由发生碰撞的曲线激光的发射对象构成的数组
+         */
+        LSTG_METHOD()
+        static Subsystem::Script::LuaStack::AbsIndex BentLaserCollisionCheck(Subsystem::Script::LuaStack& stack,
+            Subsystem::Script::LuaStack::AbsIndex object);
     };
 }
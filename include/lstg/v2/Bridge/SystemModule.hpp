@@ -18,6 +18,7 @@ namespace lstg::v2::Bridge
     {
     public:
         using LuaStack = Subsystem::Script::LuaStack;
+        using AbsIndex = LuaStack::AbsIndex;
 
     public:
         /**
@@ -138,5 +139,48 @@ namespace lstg::v2::Bridge
          */
         LSTG_METHOD()
         static void ShowSplashWindow(std::optional<std::string_view> path);
+
+        /**
+         * 暂停 GC
+         * 用于包裹对卡顿敏感的代码段，可以嵌套调用，需要与 ResumeGC 配对。
+         */
+        LSTG_METHOD(SuspendGC)
+        static void SuspendGarbageCollection();
+
+        /**
+         * 恢复 GC
+         * @param stack Lua栈
+         */
+        LSTG_METHOD(ResumeGC)
+        static void ResumeGarbageCollection(LuaStack& stack);
+
+        /**
+         * 设置每帧 GC 预算
+         * @param ratio 可用于 GC 的空闲时间占比
+         * @param minTime 每帧最短回收时间（秒）
+         * @param maxTime 每帧最长回收时间（秒）
+         */
+        LSTG_METHOD(SetGCBudget)
+        static void SetGarbageCollectionBudget(double ratio, double minTime, double maxTime);
+
+        /**
+         * 登记协程，在指定帧数后唤醒
+         * 登记后协程应当立即 yield，到期时由引擎在 FrameFunc 之前以无参数的形式 resume。
+         * 相比在脚本中逐帧 resume 计数，等待中的协程不产生任何开销。
+         * @param stack Lua栈
+         * @param co 协程
+         * @param frames 等待帧数，至少为 1
+         */
+        LSTG_METHOD()
+        static void ScheduleCoroutine(LuaStack& stack, AbsIndex co, int32_t frames);
+
+        /**
+         * 取消协程的等待
+         * @param stack Lua栈
+         * @param co 协程
+         * @return 协程是否在等待
+         */
+        LSTG_METHOD()
+        static bool CancelCoroutine(LuaStack& stack, AbsIndex co);
     };
 }
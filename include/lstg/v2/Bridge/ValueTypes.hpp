@@ -0,0 +1,31 @@
+/**
+ * @file
+ * @date 2022/10/2
+ * @author 9chu
+ * 此文件为 LuaSTGPlus 项目的一部分，版权与许可声明详见 COPYRIGHT.txt。
+ */
+#pragma once
+#include <lstg/Core/Subsystem/ScriptSystem.hpp>
+#include "LSTGColor.hpp"
+
+namespace lstg::v2::Bridge
+{
+    /**
+     * 注册脚本值类型
+     *
+     * 启用 LSTG_LUAJIT_FFI 时，lstg.Color 与 lstg.Vec2 由 FFI 结构体实现：构造与运算不再分配 userdata，字段可直接访问，
+     * 且能被 JIT 编译。未启用时 lstg.Color 保持 userdata 实现，lstg.Vec2 由共享元表的 table 实现。
+     * 需要在 InitBuiltInModule 之后调用。
+     * @param scriptSystem 脚本系统
+     */
+    Result<void> InitValueTypes(Subsystem::ScriptSystem& scriptSystem) noexcept;
+
+    /**
+     * 读取 FFI 实现的颜色
+     * FFI 颜色与 LSTGColor 内存布局一致，返回值直接指向 cdata 的数据。
+     * @param stack Lua 栈
+     * @param idx 索引
+     * @return 不是 FFI 颜色时返回 nullptr
+     */
+    LSTGColor* ReadFFIColor(Subsystem::Script::LuaStack& stack, int idx);
+}
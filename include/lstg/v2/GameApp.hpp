@@ -9,6 +9,7 @@
 #include <lstg/Core/AppBase.hpp>
 #include <lstg/Core/Exception.hpp>
 #include <lstg/Core/Subsystem/VFS/OverlayFileSystem.hpp>
+#include <lstg/Core/Subsystem/VFS/BundleFileSystem.hpp>
 #include <lstg/Core/Subsystem/Render/Drawing2D/CommandBuffer.hpp>
 #include <lstg/Core/Subsystem/Render/Drawing2D/CommandExecutor.hpp>
 #include <lstg/Core/Subsystem/Render/Drawing2D/TextDrawing.hpp>
@@ -60,6 +61,15 @@ namespace lstg::v2
          */
         Result<void> MountAssetPack(std::string_view path, std::optional<std::string_view> password, bool vfsBypass) noexcept;
 
+        /**
+         * 加载资源束
+         * 资源束由 tool/AssetBundleTool 离线生成，挂载后与资源包一样参与资产寻址，可通过 UnmountAssetPack 卸载。
+         * @param path 路径
+         * @param vfsBypass 是否略过文件系统直接加载文件
+         * @return 资源束文件系统，若已经挂载则返回已有对象
+         */
+        Result<std::shared_ptr<Subsystem::VFS::BundleFileSystem>> MountAssetBundle(std::string_view path, bool vfsBypass) noexcept;
+
         /**
          * 卸载资源包
          * @param path 路径
@@ -196,6 +206,21 @@ namespace lstg::v2
          */
         void AdjustViewport() noexcept;
 
+        /**
+         * 查找已经挂载的资源包
+         * @param path 路径
+         * @return 文件系统，不存在返回 nullptr
+         */
+        Subsystem::VFS::FileSystemPtr FindMountedAssetPack(std::string_view path) const noexcept;
+
+        /**
+         * 打开资源包文件流
+         * @param path 路径
+         * @param vfsBypass 是否略过文件系统直接加载文件
+         * @return 文件流
+         */
+        Result<Subsystem::VFS::StreamPtr> OpenAssetPackStream(std::string_view path, bool vfsBypass) noexcept;
+
     private:
         // 资源系统
         std::shared_ptr<Subsystem::VFS::OverlayFileSystem> m_pAssetsFileSystem;
@@ -5,7 +5,10 @@
 * 此文件为 LuaSTGPlus 项目的一部分，版权与许可声明详见 COPYRIGHT.txt。
 */
 #pragma once
+#include <string>
+#include <vector>
 #include <lstg/Core/CircularQueue.hpp>
+#include <lstg/Core/IntrusiveList.hpp>
 #include "ScriptObjectPool.hpp"
 #include "../MathAlias.hpp"
 #include "../BlendMode.hpp"
@@ -17,6 +20,9 @@ namespace lstg::v2::GamePlay
      *
      * lstg 中的曲线激光对象，由于脱离 GamePlay 存在，使用上较为不便。
      * 将在未来版本中移除。
+     *
+     * 通过 Bind 绑定发射对象后，激光会加入全局的批量列表，由 UpdateAll / RenderAll / CollisionCheckAll 统一在 C++ 侧处理，
+     * 避免脚本逐个遍历激光。
      */
     class BentLaser
     {
@@ -26,10 +32,54 @@ namespace lstg::v2::GamePlay
             double HalfWidth = 0.;
         };
 
+        struct BoundingBox
+        {
+            Vec2 Min;
+            Vec2 Max;
+        };
+
+        struct BatchNode :
+            public IntrusiveListNode
+        {
+            BentLaser* Owner = nullptr;
+        };
+
         enum {
-            kMaxLaserNodes = 512
+            kMaxLaserNodes = 512,
+            kNodesPerChunk = 16,  // 包围盒层次中每个叶子覆盖的节点数
+            kMaxChunks = (kMaxLaserNodes + kNodesPerChunk - 1) / kNodesPerChunk,
         };
 
+    public:
+        /**
+         * 更新所有绑定的激光
+         * 发射对象失效的激光会被自动解绑。
+         * @return 更新的激光数量
+         */
+        static size_t UpdateAll() noexcept;
+
+        /**
+         * 渲染所有设置了渲染状态的绑定激光
+         * 按照绑定顺序渲染。
+         * @return 是否全部成功
+         */
+        static bool RenderAll() noexcept;
+
+        /**
+         * 检查所有绑定的激光与对象的碰撞
+         * 使用对象自身的碰撞体，碰撞体被禁用时不产生结果。
+         * @param target 被检查的对象
+         * @param hits 输出，与对象相交的激光的发射对象
+         */
+        static void CollisionCheckAll(ECS::Entity target, std::vector<ScriptObjectId>& hits);
+
+    public:
+        BentLaser() noexcept;
+        BentLaser(const BentLaser& rhs);  // 副本不继承绑定状态
+        ~BentLaser();
+
+        BentLaser& operator=(const BentLaser& rhs);
+
     public:
         bool Update(ScriptObjectId id, int32_t length, double width) noexcept;
         void Release() noexcept;
@@ -38,8 +88,58 @@ namespace lstg::v2::GamePlay
         bool CollisionCheck(double x, double y, double rot, double a, double b, bool rect) const noexcept;
         bool BoundCheck() const noexcept;
 
+        /**
+         * 绑定发射对象并加入批量列表
+         * @param id 发射对象
+         * @param length 节点数
+         * @param width 宽度
+         */
+        bool Bind(ScriptObjectId id, int32_t length, double width) noexcept;
+
+        /**
+         * 从批量列表移除
+         */
+        void Unbind() noexcept;
+
+        /**
+         * 是否已经绑定
+         */
+        [[nodiscard]] bool IsBound() const noexcept { return m_stBatchNode.Next != nullptr; }
+
+        /**
+         * 设置批量渲染时使用的状态
+         * @param textureName 纹理
+         * @param blend 混合模式
+         * @param c 颜色
+         * @param textureRect 纹理区域
+         * @param scale 纵向缩放
+         */
+        void SetRenderState(std::string textureName, BlendMode blend, Subsystem::Render::ColorRGBA32 c, Math::UVRectangle textureRect,
+            double scale);
+
+    private:
+        bool CollisionCheck(Vec2 location, double rot, const ColliderShape& shape, Vec2 aabbHalfSize) const noexcept;
+        void RefreshBounds() const noexcept;
+
     private:
         CircularQueue<LaserNode, kMaxLaserNodes> m_stQueue;
         double m_dLength = 0.;  // 记录激光长度
+
+        // 两层包围盒层次：根包围盒与每 kNodesPerChunk 个节点的包围盒，节点变化后在下一次碰撞检查时重建
+        mutable bool m_bBoundsDirty = true;
+        mutable BoundingBox m_stBounds;
+        mutable BoundingBox m_stChunkBounds[kMaxChunks];
+
+        // 批量处理
+        BatchNode m_stBatchNode;
+        ScriptObjectId m_uEmitterId = 0;
+        int32_t m_iBindLength = 0;
+        double m_dBindWidth = 0.;
+        bool m_bHasRenderState = false;
+        std::string m_stRenderTexture;
+        BlendMode m_stRenderBlend;
+        Subsystem::Render::ColorRGBA32 m_stRenderColor;
+        Math::UVRectangle m_stRenderRect;
+        double m_dRenderScale = 1.;
     };
 }
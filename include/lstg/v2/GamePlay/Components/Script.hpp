@@ -25,6 +25,12 @@ namespace lstg::v2::GamePlay::Components
          */
         uint32_t ScriptObjectId = 0;
 
+        /**
+         * 创建序号
+         * ScriptObjectId 会被复用，同层对象按照该序号排序。
+         */
+        uint64_t Sequence = 0;
+
         /**
          * 脚本对象池
          */
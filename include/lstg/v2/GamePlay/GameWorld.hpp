@@ -6,6 +6,9 @@
  */
 #pragma once
 #include <lstg/Core/IntrusiveSkipList.hpp>
+#include <lstg/Core/IntrusiveSkipListTailCache.hpp>
+#include <lstg/Core/ForkJoinPool.hpp>
+#include <lstg/Core/Subsystem/Render/Drawing2D/Sprite.hpp>
 #include <lstg/Core/Subsystem/SubsystemContainer.hpp>
 #include <lstg/Core/ECS/World.hpp>
 #include "ScriptObjectPool.hpp"
@@ -21,6 +24,8 @@ namespace lstg::v2::GamePlay::Components
     struct LifeTimeRoot;
     struct ColliderRoot;
     struct RendererRoot;
+    struct Collider;
+    struct Renderer;
 }
 
 namespace lstg::v2::GamePlay
@@ -31,6 +36,32 @@ namespace lstg::v2::GamePlay
     class GameWorld :
         public IScriptObjectBridge
     {
+    public:
+        /**
+         * 批量查询的区域类型
+         */
+        enum class QueryRegionTypes
+        {
+            None,
+            Rectangle,
+            Circle,
+        };
+
+        /**
+         * 批量查询条件
+         * 区域以对象中心判断，包含边界。
+         */
+        struct EntityQuery
+        {
+            std::optional<uint32_t> Group;  // 碰撞组，为空时查询所有对象
+            std::optional<double> LayerMin;  // 图层下界（含）
+            std::optional<double> LayerMax;  // 图层上界（含）
+            QueryRegionTypes RegionType = QueryRegionTypes::None;
+            WorldRectangle Rectangle;  // RegionType 为 Rectangle 时有效
+            Vec2 Center { 0., 0. };  // RegionType 为 Circle 时有效
+            double Radius = 0.;  // RegionType 为 Circle 时有效
+        };
+
     public:
         GameWorld(GameApp& app);
         GameWorld(const GameWorld&) = delete;
@@ -71,6 +102,19 @@ namespace lstg::v2::GamePlay
          */
         void SetBoundary(const WorldRectangle& rect) noexcept { m_stBoundary = rect; }
 
+        /**
+         * 是否并行构建默认渲染对象的绘制数据
+         */
+        bool IsParallelRenderEnabled() const noexcept { return m_bParallelRenderEnabled; }
+
+        /**
+         * 设置是否并行构建默认渲染对象的绘制数据
+         * 开启后，Render 中连续的默认渲染对象会在工作线程上完成顶点变换，再按渲染顺序提交到命令缓冲区。
+         * 定义了 OnRender 的对象作为串行屏障，绘制结果与关闭时一致。
+         * @param enabled 是否开启
+         */
+        void SetParallelRenderEnabled(bool enabled) noexcept { m_bParallelRenderEnabled = enabled; }
+
         /**
          * 在 Lua 栈上创建实例
          * 在 classIndex + 1 到栈顶元素被作为参数传递给 OnInit 方法
@@ -152,6 +196,62 @@ namespace lstg::v2::GamePlay
          */
         void Clear() noexcept;
 
+        /**
+         * 批量查询对象
+         * 只选中状态为 normal 的对象，结果保存在世界中供后续的批量操作使用，再次查询时覆盖。
+         * @param query 查询条件
+         * @return 选中的对象数量
+         */
+        size_t QueryEntities(const EntityQuery& query) noexcept;
+
+        /**
+         * 将查询结果作为数组压入栈
+         * 已经被回收的对象会被跳过。
+         * [-0, +1]
+         * @param stack Lua 栈
+         */
+        void PushQueryResult(Subsystem::Script::LuaStack stack) noexcept;
+
+        /**
+         * 设置查询结果中所有对象的速度
+         * @param velocity 速度
+         * @param rotation 若有值，同时设置朝向
+         */
+        void BatchSetVelocity(Vec2 velocity, std::optional<double> rotation) noexcept;
+
+        /**
+         * 向查询结果中的对象施加径向冲量
+         * 冲量沿 (对象中心 - center) 方向叠加到速度上，半径大于 0 时线性衰减且半径外的对象不受影响。
+         * @param center 中心
+         * @param strength 强度
+         * @param radius 作用半径，不大于 0 时不衰减
+         */
+        void BatchApplyRadialImpulse(Vec2 center, double strength, double radius) noexcept;
+
+        /**
+         * 修改查询结果中所有对象的碰撞组
+         * @param group 碰撞组
+         */
+        void BatchSetGroup(uint32_t group) noexcept;
+
+        /**
+         * 删除查询结果中的所有对象
+         * 回调中再次发起的查询不影响本次操作。
+         * @param stack Lua 栈
+         * @param callback 是否调用 OnDelete
+         * @return 删除的对象数量
+         */
+        size_t BatchDelete(Subsystem::Script::LuaStack stack, bool callback) noexcept;
+
+        /**
+         * 击杀查询结果中的所有对象
+         * 回调中再次发起的查询不影响本次操作。
+         * @param stack Lua 栈
+         * @param callback 是否调用 OnKill
+         * @return 击杀的对象数量
+         */
+        size_t BatchKill(Subsystem::Script::LuaStack stack, bool callback) noexcept;
+
     public:
         /**
          * 框架内部的 Update 方法
@@ -160,6 +260,38 @@ namespace lstg::v2::GamePlay
          */
         void Update(double elapsedTime) noexcept;
 
+    private:
+        /**
+         * 提交所有积攒的默认渲染对象
+         */
+        void FlushPendingDefaultRenderEntities() noexcept;
+
+        /**
+         * 修改碰撞组并维护组链表
+         */
+        void SetColliderGroup(Components::Collider& collider, uint32_t group) noexcept;
+
+        /**
+         * 将渲染组件插入渲染链表
+         * 优先使用图层尾部缓存直接追加，缓存失效时退化为跳表查找。
+         */
+        void InsertRenderer(Components::Renderer& renderer) noexcept;
+
+        /**
+         * 修改渲染层并维护渲染链表
+         */
+        void SetRendererLayer(Components::Renderer& renderer, double layer) noexcept;
+
+        /**
+         * 解析查询结果中的对象，对象已被回收或 ID 被复用时返回空
+         */
+        std::optional<ECS::Entity> ResolveQueryResult(ScriptObjectId scriptId, ECS::EntityId entityId) noexcept;
+
+        /**
+         * 批量删除或击杀
+         */
+        size_t BatchDispose(Subsystem::Script::LuaStack stack, bool kill, bool callback) noexcept;
+
     protected:  // IScriptObjectBridge
         int OnGetAttribute(Subsystem::Script::LuaStack stack, ECS::EntityId id, std::string_view key) override;
         bool OnSetAttribute(Subsystem::Script::LuaStack stack, ECS::EntityId id, std::string_view key,
@@ -169,6 +301,7 @@ namespace lstg::v2::GamePlay
         GameApp& m_stApp;
         ECS::World m_stWorld;
         ScriptObjectPool m_stScriptObjectPool;
+        uint64_t m_ullEntitySequence = 0;
 
         // 世界属性
         WorldRectangle m_stBoundary;
@@ -185,5 +318,31 @@ namespace lstg::v2::GamePlay
         //  level1:  2500
         //  level2:   625
         SkipListDepthRandomizer<3, 4> m_stSkipListRandomizer;
+
+        // 图层尾部缓存
+        // 记录每个图层最后一个对象，新对象的创建序号最大，总是追加在图层末尾，借此跳过跳表查找。
+        // 深度须与 Components::kRendererSkipListNodeDepth 一致。
+        IntrusiveSkipListTailCache<3, double, ECS::EntityId> m_stRendererLayerTails;
+
+        // 并行渲染
+        struct PreparedRenderItem
+        {
+            const Subsystem::Render::Drawing2D::Sprite* Sprite = nullptr;  // 为空时在提交阶段调用 RenderEntityDefault
+            Subsystem::Render::Drawing2D::PreparedSpriteDrawing Drawing;
+        };
+
+        bool m_bParallelRenderEnabled = false;
+        std::unique_ptr<ForkJoinPool<>> m_pRenderWorkers;  // 延迟创建
+        std::vector<ECS::Entity> m_stPendingRenderEntities;
+        std::vector<PreparedRenderItem> m_stPreparedRenderItems;
+
+        // 批量查询结果
+        struct QueryResultItem
+        {
+            ScriptObjectId ScriptId = 0;
+            ECS::EntityId EntityId = 0;
+        };
+
+        std::vector<QueryResultItem> m_stQueryResult;
     };
 }
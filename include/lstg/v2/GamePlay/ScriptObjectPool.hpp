@@ -5,8 +5,12 @@
  * 此文件为 LuaSTGPlus 项目的一部分，版权与许可声明详见 COPYRIGHT.txt。
  */
 #pragma once
+#include <array>
+#include <limits>
+#include <memory>
 #include <optional>
 #include <unordered_map>
+#include <vector>
 #include <lstg/Core/Subsystem/Script/LuaState.hpp>
 #include <lstg/Core/Subsystem/Script/LuaReference.hpp>
 #include <lstg/Core/ECS/Entity.hpp>
@@ -26,6 +30,8 @@ namespace lstg::v2::GamePlay
         OnKill = 6,
     };
 
+    static constexpr size_t kScriptCallbackFunctionCount = 6;
+
     const char* ToString(ScriptCallbackFunctions functions) noexcept;
 
     /**
@@ -73,6 +79,9 @@ namespace lstg::v2::GamePlay
 
     /**
      * 脚本对象池
+     *
+     * ScriptObjectId 由槽位下标与代数构成，对象信息存放在按槽位索引的连续数组中，释放后代数递增，使旧 ID 失效。
+     * 开启对象表回收后，释放的对象表会被清空并缓存，供后续分配复用，以减少 Lua 侧的分配和 GC 压力。
      */
     class ScriptObjectPool
     {
@@ -103,6 +112,21 @@ namespace lstg::v2::GamePlay
          */
         size_t GetCurrentObjects() const noexcept { return m_uCurrentObjects; }
 
+        /**
+         * 是否回收对象表
+         */
+        bool IsTableRecyclingEnabled() const noexcept { return m_bTableRecycling; }
+
+        /**
+         * 设置是否回收对象表
+         * 开启后，脚本不应在对象释放后继续持有对象表：对象表可能已经被分配给新的对象。
+         * 关闭时丢弃已经缓存的对象表。
+         * [-0, +0]
+         * @param stack Lua栈
+         * @param enabled 是否开启
+         */
+        void SetTableRecyclingEnabled(Subsystem::Script::LuaStack stack, bool enabled) noexcept;
+
         /**
          * 申请对象
          * [-0, +1]
@@ -140,6 +164,27 @@ namespace lstg::v2::GamePlay
         ScriptCallbackInvokeResult InvokeCallback(Subsystem::Script::LuaStack stack, ScriptObjectId scriptId, ScriptCallbackFunctions callback,
             unsigned args) noexcept;
 
+        /**
+         * 检查回调函数是否被定义
+         * 仅当对象与类均有效且类上不存在对应字段时返回 false，此时 InvokeCallback 必然返回 CallbackNotDefined。
+         * 基于类的分派缓存判断，不访问 Lua 栈，缓存在每次批量调用开始时与类表同步。
+         * @param scriptId 脚本侧对象ID
+         * @param callback 回调方法
+         */
+        bool IsCallbackDefined(ScriptObjectId scriptId, ScriptCallbackFunctions callback) const noexcept;
+
+        /**
+         * 设置对象的类
+         * 对象的类只能经由此方法修改，以便更新分派缓存。
+         * [-0, +0]
+         * @param stack Lua栈
+         * @param scriptId 脚本侧对象ID
+         * @param classIndex 类在栈上的索引
+         * @return 对象是否存在
+         */
+        bool SetScriptObjectClass(Subsystem::Script::LuaStack stack, ScriptObjectId scriptId,
+            Subsystem::Script::LuaStack::AbsIndex classIndex) noexcept;
+
         /**
          * 获取对象实例ID
          * @param scriptObjectId 脚本对象ID
@@ -148,6 +193,59 @@ namespace lstg::v2::GamePlay
         std::optional<ECS::EntityId> GetEntityId(ScriptObjectId scriptObjectId) noexcept;
 
     private:
+        /**
+         * 类分派表
+         * 持有类上各回调方法的引用。
+         */
+        struct ClassDispatchTable
+        {
+            const void* Key = nullptr;
+            Subsystem::Script::LuaReference ClassRef;
+            std::array<Subsystem::Script::LuaReference, kScriptCallbackFunctionCount> Callbacks;
+            std::array<const void*, kScriptCallbackFunctionCount> CallbackIdentities {};  // 用于检测类上的字段是否被替换
+            uint8_t DefinedMask = 0;  // 字段非 nil
+            uint8_t FunctionMask = 0;  // 字段为函数
+            size_t BindingObjects = 0;
+        };
+
+        using ClassDispatchTablePtr = std::unique_ptr<ClassDispatchTable>;
+
+        struct ScriptObjectInfo
+        {
+            ECS::EntityId EntityId;
+            ClassDispatchTable* Class = nullptr;  // 类不是 table 时为空
+            uint16_t Generation = 1;
+            bool Used = false;
+            uint32_t NextFree = 0;  // 空闲链表
+        };
+
+        static constexpr uint32_t kSlotBits = 16;
+        static constexpr uint32_t kSlotMask = (1u << kSlotBits) - 1;
+        static constexpr uint16_t kMaxGeneration = 0x7FFF;  // 保证 ID 可以无损转换到 int
+        static constexpr uint32_t kInvalidSlot = std::numeric_limits<uint32_t>::max();
+
+        static ScriptObjectId MakeScriptObjectId(uint32_t slot, uint16_t generation) noexcept
+        {
+            return (static_cast<ScriptObjectId>(generation) << kSlotBits) | slot;
+        }
+
+        static int GetObjectTableIndex(ScriptObjectId scriptId) noexcept
+        {
+            return static_cast<int>(scriptId & kSlotMask) + 1;
+        }
+
+        ScriptObjectInfo* FindObject(ScriptObjectId scriptId) noexcept;
+        const ScriptObjectInfo* FindObject(ScriptObjectId scriptId) const noexcept;
+
+        ClassDispatchTable* AcquireClassDispatchTable(Subsystem::Script::LuaStack stack,
+            Subsystem::Script::LuaStack::AbsIndex classIndex) noexcept;
+        void ReleaseClassDispatchTable(ClassDispatchTable* table) noexcept;
+        void SyncClassDispatchTable(Subsystem::Script::LuaStack stack, ClassDispatchTable& table) noexcept;
+        void UpdateCallbackSlot(Subsystem::Script::LuaStack stack, ClassDispatchTable& table, unsigned slot) noexcept;
+
+    private:
+        friend class ScriptCallbackBatch;
+
         Subsystem::Script::LuaState& m_stState;
         IScriptObjectBridge* m_pBridge = nullptr;
 
@@ -155,9 +253,52 @@ namespace lstg::v2::GamePlay
         Subsystem::Script::LuaReference m_stObjectMetaTableRef;
 
         // 由于 luajit 不能存储 int64_t，我们需要中间表进行转换
-        std::unordered_map<ScriptObjectId, ECS::EntityId> m_stEntityIdMapping;
+        // 按槽位索引，空闲槽位按先进先出复用，使同一槽位的代数增长尽量缓慢
+        std::vector<ScriptObjectInfo> m_stObjectInfos;
+        uint32_t m_uFreeSlotHead = kInvalidSlot;
+        uint32_t m_uFreeSlotTail = kInvalidSlot;
+
+        // 回收的对象表
+        bool m_bTableRecycling = false;
+        Subsystem::Script::LuaReference m_stRecycledTableRef;
+        int m_iRecycledTables = 0;
+
+        // 类表地址 -> 分派表，分派表持有类的引用，地址在此期间不会被复用
+        std::unordered_map<const void*, ClassDispatchTablePtr> m_stClassDispatchTables;
 
-        ScriptObjectId m_uNextObjectId = 1;
         size_t m_uCurrentObjects = 0;
     };
+
+    /**
+     * 批量回调调用
+     * 构造时同步所有类的分派缓存，并在主线程栈上压入错误处理函数与对象表，每次调用只需要压入回调与对象。
+     * 类上未定义对应回调时直接返回，不访问 Lua 栈。
+     * 存续期间栈上保留两个元素，调用方需要保证栈平衡；回调中对类字段的修改在下一次批量调用时生效。
+     */
+    class ScriptCallbackBatch
+    {
+    public:
+        /**
+         * 开始批量调用
+         * @param pool 脚本对象池
+         * @param callback 回调方法，只支持无参数的回调
+         */
+        ScriptCallbackBatch(ScriptObjectPool& pool, ScriptCallbackFunctions callback) noexcept;
+        ScriptCallbackBatch(const ScriptCallbackBatch&) = delete;
+        ~ScriptCallbackBatch();
+
+    public:
+        /**
+         * 调用对象上的回调
+         * @param scriptId 脚本侧对象ID
+         * @return 调用结果
+         */
+        ScriptCallbackInvokeResult Invoke(ScriptObjectId scriptId) noexcept;
+
+    private:
+        ScriptObjectPool& m_stPool;
+        ScriptCallbackFunctions m_iCallback;
+        Subsystem::Script::LuaStack m_stStack;
+        int m_iBase = 0;  // 错误处理函数的位置，对象表位于其后
+    };
 }
@@ -0,0 +1,78 @@
+/**
+ * @file
+ * @date 2022/10/4
+ * @author 9chu
+ * 此文件为 LuaSTGPlus 项目的一部分，版权与许可声明详见 COPYRIGHT.txt。
+ */
+#include "Benchmark.hpp"
+
+#include <cstring>
+#include <vector>
+
+using namespace std;
+using namespace lstg;
+using namespace lstg::Benchmark;
+
+namespace
+{
+    struct BenchmarkEntry
+    {
+        const char* Name;
+        BenchmarkFunction Function;
+    };
+
+    vector<BenchmarkEntry>& GetRegistry()
+    {
+        static vector<BenchmarkEntry> s_stRegistry;
+        return s_stRegistry;
+    }
+}
+
+const void* volatile lstg::Benchmark::g_pDoNotOptimizeSink = nullptr;
+
+Registrar::Registrar(const char* name, BenchmarkFunction func) noexcept
+{
+    GetRegistry().push_back({ name, func });
+}
+
+/**
+ * 用法：LuaSTGPlusBenchmark [--quick] [过滤子串...]
+ */
+int main(int argc, char** argv)
+{
+    bool quick = false;
+    vector<string_view> filters;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (::strcmp(argv[i], "--quick") == 0)
+            quick = true;
+        else
+            filters.emplace_back(argv[i]);
+    }
+
+    Runner runner(quick);
+    size_t count = 0;
+    for (const auto& entry : GetRegistry())
+    {
+        string_view name(entry.Name);
+        if (!filters.empty())
+        {
+            bool match = false;
+            for (auto f : filters)
+                match |= (name.find(f) != string_view::npos);
+            if (!match)
+                continue;
+        }
+
+        fmt::print("[{}]\n", name);
+        entry.Function(runner);
+        ++count;
+    }
+
+    if (count == 0)
+    {
+        fmt::print(stderr, "No benchmark matched\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,126 @@
+/**
+ * @file
+ * @date 2022/10/4
+ * @author 9chu
+ * 此文件为 LuaSTGPlus 项目的一部分，版权与许可声明详见 COPYRIGHT.txt。
+ */
+#pragma once
+#include <cstdint>
+#include <algorithm>
+#include <cstdlib>
+#include <chrono>
+#include <string_view>
+#include <utility>
+#include <fmt/format.h>
+
+namespace lstg::Benchmark
+{
+    extern const void* volatile g_pDoNotOptimizeSink;  // 供 DoNotOptimize 写入
+
+    /**
+     * 阻止编译器优化掉计算结果
+     * @param p 结果地址
+     */
+    inline void DoNotOptimize(const void* p) noexcept
+    {
+        g_pDoNotOptimizeSink = p;
+    }
+
+    /**
+     * 检查条件，失败时终止程序
+     * 基准同时承担正确性检查，结果不对时测得的时间没有意义。
+     */
+    [[noreturn]] inline void Fail(std::string_view what) noexcept
+    {
+        fmt::print(stderr, "FAILED: {}\n", what);
+        ::abort();
+    }
+
+#define LSTG_BENCHMARK_CHECK(...) \
+    do { if (!(__VA_ARGS__)) ::lstg::Benchmark::Fail(#__VA_ARGS__); } while (false)
+
+    /**
+     * 计时器
+     */
+    class Runner
+    {
+    public:
+        Runner(bool quick) noexcept
+            : m_bQuick(quick) {}
+
+    public:
+        /**
+         * 是否为快速模式
+         * 快速模式下迭代次数缩减为 1/100，只用于检查基准能够正常运行。
+         */
+        [[nodiscard]] bool IsQuick() const noexcept { return m_bQuick; }
+
+        /**
+         * 执行并输出耗时
+         * 先以 1/10 的次数预热，再计时执行。
+         * @param label 名称
+         * @param iterations 迭代次数
+         * @param func 单次迭代
+         * @param bytesPerIteration 每次迭代处理的字节数，非零时额外输出吞吐量
+         */
+        template <typename TFunc>
+        double Measure(std::string_view label, size_t iterations, TFunc&& func, size_t bytesPerIteration = 0)
+        {
+            if (m_bQuick)
+                iterations = std::max<size_t>(iterations / 100, 1);
+
+            for (size_t i = 0; i < iterations / 10; ++i)
+                func();
+
+            auto begin = std::chrono::steady_clock::now();
+            for (size_t i = 0; i < iterations; ++i)
+                func();
+            auto end = std::chrono::steady_clock::now();
+
+            auto seconds = std::chrono::duration<double>(end - begin).count();
+            auto nsPerIteration = seconds * 1e9 / static_cast<double>(iterations);
+            if (bytesPerIteration)
+            {
+                auto mbPerSecond = static_cast<double>(bytesPerIteration) * static_cast<double>(iterations) / seconds / (1024. * 1024.);
+                fmt::print("  {:<48} {:>12.1f} ns/op {:>10.1f} MB/s\n", label, nsPerIteration, mbPerSecond);
+            }
+            else
+            {
+                fmt::print("  {:<48} {:>12.1f} ns/op\n", label, nsPerIteration);
+            }
+            return nsPerIteration;
+        }
+
+        /**
+         * 输出自定义的结果
+         */
+        template <typename... TArgs>
+        void Report(std::string_view label, const char* fmt, TArgs&&... args)
+        {
+            fmt::print("  {:<48} {}\n", label, fmt::format(fmt, std::forward<TArgs>(args)...));
+        }
+
+    private:
+        bool m_bQuick = false;
+    };
+
+    using BenchmarkFunction = void(*)(Runner&);
+
+    /**
+     * 注册基准
+     */
+    class Registrar
+    {
+    public:
+        Registrar(const char* name, BenchmarkFunction func) noexcept;
+    };
+}
+
+/**
+ * 定义基准
+ * @param NAME 名称，可以在命令行中按子串过滤
+ */
+#define LSTG_BENCHMARK(NAME) \
+    static void Benchmark##NAME(::lstg::Benchmark::Runner& runner); \
+    static ::lstg::Benchmark::Registrar kBenchmarkRegistrar##NAME(#NAME, Benchmark##NAME); \
+    static void Benchmark##NAME(::lstg::Benchmark::Runner& runner)
@@ -0,0 +1,150 @@
+/**
+ * @file
+ * @date 2022/10/4
+ * @author 9chu
+ * 此文件为 LuaSTGPlus 项目的一部分，版权与许可声明详见 COPYRIGHT.txt。
+ */
+#include "Benchmark.hpp"
+
+#include <lstg/Core/Subsystem/Script/LuaPush.hpp>
+#include <lstg/Core/Subsystem/Script/LuaState.hpp>
+#include <lstg/Core/Subsystem/Script/GarbageCollector.hpp>
+
+using namespace std;
+using namespace lstg;
+using namespace lstg::Subsystem::Script;
+
+namespace
+{
+    /**
+     * 每帧分配大量短命对象，同时保留一个固定大小的存活集合
+     */
+    const char* kStressScript = R"lua(
+        local keep, cursor = {}, 0
+        function frame(n)
+            for i = 1, n do
+                cursor = cursor % 20000 + 1
+                keep[cursor] = { i, i * 2, tostring(i) }
+            end
+        end
+    )lua";
+
+    const double kFrameTime = 1. / 60.;
+
+    struct StressResult
+    {
+        double MaxFrameTime = 0.;  // 脚本执行耗时，包含分配点上触发的回收
+        double MaxGcTime = 0.;  // 帧间回收耗时
+        double TotalGcTime = 0.;
+        int MaxHeapKb = 0;
+    };
+
+    /**
+     * 模拟游戏循环
+     * @param state 虚拟机
+     * @param gc 调度器，为空时只依赖分配触发的回收
+     * @param frames 帧数
+     * @param allocationsPerFrame 每帧分配的对象数
+     */
+    StressResult RunFrames(LuaState& state, GarbageCollector* gc, size_t frames, int allocationsPerFrame)
+    {
+        StressResult ret;
+        double idleTime = 0.;
+        for (size_t i = 0; i < frames; ++i)
+        {
+            auto start = chrono::steady_clock::now();
+            state.GetGlobal("frame");
+            state.PushValue(allocationsPerFrame);
+            LSTG_BENCHMARK_CHECK(state.ProtectedCall(1, 0));
+            auto frameTime = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+            ret.MaxFrameTime = std::max(ret.MaxFrameTime, frameTime);
+
+            if (gc)
+            {
+                auto gcTime = gc->Update(idleTime);
+                ret.MaxGcTime = std::max(ret.MaxGcTime, gcTime);
+                ret.TotalGcTime += gcTime;
+                frameTime += gcTime;
+            }
+            idleTime = std::max(0., kFrameTime - frameTime);
+            ret.MaxHeapKb = std::max(ret.MaxHeapKb, lua_gc(state, LUA_GCCOUNT, 0));
+        }
+        return ret;
+    }
+
+    void PrepareState(LuaState& state)
+    {
+        state.OpenStandardLibrary();
+        LSTG_BENCHMARK_CHECK(state.LoadString(kStressScript));
+        LSTG_BENCHMARK_CHECK(state.ProtectedCall(0, 0));
+    }
+
+    void Report(Benchmark::Runner& runner, string_view label, const StressResult& result, size_t frames)
+    {
+        runner.Report(label, "max frame {:.3f} ms, max gc {:.3f} ms, avg gc {:.3f} ms, max heap {} KB",
+            result.MaxFrameTime * 1000., result.MaxGcTime * 1000., result.TotalGcTime * 1000. / static_cast<double>(frames),
+            result.MaxHeapKb);
+    }
+}
+
+/**
+ * 高分配压力下的 GC 调度
+ * 检查堆大小保持有界，且暂停 GC 后恢复时分配触发的回收能够重新生效。
+ */
+LSTG_BENCHMARK(GarbageCollectorStress)
+{
+    const size_t frames = runner.IsQuick() ? 60 : 1200;
+    const int allocationsPerFrame = 20000;
+
+    // 基线：只依赖分配触发的增量回收
+    int baselineHeapKb = 0;
+    {
+        LuaState state;
+        PrepareState(state);
+        auto result = RunFrames(state, nullptr, frames, allocationsPerFrame);
+        Report(runner, "allocation-triggered only", result, frames);
+        baselineHeapKb = result.MaxHeapKb;
+    }
+
+    // 帧间按预算推进
+    {
+        LuaState state;
+        GarbageCollector gc(state);
+        PrepareState(state);
+        auto result = RunFrames(state, &gc, frames, allocationsPerFrame);
+        Report(runner, "idle-time budget", result, frames);
+
+        // 自动回收依然开启，堆大小与基线处于同一量级
+        LSTG_BENCHMARK_CHECK(result.MaxHeapKb <= baselineHeapKb * 2);
+    }
+
+    // 预算为零时只剩分配触发的回收，堆依然有界
+    {
+        LuaState state;
+        GarbageCollector gc(state);
+        gc.SetBudget(0., 0., 0.);
+        PrepareState(state);
+        auto result = RunFrames(state, &gc, frames, allocationsPerFrame);
+        Report(runner, "zero budget", result, frames);
+        LSTG_BENCHMARK_CHECK(result.MaxHeapKb <= baselineHeapKb * 2);
+    }
+
+    // 暂停期间堆持续增长，恢复后回收重新生效
+    {
+        LuaState state;
+        GarbageCollector gc(state);
+        PrepareState(state);
+        RunFrames(state, &gc, 10, allocationsPerFrame);
+
+        gc.Suspend();
+        auto suspended = RunFrames(state, &gc, 10, allocationsPerFrame);
+        LSTG_BENCHMARK_CHECK(suspended.TotalGcTime == 0.);
+        gc.Resume();
+        LSTG_BENCHMARK_CHECK(!gc.IsSuspended());
+
+        RunFrames(state, &gc, frames, allocationsPerFrame);
+        auto heapKb = lua_gc(state, LUA_GCCOUNT, 0);
+        runner.Report("heap after suspend/resume", "{} KB (peak while suspended {} KB)", heapKb, suspended.MaxHeapKb);
+        LSTG_BENCHMARK_CHECK(heapKb <= std::max(suspended.MaxHeapKb, baselineHeapKb * 2));
+    }
+}
@@ -0,0 +1,171 @@
+/**
+ * @file
+ * @date 2022/10/4
+ * @author 9chu
+ * 此文件为 LuaSTGPlus 项目的一部分，版权与许可声明详见 COPYRIGHT.txt。
+ */
+#include "Benchmark.hpp"
+
+#include <cmath>
+#include <algorithm>
+#include <lstg/Core/Subsystem/Script/LuaPush.hpp>
+#include <lstg/Core/Subsystem/Script/LuaRead.hpp>
+#include <lstg/Core/Subsystem/Script/LuaState.hpp>
+
+using namespace std;
+using namespace lstg;
+using namespace lstg::Subsystem::Script;
+
+namespace
+{
+    /**
+     * 与桥接模块中常见的签名一致：必选数字参数加上可选参数
+     */
+    double Transform(double value, std::optional<double> scale, std::optional<bool> negate)
+    {
+        auto ret = value * scale.value_or(1.);
+        return negate.value_or(false) ? -ret : ret;
+    }
+
+    double Select(double value, std::variant<double, LuaStack::AbsIndex> other)
+    {
+        if (other.index() == 0)
+            return value + std::get<0>(other);
+        return value;
+    }
+
+    /**
+     * 原生 C 函数，与 GameObjectModule::GetAttr 等方法一致：自行读取参数，返回值为结果个数
+     */
+    int RawMinMax(lua_State* L)
+    {
+        auto a = luaL_checknumber(L, 1);
+        auto b = luaL_checknumber(L, 2);
+        lua_pushnumber(L, std::min(a, b));
+        lua_pushnumber(L, std::max(a, b));
+        return 2;
+    }
+
+    /**
+     * 在 Lua 中循环调用 f，返回结果之和
+     */
+    const char* kCallLoopScript = R"lua(
+        local f, g, n = ...
+        local sum = 0
+        for i = 1, n do
+            sum = sum + f(i, 0.5, i % 2 == 0) + f(i) + g(i, 1) + g(i, "x")
+        end
+        return sum
+    )lua";
+
+    const int kCallsPerIteration = 1000;
+
+    double RunCallLoop(LuaState& state, int loopRef)
+    {
+        lua_rawgeti(state, LUA_REGISTRYINDEX, loopRef);
+        lua_getglobal(state, "f");
+        lua_getglobal(state, "g");
+        lua_pushinteger(state, kCallsPerIteration);
+        LSTG_BENCHMARK_CHECK(state.ProtectedCall(3, 1));
+        auto ret = lua_tonumber(state, -1);
+        lua_pop(state, 1);
+        return ret;
+    }
+}
+
+/**
+ * 编译期绑定与运行期函数指针绑定的调用开销对比
+ */
+LSTG_BENCHMARK(LuaModuleCall)
+{
+    static const size_t kIterations = 2000;
+
+    LuaState state;
+    state.OpenStandardLibrary();
+    LSTG_BENCHMARK_CHECK(state.LoadString(kCallLoopScript));
+    auto loopRef = luaL_ref(state, LUA_REGISTRYINDEX);
+
+    // 运行期绑定：函数指针存放于上值
+    state.PushValue(&Transform);
+    lua_setglobal(state, "f");
+    state.PushValue(&Select);
+    lua_setglobal(state, "g");
+    auto dynamicResult = RunCallLoop(state, loopRef);
+    runner.Measure("dynamic binding", kIterations, [&]() {
+        Benchmark::DoNotOptimize(&(dynamicResult = RunCallLoop(state, loopRef)));
+    });
+
+    // 编译期绑定
+    state.PushValue(StaticFunction<&Transform>{});
+    lua_setglobal(state, "f");
+    state.PushValue(StaticFunction<&Select>{});
+    lua_setglobal(state, "g");
+    auto staticResult = RunCallLoop(state, loopRef);
+    runner.Measure("static binding", kIterations, [&]() {
+        Benchmark::DoNotOptimize(&(staticResult = RunCallLoop(state, loopRef)));
+    });
+
+    // 两种绑定的参数解码结果必须一致
+    LSTG_BENCHMARK_CHECK(std::abs(dynamicResult - staticResult) < 1e-6);
+    runner.Report("calls per iteration", "{}", kCallsPerIteration * 4);
+
+    luaL_unref(state, LUA_REGISTRYINDEX, loopRef);
+}
+
+/**
+ * 原生 lua_CFunction 经 StaticFunction 推入时应保持原样，不经过参数解码
+ */
+LSTG_BENCHMARK(LuaModuleRawCall)
+{
+    static const size_t kIterations = 2000;
+
+    static const char* kRawCallLoopScript = R"lua(
+        local f, n = ...
+        local sum = 0
+        for i = 1, n do
+            local lo, hi = f(i, n - i)
+            sum = sum + lo * 2 + hi
+        end
+        return sum
+    )lua";
+
+    LuaState state;
+    state.OpenStandardLibrary();
+    LSTG_BENCHMARK_CHECK(state.LoadString(kRawCallLoopScript));
+    auto loopRef = luaL_ref(state, LUA_REGISTRYINDEX);
+
+    auto run = [&]() {
+        lua_rawgeti(state, LUA_REGISTRYINDEX, loopRef);
+        lua_getglobal(state, "f");
+        lua_pushinteger(state, kCallsPerIteration);
+        LSTG_BENCHMARK_CHECK(state.ProtectedCall(2, 1));
+        auto ret = lua_tonumber(state, -1);
+        lua_pop(state, 1);
+        return ret;
+    };
+
+    // 期望值：按定义直接计算
+    double expected = 0;
+    for (int i = 1; i <= kCallsPerIteration; ++i)
+        expected += std::min(i, kCallsPerIteration - i) * 2 + std::max(i, kCallsPerIteration - i);
+
+    state.PushValue(&RawMinMax);
+    lua_setglobal(state, "f");
+    auto plainResult = run();
+    runner.Measure("plain lua_CFunction", kIterations, [&]() {
+        Benchmark::DoNotOptimize(&(plainResult = run()));
+    });
+
+    state.PushValue(StaticFunction<&RawMinMax>{});
+    lua_setglobal(state, "f");
+    auto staticResult = run();
+    runner.Measure("StaticFunction<lua_CFunction>", kIterations, [&]() {
+        Benchmark::DoNotOptimize(&(staticResult = run()));
+    });
+
+    // 两个返回值都必须按原样传回 Lua
+    LSTG_BENCHMARK_CHECK(std::abs(plainResult - expected) < 1e-6);
+    LSTG_BENCHMARK_CHECK(std::abs(staticResult - expected) < 1e-6);
+
+    luaL_unref(state, LUA_REGISTRYINDEX, loopRef);
+}
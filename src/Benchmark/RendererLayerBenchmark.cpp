@@ -0,0 +1,264 @@
+/**
+ * @file
+ * @date 2022/10/4
+ * @author 9chu
+ * 此文件为 LuaSTGPlus 项目的一部分，版权与许可声明详见 COPYRIGHT.txt。
+ */
+#include "Benchmark.hpp"
+
+#include <memory>
+#include <random>
+#include <vector>
+#include <lstg/Core/IntrusiveSkipList.hpp>
+#include <lstg/Core/IntrusiveSkipListTailCache.hpp>
+
+using namespace std;
+using namespace lstg;
+
+namespace
+{
+    const size_t kDepth = 3;
+    const size_t kObjectCount = 20000;
+    const size_t kChurnPerFrame = 2000;  // 每帧销毁并重新创建的对象数
+    const size_t kLayerWritesPerFrame = 2000;  // 每帧修改图层的对象数
+    const double kLayers[] = { -700, -600, -500, -400, -300, -200, -100, 0, 100 };
+
+    /**
+     * 与 GameWorld 中的 Renderer 组件对应
+     */
+    struct RendererNode
+    {
+        IntrusiveSkipListNode<kDepth> SkipListNode;
+        double Layer = 0.;
+        uint64_t Sequence = 0;
+        uint32_t Index = 0;
+
+        static RendererNode* FromSkipListNode(IntrusiveSkipListNode<kDepth>* n) noexcept
+        {
+            return reinterpret_cast<RendererNode*>(n);
+        }
+
+        RendererNode* PrevNode() noexcept { return FromSkipListNode(SkipListNode.Adj[0].Prev); }
+        RendererNode* NextNode() noexcept { return FromSkipListNode(SkipListNode.Adj[0].Next); }
+    };
+
+    bool RendererSortFunction(IntrusiveSkipListNode<kDepth>* lhs, IntrusiveSkipListNode<kDepth>* rhs) noexcept
+    {
+        auto left = RendererNode::FromSkipListNode(lhs);
+        auto right = RendererNode::FromSkipListNode(rhs);
+        if (left->Layer < right->Layer)
+            return true;
+        if (left->Layer == right->Layer)
+            return left->Sequence < right->Sequence;
+        return false;
+    }
+
+    /**
+     * 渲染跳表
+     * 不使用缓存时对应 GameWorld 引入图层尾部缓存之前的实现，使用缓存时与 GameWorld 调用同一个 IntrusiveSkipListTailCache。
+     */
+    class RendererList
+    {
+    public:
+        /**
+         * 与 GameWorld 一致，以句柄而非指针缓存节点，这里以节点下标作为句柄
+         */
+        struct Accessor
+        {
+            const vector<unique_ptr<RendererNode>>& Nodes;
+
+            double GetKey(IntrusiveSkipListNode<kDepth>* n) const noexcept
+            {
+                return RendererNode::FromSkipListNode(n)->Layer;
+            }
+
+            uint32_t GetHandle(IntrusiveSkipListNode<kDepth>* n) const noexcept
+            {
+                return RendererNode::FromSkipListNode(n)->Index;
+            }
+
+            IntrusiveSkipListNode<kDepth>* Resolve(uint32_t index) const noexcept
+            {
+                return index < Nodes.size() ? &Nodes[index]->SkipListNode : nullptr;
+            }
+        };
+
+    public:
+        RendererList(const vector<unique_ptr<RendererNode>>& nodes, bool useTailCache)
+            : m_stNodes(nodes), m_bUseTailCache(useTailCache)
+        {
+            for (size_t i = 0; i < kDepth; ++i)
+            {
+                m_stHeader.SkipListNode.Adj[i].Next = &m_stTailer.SkipListNode;
+                m_stTailer.SkipListNode.Adj[i].Prev = &m_stHeader.SkipListNode;
+            }
+        }
+
+    public:
+        void Insert(RendererNode& node) noexcept
+        {
+            if (m_bUseTailCache)
+            {
+                m_stLayerTails.Insert(&m_stTailer.SkipListNode, &node.SkipListNode, Accessor { m_stNodes }, RendererSortFunction,
+                    m_stRandomizer);
+            }
+            else
+            {
+                SkipListInsert(&m_stTailer.SkipListNode, &node.SkipListNode, RendererSortFunction, m_stRandomizer);
+            }
+        }
+
+        void Remove(RendererNode& node) noexcept
+        {
+            SkipListRemove(&node.SkipListNode);
+        }
+
+        void SetLayer(RendererNode& node, double layer) noexcept
+        {
+            if (!m_bUseTailCache)
+            {
+                Remove(node);
+                node.Layer = layer;
+                Insert(node);
+                return;
+            }
+
+            // 与 GameWorld::SetRendererLayer 一致
+            if (layer == node.Layer)
+                return;
+            node.Layer = layer;
+            m_stLayerTails.Reorder(&m_stHeader.SkipListNode, &m_stTailer.SkipListNode, &node.SkipListNode, Accessor { m_stNodes },
+                RendererSortFunction, m_stRandomizer);
+        }
+
+        /**
+         * 按顺序输出 (Layer, Sequence)，同时检查每一层链表的连接与顺序
+         */
+        bool Collect(vector<pair<double, uint64_t>>& out) noexcept
+        {
+            out.clear();
+            for (size_t d = 0; d < kDepth; ++d)
+            {
+                auto prev = &m_stHeader.SkipListNode;
+                auto p = prev->Adj[d].Next;
+                while (p != &m_stTailer.SkipListNode)
+                {
+                    if (p->Adj[d].Prev != prev)
+                        return false;
+                    if (prev != &m_stHeader.SkipListNode && !RendererSortFunction(prev, p))
+                        return false;
+                    if (d == 0)
+                        out.emplace_back(RendererNode::FromSkipListNode(p)->Layer, RendererNode::FromSkipListNode(p)->Sequence);
+                    prev = p;
+                    p = p->Adj[d].Next;
+                }
+            }
+            return true;
+        }
+
+    private:
+        const vector<unique_ptr<RendererNode>>& m_stNodes;
+        bool m_bUseTailCache = false;
+        RendererNode m_stHeader;
+        RendererNode m_stTailer;
+        SkipListDepthRandomizer<kDepth, 4> m_stRandomizer;
+        IntrusiveSkipListTailCache<kDepth, double, uint32_t> m_stLayerTails;
+    };
+
+    /**
+     * 场景：固定数量的对象，每帧销毁并创建一部分对象，并修改一部分对象的图层
+     */
+    class Scene
+    {
+    public:
+        Scene(bool useTailCache)
+            : m_stList(m_stNodes, useTailCache)
+        {
+            m_stNodes.reserve(kObjectCount);
+            for (size_t i = 0; i < kObjectCount; ++i)
+            {
+                m_stNodes.emplace_back(make_unique<RendererNode>());
+                m_stNodes.back()->Index = static_cast<uint32_t>(i);
+                Spawn(*m_stNodes.back());
+            }
+        }
+
+    public:
+        void ChurnFrame() noexcept
+        {
+            for (size_t i = 0; i < kChurnPerFrame; ++i)
+            {
+                auto& node = *m_stNodes[m_stEngine() % m_stNodes.size()];
+                m_stList.Remove(node);
+                Spawn(node);
+            }
+        }
+
+        void LayerWriteFrame() noexcept
+        {
+            for (size_t i = 0; i < kLayerWritesPerFrame; ++i)
+            {
+                auto& node = *m_stNodes[m_stEngine() % m_stNodes.size()];
+
+                // 一半写入原值，模拟脚本逐帧重复赋值
+                auto layer = (m_stEngine() % 2) ? node.Layer : RandomLayer();
+                m_stList.SetLayer(node, layer);
+            }
+        }
+
+        bool Collect(vector<pair<double, uint64_t>>& out) noexcept
+        {
+            return m_stList.Collect(out);
+        }
+
+    private:
+        double RandomLayer() noexcept
+        {
+            // 大部分对象集中在少数图层，与弹幕场景一致
+            auto r = m_stEngine() % 100;
+            if (r < 70)
+                return kLayers[1];
+
+            // 少量对象使用连续变化的图层，使缓存条目超出上限
+            if (r < 75)
+                return kLayers[2] + static_cast<double>(m_stEngine() % 1000) / 10.;
+            return kLayers[r % std::extent_v<decltype(kLayers)>];
+        }
+
+        void Spawn(RendererNode& node) noexcept
+        {
+            node.Layer = RandomLayer();
+            node.Sequence = ++m_ullSequence;
+            m_stList.Insert(node);
+        }
+
+    private:
+        vector<unique_ptr<RendererNode>> m_stNodes;
+        RendererList m_stList;
+        mt19937 m_stEngine { 12345 };
+        uint64_t m_ullSequence = 0;
+    };
+}
+
+/**
+ * 20000 个对象的图层变动
+ * 对比从尾部搜索插入与 GameWorld 使用的图层尾部缓存，并检查两者产生完全相同的渲染顺序。
+ */
+LSTG_BENCHMARK(RendererLayerChurn)
+{
+    static const size_t kFrames = 200;
+
+    Scene search(false);
+    Scene cached(true);
+
+    runner.Measure("spawn churn, search from tail", kFrames, [&]() { search.ChurnFrame(); });
+    runner.Measure("spawn churn, layer tail cache", kFrames, [&]() { cached.ChurnFrame(); });
+    runner.Measure("layer writes, search from tail", kFrames, [&]() { search.LayerWriteFrame(); });
+    runner.Measure("layer writes, layer tail cache", kFrames, [&]() { cached.LayerWriteFrame(); });
+
+    vector<pair<double, uint64_t>> searchOrder, cachedOrder;
+    LSTG_BENCHMARK_CHECK(search.Collect(searchOrder));
+    LSTG_BENCHMARK_CHECK(cached.Collect(cachedOrder));
+    LSTG_BENCHMARK_CHECK(searchOrder.size() == kObjectCount);
+    LSTG_BENCHMARK_CHECK(searchOrder == cachedOrder);
+}
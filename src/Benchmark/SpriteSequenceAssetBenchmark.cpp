@@ -0,0 +1,115 @@
+/**
+ * @file
+ * @date 2022/10/4
+ * @author 9chu
+ * 此文件为 LuaSTGPlus 项目的一部分，版权与许可声明详见 COPYRIGHT.txt。
+ */
+#include "Benchmark.hpp"
+
+#include <nlohmann/json.hpp>
+#include <lstg/Core/Subsystem/SubsystemContainer.hpp>
+#include <lstg/Core/Subsystem/AssetSystem.hpp>
+#include <lstg/Core/Subsystem/Asset/BasicTexture2DAsset.hpp>
+#include <lstg/v2/Asset/TextureAsset.hpp>
+#include <lstg/v2/Asset/SpriteSequenceAsset.hpp>
+#include <lstg/v2/Asset/SpriteSequenceAssetFactory.hpp>
+
+using namespace std;
+using namespace lstg;
+using namespace lstg::v2::Asset;
+
+namespace
+{
+    /**
+     * 只提供一张纹理的依赖解析器
+     */
+    class SingleTextureResolver :
+        public Subsystem::Asset::IAssetDependencyResolver
+    {
+    public:
+        SingleTextureResolver(string name, TextureAssetPtr texture)
+            : m_stName(std::move(name)), m_pTexture(std::move(texture)) {}
+
+    public:
+        Subsystem::Asset::AssetPtr OnResolveAsset(std::string_view name) const noexcept override
+        {
+            if (name != m_stName)
+                return nullptr;
+            return m_pTexture;
+        }
+
+    private:
+        string m_stName;
+        TextureAssetPtr m_pTexture;
+    };
+}
+
+/**
+ * 对比 LoadAnimation 经由 JSON 参数与直接传递参数结构创建资产的开销
+ */
+LSTG_BENCHMARK(SpriteSequenceAssetLoading)
+{
+    static const size_t kIterations = 100000;
+
+    Subsystem::SubsystemContainer container;
+    Subsystem::AssetSystem assetSystem(container);
+
+    auto basicTexture = make_shared<Subsystem::Asset::BasicTexture2DAsset>("bench", "bench.png");
+    auto texture = make_shared<TextureAsset>("tex:bench", basicTexture, 1.f);
+    SingleTextureResolver resolver("tex:bench", texture);
+    SpriteSequenceAssetFactory factory;
+
+    // 与 v2 中的 4x2 敌机动画规格相当
+    const double x = 0, y = 0, w = 32, h = 32, a = 8;
+    const int32_t n = 4, m = 2, interval = 4;
+
+    runner.Measure("json arguments", kIterations, [&]() {
+        nlohmann::json args {
+            {"texture", "tex:bench"},
+            {"left", x},
+            {"top", y},
+            {"frameWidth", w},
+            {"frameHeight", h},
+            {"row", m},
+            {"column", n},
+            {"interval", interval},
+            {"colliderHalfSizeX", a},
+            {"colliderHalfSizeY", a},
+            {"colliderIsRect", false},
+        };
+        auto ret = factory.CreateAsset(assetSystem, nullptr, "ani:bench", args, &resolver);
+        LSTG_BENCHMARK_CHECK(ret);
+        Benchmark::DoNotOptimize(std::get<0>(*ret).get());
+    });
+
+    runner.Measure("typed arguments", kIterations, [&]() {
+        SpriteSequenceAssetArguments args;
+        args.Texture = "tex:bench";
+        args.Left = static_cast<float>(x);
+        args.Top = static_cast<float>(y);
+        args.FrameWidth = static_cast<float>(w);
+        args.FrameHeight = static_cast<float>(h);
+        args.Row = m;
+        args.Column = n;
+        args.Interval = interval;
+        args.ColliderHalfSizeX = a;
+        args.ColliderHalfSizeY = a;
+        args.ColliderIsRect = false;
+        auto ret = factory.CreateAsset(assetSystem, nullptr, "ani:bench", args, &resolver);
+        LSTG_BENCHMARK_CHECK(ret);
+        Benchmark::DoNotOptimize(std::get<0>(*ret).get());
+    });
+
+    // 两条路径应当产生相同的资产
+    SpriteSequenceAssetArguments args;
+    args.Texture = "tex:bench";
+    args.FrameWidth = static_cast<float>(w);
+    args.FrameHeight = static_cast<float>(h);
+    args.Row = m;
+    args.Column = n;
+    args.Interval = interval;
+    auto ret = factory.CreateAsset(assetSystem, nullptr, "ani:bench", args, &resolver);
+    LSTG_BENCHMARK_CHECK(ret);
+    auto asset = static_pointer_cast<SpriteSequenceAsset>(std::get<0>(*ret));
+    LSTG_BENCHMARK_CHECK(asset->GetSequences().size() == static_cast<size_t>(n * m));
+}
@@ -0,0 +1,161 @@
+/**
+ * @file
+ * @date 2022/10/4
+ * @author 9chu
+ * 此文件为 LuaSTGPlus 项目的一部分，版权与许可声明详见 COPYRIGHT.txt。
+ */
+#include "Benchmark.hpp"
+
+#include <random>
+#include <lstg/Core/Encoding/Unicode.hpp>
+
+using namespace std;
+using namespace lstg;
+using namespace lstg::Encoding;
+
+namespace
+{
+    const size_t kInputSize = 4 * 1024;
+
+    void AppendUtf8(string& out, char32_t ch)
+    {
+        if (ch < 0x80)
+        {
+            out.push_back(static_cast<char>(ch));
+        }
+        else if (ch < 0x800)
+        {
+            out.push_back(static_cast<char>(0xC0 | (ch >> 6)));
+            out.push_back(static_cast<char>(0x80 | (ch & 0x3F)));
+        }
+        else if (ch < 0x10000)
+        {
+            out.push_back(static_cast<char>(0xE0 | (ch >> 12)));
+            out.push_back(static_cast<char>(0x80 | ((ch >> 6) & 0x3F)));
+            out.push_back(static_cast<char>(0x80 | (ch & 0x3F)));
+        }
+        else
+        {
+            out.push_back(static_cast<char>(0xF0 | (ch >> 18)));
+            out.push_back(static_cast<char>(0x80 | ((ch >> 12) & 0x3F)));
+            out.push_back(static_cast<char>(0x80 | ((ch >> 6) & 0x3F)));
+            out.push_back(static_cast<char>(0x80 | (ch & 0x3F)));
+        }
+    }
+
+    /**
+     * 生成测试输入
+     * @param asciiPercent ASCII 字符所占百分比，其余在 2~4 字节的字符中均匀选取
+     * @param invalidPercent 非法字节所占百分比
+     */
+    string MakeUtf8Input(uint32_t asciiPercent, uint32_t invalidPercent)
+    {
+        mt19937 engine(12345);
+        uniform_int_distribution<uint32_t> percent(0, 99);
+        uniform_int_distribution<uint32_t> ascii(0x20, 0x7E);
+        uniform_int_distribution<uint32_t> twoBytes(0x80, 0x7FF);
+        uniform_int_distribution<uint32_t> threeBytes(0x4E00, 0x9FFF);  // CJK
+        uniform_int_distribution<uint32_t> fourBytes(0x1F300, 0x1F6FF);  // Emoji
+
+        string ret;
+        ret.reserve(kInputSize + 4);
+        while (ret.size() < kInputSize)
+        {
+            if (invalidPercent && percent(engine) < invalidPercent)
+            {
+                ret.push_back(static_cast<char>(0xFF));
+                continue;
+            }
+
+            auto p = percent(engine);
+            if (p < asciiPercent)
+                AppendUtf8(ret, ascii(engine));
+            else if (p % 3 == 0)
+                AppendUtf8(ret, twoBytes(engine));
+            else if (p % 3 == 1)
+                AppendUtf8(ret, threeBytes(engine));
+            else
+                AppendUtf8(ret, fourBytes(engine));
+        }
+        return ret;
+    }
+
+    /**
+     * 不经过批量转码器的逐字符转换，作为正确性的参照
+     */
+    template <typename InputEncoding, typename OutputEncoding, typename InputType, typename OutputType>
+    basic_string<OutputType> ReferenceConvert(basic_string_view<InputType> src)
+    {
+        basic_string<OutputType> ret;
+        ConvertingView<InputEncoding, OutputEncoding, InputType> view({ src.data(), src.size() }, DefaultUnicodeFallbackHandler);
+        for (const auto r : view)
+        {
+            LSTG_BENCHMARK_CHECK(r);
+            const auto& buf = *r;
+            for (size_t i = 0; i < buf.size(); ++i)
+                ret.push_back(static_cast<OutputType>(buf[i]));
+        }
+        return ret;
+    }
+
+    template <typename InputEncoding, typename OutputEncoding, typename InputType, typename OutputType>
+    void MeasureConvert(Benchmark::Runner& runner, string_view label, basic_string_view<InputType> src)
+    {
+        static const size_t kIterations = 20000;
+
+        basic_string<OutputType> out;
+        auto ret = Convert<InputEncoding, OutputEncoding>(out, src, DefaultUnicodeFallbackHandler);
+        LSTG_BENCHMARK_CHECK(ret);
+        LSTG_BENCHMARK_CHECK((out == ReferenceConvert<InputEncoding, OutputEncoding, InputType, OutputType>(src)));
+
+        auto bytes = src.size() * sizeof(InputType);
+        runner.Measure(fmt::format("{} bulk", label), kIterations, [&]() {
+            Convert<InputEncoding, OutputEncoding>(out, src, DefaultUnicodeFallbackHandler);
+            Benchmark::DoNotOptimize(out.data());
+        }, bytes);
+        runner.Measure(fmt::format("{} per code point", label), kIterations / 10, [&]() {
+            auto ref = ReferenceConvert<InputEncoding, OutputEncoding, InputType, OutputType>(src);
+            Benchmark::DoNotOptimize(ref.data());
+        }, bytes);
+    }
+
+    void MeasureInput(Benchmark::Runner& runner, string_view name, const string& utf8)
+    {
+        u16string utf16;
+        u32string utf32;
+        LSTG_BENCHMARK_CHECK(Convert<Utf8, Utf16>(utf16, string_view{utf8}, DefaultUnicodeFallbackHandler));
+        LSTG_BENCHMARK_CHECK(Convert<Utf8, Utf32>(utf32, string_view{utf8}, DefaultUnicodeFallbackHandler));
+
+        MeasureConvert<Utf8, Utf16, char, char16_t>(runner, fmt::format("{} utf8->utf16", name), string_view{utf8});
+        MeasureConvert<Utf16, Utf8, char16_t, char>(runner, fmt::format("{} utf16->utf8", name), u16string_view{utf16});
+        MeasureConvert<Utf8, Utf32, char, char32_t>(runner, fmt::format("{} utf8->utf32", name), string_view{utf8});
+        MeasureConvert<Utf32, Utf8, char32_t, char>(runner, fmt::format("{} utf32->utf8", name), u32string_view{utf32});
+    }
+}
+
+/**
+ * 批量转码与逐字符转码的吞吐量对比
+ * 同时检查两者输出一致，覆盖 SIMD 路径、多字节字符与非法输入的回退。
+ */
+LSTG_BENCHMARK(UnicodeConvert)
+{
+    auto ascii = MakeUtf8Input(100, 0);
+    auto mixed = MakeUtf8Input(70, 0);
+    auto cjk = MakeUtf8Input(10, 0);
+    auto invalid = MakeUtf8Input(70, 1);
+
+    // 合法输入往返转换后应保持不变
+    for (const auto* input : { &ascii, &mixed, &cjk })
+    {
+        u16string utf16;
+        string back;
+        LSTG_BENCHMARK_CHECK(Convert<Utf8, Utf16>(utf16, string_view{*input}));
+        LSTG_BENCHMARK_CHECK(Convert<Utf16, Utf8>(back, u16string_view{utf16}));
+        LSTG_BENCHMARK_CHECK(back == *input);
+    }
+
+    MeasureInput(runner, "ascii", ascii);
+    MeasureInput(runner, "mixed", mixed);
+    MeasureInput(runner, "cjk", cjk);
+    MeasureInput(runner, "invalid", invalid);
+}
@@ -152,7 +152,7 @@ AppBase::AppBase(int argc, const char* argv[])
     const auto kSubsystemEventOnly = SubsystemRegisterFlags::NoRender | SubsystemRegisterFlags::NoUpdate;
     m_stSubsystemContainer.Register<Subsystem::EventBusSystem>("EventBusSystem", 0, kSubsystemNoInteractive);
     m_stSubsystemContainer.Register<Subsystem::WindowSystem>("WindowSystem", 0, kSubsystemNoInteractive);
-    m_stSubsystemContainer.Register<Subsystem::VirtualFileSystem>("VirtualFileSystem", 0, kSubsystemNoInteractive);
+    m_stSubsystemContainer.Register<Subsystem::VirtualFileSystem>("VirtualFileSystem", 0, kSubsystemUpdateOnly);
     m_stSubsystemContainer.Register<Subsystem::ScriptSystem>("ScriptSystem", 0, kSubsystemUpdateOnly);
     m_stSubsystemContainer.Register<Subsystem::RenderSystem>("RenderSystem", 0,
         SubsystemRegisterFlags::NoUpdate | SubsystemRegisterFlags::NoRender);
@@ -525,7 +525,12 @@ void AppBase::Frame() noexcept
 #endif
 
     // 继续执行定时任务
-    m_stMainTaskTimer.Schedule(&m_stFrameTask, now + static_cast<uint64_t>(m_stSleeper.GetFrequency() * GetBestFrameInterval()));
+    auto next = now + static_cast<uint64_t>(m_stSleeper.GetFrequency() * GetBestFrameInterval());
+    m_stMainTaskTimer.Schedule(&m_stFrameTask, next);
+
+    // 记录本帧剩余的空闲时间
+    auto end = Pal::GetCurrentTick();
+    m_dIdleTime = next > end ? static_cast<double>(next - end) / m_stSleeper.GetFrequency() : 0.;
 }
 
 void AppBase::Update() noexcept
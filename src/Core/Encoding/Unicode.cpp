@@ -6,6 +6,20 @@
  */
 #include <lstg/Core/Encoding/Unicode.hpp>
 
+#include <cstring>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+#if (defined(__SSE2__) || defined(_M_AMD64) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define LSTG_SSE2 1
+#include <emmintrin.h>
+#elif (defined(__aarch64__) || defined(_M_ARM64))  // 需要 AArch64 的横向归约指令
+#define LSTG_NEON 1
+#include <arm_neon.h>
+#endif
+
 using namespace std;
 using namespace lstg;
 using namespace lstg::Encoding;
@@ -145,6 +159,7 @@ EncodingResult Utf16::Decoder::operator()(InputType ch, std::array<OutputType, k
             out[0] |= word & 0x3FFu;
             out[0] += 0x10000u;
             count = 1;
+            m_iState = 0;
             return EncodingResult::Accept;
         default:
             assert(false);
@@ -183,3 +198,320 @@ EncodingResult Utf16::Encoder::operator()(InputType ch, std::array<OutputType, k
 const char* const Utf32::kName = "Utf32_Dummy";
 
 // </editor-fold>
+
+// <editor-fold desc="批量转码">
+
+namespace
+{
+    inline bool IsUtf8Continuation(uint8_t b) noexcept
+    {
+        return (b & 0xC0u) == 0x80u;
+    }
+
+    /**
+     * 解码一个多字节 UTF8 字符
+     * 与 Utf8::Decoder 的判定一致：拒绝超长编码、代理区码点和超过 U+10FFFF 的码点。
+     * @return 消耗的字节数，非法或不完整时返回 0
+     */
+    size_t DecodeUtf8Multibyte(const uint8_t* p, size_t remain, char32_t& out) noexcept
+    {
+        auto b0 = p[0];
+        if (b0 >= 0xC2u && b0 <= 0xDFu)
+        {
+            if (remain < 2 || !IsUtf8Continuation(p[1]))
+                return 0;
+            out = ((b0 & 0x1Fu) << 6u) | (p[1] & 0x3Fu);
+            return 2;
+        }
+        else if (b0 >= 0xE0u && b0 <= 0xEFu)
+        {
+            if (remain < 3 || !IsUtf8Continuation(p[1]) || !IsUtf8Continuation(p[2]))
+                return 0;
+            if ((b0 == 0xE0u && p[1] < 0xA0u) || (b0 == 0xEDu && p[1] > 0x9Fu))
+                return 0;
+            out = ((b0 & 0x0Fu) << 12u) | ((p[1] & 0x3Fu) << 6u) | (p[2] & 0x3Fu);
+            return 3;
+        }
+        else if (b0 >= 0xF0u && b0 <= 0xF4u)
+        {
+            if (remain < 4 || !IsUtf8Continuation(p[1]) || !IsUtf8Continuation(p[2]) || !IsUtf8Continuation(p[3]))
+                return 0;
+            if ((b0 == 0xF0u && p[1] < 0x90u) || (b0 == 0xF4u && p[1] > 0x8Fu))
+                return 0;
+            out = ((b0 & 0x07u) << 18u) | ((p[1] & 0x3Fu) << 12u) | ((p[2] & 0x3Fu) << 6u) | (p[3] & 0x3Fu);
+            return 4;
+        }
+        return 0;
+    }
+
+    /**
+     * 编码一个非 ASCII 码点到 UTF8
+     * 与 Utf8::Encoder 一致，调用方保证码点不超过 U+10FFFF。
+     */
+    size_t EncodeUtf8Multibyte(uint32_t cp, char* out) noexcept
+    {
+        assert(cp > 0x7Fu && cp <= 0x10FFFFu);
+        if (cp <= 0x7FFu)
+        {
+            out[0] = static_cast<char>(0xC0u | (cp >> 6u));
+            out[1] = static_cast<char>(0x80u | (cp & 0x3Fu));
+            return 2;
+        }
+        else if (cp <= 0xFFFFu)
+        {
+            out[0] = static_cast<char>(0xE0u | (cp >> 12u));
+            out[1] = static_cast<char>(0x80u | ((cp >> 6u) & 0x3Fu));
+            out[2] = static_cast<char>(0x80u | (cp & 0x3Fu));
+            return 3;
+        }
+        out[0] = static_cast<char>(0xF0u | (cp >> 18u));
+        out[1] = static_cast<char>(0x80u | ((cp >> 12u) & 0x3Fu));
+        out[2] = static_cast<char>(0x80u | ((cp >> 6u) & 0x3Fu));
+        out[3] = static_cast<char>(0x80u | (cp & 0x3Fu));
+        return 4;
+    }
+
+    /**
+     * 获取 16 字节块中开头 ASCII 字节的个数
+     * 全部为 ASCII 时返回 16。
+     */
+    inline size_t CountAsciiPrefix16(const uint8_t* p) noexcept
+    {
+#if defined(LSTG_SSE2)
+        auto mask = static_cast<uint32_t>(_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p))));
+        if (mask == 0)
+            return 16;
+#if defined(_MSC_VER) && !defined(__clang__)
+        unsigned long index = 0;
+        _BitScanForward(&index, mask);
+        return index;
+#else
+        return static_cast<size_t>(__builtin_ctz(mask));
+#endif
+#elif defined(LSTG_NEON)
+        if (vmaxvq_u8(vld1q_u8(p)) < 0x80u)
+            return 16;
+#endif
+        size_t i = 0;
+        while (i < 16 && p[i] < 0x80u)
+            ++i;
+        return i;
+    }
+
+    /**
+     * 将 16 个 ASCII 字节扩展到 16 位
+     */
+    inline void WidenAscii16(char16_t* out, const uint8_t* p) noexcept
+    {
+#if defined(LSTG_SSE2)
+        auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+        auto zero = _mm_setzero_si128();
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_unpacklo_epi8(v, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 8), _mm_unpackhi_epi8(v, zero));
+#elif defined(LSTG_NEON)
+        auto v = vld1q_u8(p);
+        vst1q_u16(reinterpret_cast<uint16_t*>(out), vmovl_u8(vget_low_u8(v)));
+        vst1q_u16(reinterpret_cast<uint16_t*>(out + 8), vmovl_u8(vget_high_u8(v)));
+#else
+        for (size_t i = 0; i < 16; ++i)
+            out[i] = p[i];
+#endif
+    }
+
+    /**
+     * 将 16 个 ASCII 字节扩展到 32 位
+     */
+    inline void WidenAscii16(char32_t* out, const uint8_t* p) noexcept
+    {
+#if defined(LSTG_SSE2)
+        auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+        auto zero = _mm_setzero_si128();
+        auto lo = _mm_unpacklo_epi8(v, zero);
+        auto hi = _mm_unpackhi_epi8(v, zero);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_unpacklo_epi16(lo, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 4), _mm_unpackhi_epi16(lo, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 8), _mm_unpacklo_epi16(hi, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 12), _mm_unpackhi_epi16(hi, zero));
+#elif defined(LSTG_NEON)
+        auto v = vld1q_u8(p);
+        auto lo = vmovl_u8(vget_low_u8(v));
+        auto hi = vmovl_u8(vget_high_u8(v));
+        vst1q_u32(reinterpret_cast<uint32_t*>(out), vmovl_u16(vget_low_u16(lo)));
+        vst1q_u32(reinterpret_cast<uint32_t*>(out + 4), vmovl_u16(vget_high_u16(lo)));
+        vst1q_u32(reinterpret_cast<uint32_t*>(out + 8), vmovl_u16(vget_low_u16(hi)));
+        vst1q_u32(reinterpret_cast<uint32_t*>(out + 12), vmovl_u16(vget_high_u16(hi)));
+#else
+        for (size_t i = 0; i < 16; ++i)
+            out[i] = p[i];
+#endif
+    }
+
+    template <typename TOutput>
+    size_t DecodeUtf8Bulk(TOutput* out, const char* src, size_t length, size_t& written) noexcept
+    {
+        auto p = reinterpret_cast<const uint8_t*>(src);
+        size_t i = 0, o = 0;
+        while (i < length)
+        {
+            // ASCII 整块处理
+            if (length - i >= 16)
+            {
+                auto ascii = CountAsciiPrefix16(p + i);
+                if (ascii == 16)
+                {
+                    WidenAscii16(out + o, p + i);
+                    i += 16;
+                    o += 16;
+                    continue;
+                }
+                for (size_t j = 0; j < ascii; ++j)
+                    out[o++] = p[i++];
+            }
+            else if (p[i] < 0x80u)
+            {
+                out[o++] = p[i++];
+                continue;
+            }
+
+            // 多字节字符
+            char32_t cp = 0;
+            auto count = DecodeUtf8Multibyte(p + i, length - i, cp);
+            if (count == 0)
+                break;
+            i += count;
+            if constexpr (sizeof(TOutput) == sizeof(char16_t))
+            {
+                if (cp > 0xFFFFu)
+                {
+                    cp -= 0x10000u;
+                    out[o++] = static_cast<TOutput>(0xD800u | (cp >> 10u));
+                    out[o++] = static_cast<TOutput>(0xDC00u | (cp & 0x3FFu));
+                    continue;
+                }
+            }
+            out[o++] = static_cast<TOutput>(cp);
+        }
+        written = o;
+        return i;
+    }
+}
+
+size_t BulkConverter<Utf8, Utf16>::Convert(char16_t* out, const char* src, size_t length, size_t& written) noexcept
+{
+    // 4 字节的序列产生 2 个 UTF16 单元，输出长度不会超过输入长度
+    return DecodeUtf8Bulk(out, src, length, written);
+}
+
+size_t BulkConverter<Utf8, Utf32>::Convert(char32_t* out, const char* src, size_t length, size_t& written) noexcept
+{
+    return DecodeUtf8Bulk(out, src, length, written);
+}
+
+size_t BulkConverter<Utf16, Utf8>::Convert(char* out, const char16_t* src, size_t length, size_t& written) noexcept
+{
+    size_t i = 0, o = 0;
+    while (i < length)
+    {
+        // ASCII 整块处理，每次 8 个单元
+        if (length - i >= 8)
+        {
+#if defined(LSTG_SSE2)
+            auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+            auto high = _mm_and_si128(v, _mm_set1_epi16(static_cast<short>(0xFF80)));
+            if (_mm_movemask_epi8(_mm_cmpeq_epi16(high, _mm_setzero_si128())) == 0xFFFF)
+            {
+                _mm_storel_epi64(reinterpret_cast<__m128i*>(out + o), _mm_packus_epi16(v, v));
+                i += 8;
+                o += 8;
+                continue;
+            }
+#elif defined(LSTG_NEON)
+            auto v = vld1q_u16(reinterpret_cast<const uint16_t*>(src + i));
+            if (vmaxvq_u16(v) < 0x80u)
+            {
+                vst1_u8(reinterpret_cast<uint8_t*>(out + o), vmovn_u16(v));
+                i += 8;
+                o += 8;
+                continue;
+            }
+#endif
+        }
+
+        auto word = static_cast<uint32_t>(src[i]);
+        if (word <= 0x7Fu)
+        {
+            out[o++] = static_cast<char>(word);
+            ++i;
+            continue;
+        }
+
+        uint32_t cp = word;
+        if (word >= 0xD800u && word <= 0xDFFFu)
+        {
+            // 只接受完整的代理对
+            if (word > 0xDBFFu || length - i < 2)
+                break;
+            auto low = static_cast<uint32_t>(src[i + 1]);
+            if (low < 0xDC00u || low > 0xDFFFu)
+                break;
+            cp = (((word & 0x3FFu) << 10u) | (low & 0x3FFu)) + 0x10000u;
+            ++i;
+        }
+        ++i;
+        o += EncodeUtf8Multibyte(cp, out + o);
+    }
+    written = o;
+    return i;
+}
+
+size_t BulkConverter<Utf32, Utf8>::Convert(char* out, const char32_t* src, size_t length, size_t& written) noexcept
+{
+    size_t i = 0, o = 0;
+    while (i < length)
+    {
+        // ASCII 整块处理，每次 4 个单元
+        if (length - i >= 4)
+        {
+#if defined(LSTG_SSE2)
+            auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+            auto high = _mm_and_si128(v, _mm_set1_epi32(static_cast<int>(0xFFFFFF80u)));
+            if (_mm_movemask_epi8(_mm_cmpeq_epi32(high, _mm_setzero_si128())) == 0xFFFF)
+            {
+                auto packed = _mm_packus_epi16(_mm_packs_epi32(v, v), _mm_setzero_si128());
+                auto bytes = static_cast<uint32_t>(_mm_cvtsi128_si32(packed));
+                ::memcpy(out + o, &bytes, 4);
+                i += 4;
+                o += 4;
+                continue;
+            }
+#elif defined(LSTG_NEON)
+            auto v = vld1q_u32(reinterpret_cast<const uint32_t*>(src + i));
+            if (vmaxvq_u32(v) < 0x80u)
+            {
+                auto narrow = vmovn_u16(vcombine_u16(vmovn_u32(v), vdup_n_u16(0)));
+                vst1_lane_u32(reinterpret_cast<uint32_t*>(out + o), vreinterpret_u32_u8(narrow), 0);
+                i += 4;
+                o += 4;
+                continue;
+            }
+#endif
+        }
+
+        auto cp = static_cast<uint32_t>(src[i]);
+        if (cp <= 0x7Fu)
+        {
+            out[o++] = static_cast<char>(cp);
+        }
+        else
+        {
+            if (cp > 0x10FFFFu)
+                break;
+            o += EncodeUtf8Multibyte(cp, out + o);
+        }
+        ++i;
+    }
+    written = o;
+    return i;
+}
+
+// </editor-fold>
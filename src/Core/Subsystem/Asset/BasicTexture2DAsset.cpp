@@ -11,6 +11,7 @@
 #include <lstg/Core/Subsystem/AssetSystem.hpp>
 #include <lstg/Core/Subsystem/RenderSystem.hpp>
 #include "../Render/detail/Texture2DDataImpl.hpp"
+#include "detail/BakedTexturePath.hpp"
 
 using namespace std;
 using namespace lstg;
@@ -93,6 +94,21 @@ void BasicTexture2DAsset::InitTextureInfo() noexcept
                 GetName());
 
             auto stream = AssetSystem::GetInstance().OpenAssetStream(m_stPath);
+            for (size_t i = 0; !stream && i < detail::kBakedTextureExtensions.size(); ++i)
+            {
+                // 资源包中可能只包含预烘焙的纹理
+                try
+                {
+                    auto bakedPath = detail::MakeBakedTexturePath(m_stPath, detail::kBakedTextureExtensions[i]);
+                    auto bakedStream = AssetSystem::GetInstance().OpenAssetStream(bakedPath);
+                    if (bakedStream)
+                        stream = std::move(bakedStream);
+                }
+                catch (...)  // bad_alloc
+                {
+                    break;
+                }
+            }
             if (!stream)
             {
                 LSTG_LOG_ERROR_CAT(BasicTexture2DAsset, "Open asset stream from \"{}\" fail: {}", m_stPath, stream.GetError());
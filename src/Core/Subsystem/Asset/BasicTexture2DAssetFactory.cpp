@@ -31,14 +31,25 @@ Result<CreateAssetResult> BasicTexture2DAssetFactory::CreateAsset(AssetSystem& a
     const nlohmann::json& arguments, IAssetDependencyResolver* resolver) noexcept
 {
     auto path = JsonHelper::ReadValue<string>(arguments, "/path");
-    auto mipmaps = JsonHelper::ReadValue<bool>(arguments, "/mipmaps", true);
-    if (!path || path->empty())
+    if (!path)
+        return make_error_code(AssetError::MissingRequiredArgument);
+
+    BasicTexture2DAssetArguments args;
+    args.Path = *path;
+    args.Mipmaps = JsonHelper::ReadValue<bool>(arguments, "/mipmaps", true);
+    return CreateAsset(assetSystem, std::move(pool), name, args, resolver);
+}
+
+Result<CreateAssetResult> BasicTexture2DAssetFactory::CreateAsset(AssetSystem& assetSystem, AssetPoolPtr pool, std::string_view name,
+    const BasicTexture2DAssetArguments& arguments, IAssetDependencyResolver* resolver) noexcept
+{
+    if (arguments.Path.empty())
         return make_error_code(AssetError::MissingRequiredArgument);
 
     try
     {
-        auto asset = make_shared<BasicTexture2DAsset>(std::string{name}, std::move(*path));
-        auto loader = make_shared<BasicTexture2DAssetLoader>(asset, mipmaps);
+        auto asset = make_shared<BasicTexture2DAsset>(std::string{name}, std::string{arguments.Path});
+        auto loader = make_shared<BasicTexture2DAssetLoader>(asset, arguments.Mipmaps);
         return CreateAssetResult { static_pointer_cast<Asset>(asset), static_pointer_cast<AssetLoader>(loader) };
     }
     catch (const std::system_error& ex)
@@ -12,6 +12,7 @@
 #include <lstg/Core/Subsystem/Asset/BasicTexture2DAsset.hpp>
 #include <lstg/Core/Subsystem/Asset/AssetError.hpp>
 #include "../Render/detail/Texture2DDataImpl.hpp"
+#include "detail/BakedTexturePath.hpp"
 #include "detail/WeakPtrTraits.hpp"
 
 using namespace std;
@@ -20,6 +21,8 @@ using namespace lstg::Subsystem::Asset;
 
 LSTG_DEF_LOG_CATEGORY(BasicTexture2DAssetLoader);
 
+static const size_t kMaxImmediateUploadBytes = 256 * 1024;  // 小于该大小的纹理直接在 PostLoad 中创建
+
 BasicTexture2DAssetLoader::BasicTexture2DAssetLoader(AssetPtr asset, bool mipmapEnabled)
     : AssetLoader(std::move(asset)), m_bMipmaps(mipmapEnabled)
 {
@@ -40,18 +43,47 @@ Result<void> BasicTexture2DAssetLoader::PreLoad() noexcept
     }
 
     // 在主线程打开文件流
+    // 按照平台偏好查找预烘焙的纹理，找到时同时保留源文件，以便在设备不支持对应格式时回退
+    string bakedPath;
+    for (auto extension : detail::kBakedTextureExtensions)
+    {
+        try
+        {
+            bakedPath = detail::MakeBakedTexturePath(asset->GetPath(), extension);
+        }
+        catch (...)  // bad_alloc
+        {
+            SetState(AssetLoadingStates::Error);
+            return make_error_code(errc::not_enough_memory);
+        }
+        auto bakedStream = AssetSystem::GetInstance().OpenAssetStream(bakedPath);
+        if (bakedStream)
+        {
+            m_pBakedStream = std::move(*bakedStream);
+            break;
+        }
+    }
     auto stream = AssetSystem::GetInstance().OpenAssetStream(asset->GetPath());
-    if (!stream)
+    if (!stream && !m_pBakedStream)
     {
         LSTG_LOG_ERROR_CAT(BasicTexture2DAssetLoader, "Open asset stream from \"{}\" fail: {}", asset->GetPath(), stream.GetError());
         SetState(AssetLoadingStates::Error);
         return stream.GetError();
     }
 #if LSTG_ASSET_HOT_RELOAD
-    auto attribute = AssetSystem::GetInstance().GetAssetStreamAttribute(asset->GetPath());
+    try
+    {
+        m_stWatchPath = m_pBakedStream ? bakedPath : asset->GetPath();
+    }
+    catch (...)  // bad_alloc
+    {
+        SetState(AssetLoadingStates::Error);
+        return make_error_code(errc::not_enough_memory);
+    }
+    auto attribute = AssetSystem::GetInstance().GetAssetStreamAttribute(m_stWatchPath);
     if (!attribute)
     {
-        LSTG_LOG_ERROR_CAT(BasicTexture2DAssetLoader, "Get asset stream attribute from \"{}\" fail: {}", asset->GetPath(),
+        LSTG_LOG_ERROR_CAT(BasicTexture2DAssetLoader, "Get asset stream attribute from \"{}\" fail: {}", m_stWatchPath,
             attribute.GetError());
     }
     else
@@ -60,7 +92,8 @@ Result<void> BasicTexture2DAssetLoader::PreLoad() noexcept
     }
 #endif
 
-    m_pSourceStream = std::move(*stream);
+    if (stream)
+        m_pSourceStream = std::move(*stream);
     SetState(AssetLoadingStates::Preloaded);
     return {};
 }
@@ -71,6 +104,54 @@ Result<void> BasicTexture2DAssetLoader::AsyncLoad() noexcept
 
     // 在加载线程读取并解码纹理
     auto asset = static_pointer_cast<BasicTexture2DAsset>(GetAsset());
+
+    // 优先使用预烘焙的纹理，其中已包含 Mipmap
+    if (m_pBakedStream)
+    {
+        try
+        {
+            m_stTextureData.emplace(std::move(m_pBakedStream));
+            auto& renderSystem = AssetSystem::GetInstance().GetRenderSystem();
+            if (!renderSystem.IsTextureFormatSupported(m_stTextureData->GetFormat()))
+            {
+                LSTG_LOG_WARN_CAT(BasicTexture2DAssetLoader, "Baked texture format {} for \"{}\" is not supported by device",
+                    static_cast<int>(m_stTextureData->GetFormat()), asset->GetPath());
+                m_stTextureData.reset();
+            }
+            else if (!m_bMipmaps)
+            {
+                m_stTextureData->GenerateMipmap(1);  // 丢弃多余的 Mipmap
+            }
+            else if (m_stTextureData->GetMipLevels() <= 1 && !m_stTextureData->IsCompressed())
+            {
+                m_stTextureData->GenerateMipmap();
+            }
+        }
+        catch (const std::system_error& ex)
+        {
+            LSTG_LOG_WARN_CAT(BasicTexture2DAssetLoader, "Load baked image data for \"{}\" fail: {}", asset->GetPath(), ex.what());
+            m_stTextureData.reset();
+        }
+        catch (...)  // bad_alloc
+        {
+            SetState(AssetLoadingStates::Error);
+            return make_error_code(errc::not_enough_memory);
+        }
+        m_pBakedStream.reset();
+
+        if (m_stTextureData)
+        {
+            m_pSourceStream.reset();
+            SetState(AssetLoadingStates::AsyncLoaded);
+            return {};
+        }
+        if (!m_pSourceStream)
+        {
+            SetState(AssetLoadingStates::Error);
+            return make_error_code(errc::not_supported);
+        }
+    }
+
     try
     {
         m_stTextureData.emplace(std::move(m_pSourceStream));  // Stream 在使用后自动关闭
@@ -97,10 +178,29 @@ Result<void> BasicTexture2DAssetLoader::PostLoad() noexcept
 {
     assert(GetState() == AssetLoadingStates::AsyncLoaded);
 
-    // 调用 RenderSystem 创建纹理
     auto asset = static_pointer_cast<BasicTexture2DAsset>(GetAsset());
     auto& renderSystem = AssetSystem::GetInstance().GetRenderSystem();
+
+    // 较大的纹理通过上传队列分帧上传，避免卡顿
+    if (m_stTextureData->GetBuffer().GetSize() > kMaxImmediateUploadBytes)
+    {
+        auto request = renderSystem.CreateTexture2DAsync(std::move(*m_stTextureData));
+        m_stTextureData.reset();
+        if (!request)
+        {
+            LSTG_LOG_ERROR_CAT(BasicTexture2DAssetLoader, "Create texture from \"{}\" fail: {}", asset->GetPath(), request.GetError());
+            SetState(AssetLoadingStates::Error);
+            return request.GetError();
+        }
+
+        m_pUploadRequest = std::move(*request);
+        SetState(AssetLoadingStates::Uploading);
+        return {};
+    }
+
+    // 调用 RenderSystem 创建纹理
     auto tex = renderSystem.CreateTexture2D(*m_stTextureData);
+    m_stTextureData.reset();
     if (!tex)
     {
         LSTG_LOG_ERROR_CAT(BasicTexture2DAssetLoader, "Create texture from \"{}\" fail: {}", asset->GetPath(), tex.GetError());
@@ -118,6 +218,19 @@ Result<void> BasicTexture2DAssetLoader::PostLoad() noexcept
 
 void BasicTexture2DAssetLoader::Update() noexcept
 {
+    // 等待上传完成
+    if (GetState() == AssetLoadingStates::Uploading)
+    {
+        assert(m_pUploadRequest);
+        if (!m_pUploadRequest->IsFinished())
+            return;
+
+        auto asset = static_pointer_cast<BasicTexture2DAsset>(GetAsset());
+        asset->ReceiveLoadedAsset(m_pUploadRequest->GetTexture());
+        m_pUploadRequest.reset();
+
+        SetState(AssetLoadingStates::Loaded);
+    }
 }
 
 #if LSTG_ASSET_HOT_RELOAD
@@ -132,10 +245,10 @@ bool BasicTexture2DAssetLoader::CheckIsOutdated() const noexcept
 
     // 获取文件属性
     auto asset = static_pointer_cast<BasicTexture2DAsset>(GetAsset());
-    auto attr = AssetSystem::GetInstance().GetAssetStreamAttribute(asset->GetPath());
+    auto attr = AssetSystem::GetInstance().GetAssetStreamAttribute(m_stWatchPath);
     if (!attr)
     {
-        LSTG_LOG_WARN_CAT(BasicTexture2DAssetLoader, "Get stream attribute from \"{}\" fail: {}", asset->GetPath(), attr.GetError());
+        LSTG_LOG_WARN_CAT(BasicTexture2DAssetLoader, "Get stream attribute from \"{}\" fail: {}", m_stWatchPath, attr.GetError());
         return false;
     }
 
@@ -150,4 +263,9 @@ void BasicTexture2DAssetLoader::PrepareToReload() noexcept
     // 转到 Pending 状态，准备重新加载
     SetState(AssetLoadingStates::Pending);
 }
+
+std::string_view BasicTexture2DAssetLoader::GetWatchedPath() const noexcept
+{
+    return m_stWatchPath;
+}
 #endif
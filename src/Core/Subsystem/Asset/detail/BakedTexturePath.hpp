@@ -0,0 +1,44 @@
+/**
+ * @file
+ * @date 2022/8/22
+ * @author 9chu
+ * 此文件为 LuaSTGPlus 项目的一部分，版权与许可声明详见 COPYRIGHT.txt。
+ */
+#pragma once
+#include <array>
+#include <string>
+#include <string_view>
+
+namespace lstg::Subsystem::Asset::detail
+{
+    /**
+     * 预烘焙纹理的扩展名，按照平台偏好排列
+     * 桌面平台优先使用 DDS，移动端和 Web 优先使用 KTX2。
+     */
+#if defined(LSTG_PLATFORM_ANDROID) || defined(LSTG_PLATFORM_EMSCRIPTEN)
+    static const std::array<std::string_view, 2> kBakedTextureExtensions = { ".ktx2", ".dds" };
+#else
+    static const std::array<std::string_view, 2> kBakedTextureExtensions = { ".dds", ".ktx2" };
+#endif
+
+    /**
+     * 获取预烘焙纹理的路径
+     * 将源路径的扩展名替换为预烘焙容器的扩展名，如 "a/b.png" -> "a/b.dds"。
+     * @param path 源路径
+     * @param extension 扩展名
+     * @return 预烘焙纹理路径
+     */
+    inline std::string MakeBakedTexturePath(std::string_view path, std::string_view extension)
+    {
+        auto dot = path.rfind('.');
+        auto slash = path.find_last_of("/\\");
+        if (dot != std::string_view::npos && (slash == std::string_view::npos || dot > slash))
+            path = path.substr(0, dot);
+
+        std::string ret;
+        ret.reserve(path.size() + extension.size());
+        ret.append(path);
+        ret.append(extension);
+        return ret;
+    }
+}
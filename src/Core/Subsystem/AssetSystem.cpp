@@ -6,6 +6,7 @@
  */
 #include <lstg/Core/Subsystem/AssetSystem.hpp>
 
+#include <algorithm>
 #include <lstg/Core/Logging.hpp>
 #include <lstg/Core/Subsystem/SubsystemContainer.hpp>
 #include <lstg/Core/Subsystem/ProfileSystem.hpp>
@@ -28,16 +29,26 @@ namespace
      */
     uint32_t DetermineLoadingThreads() noexcept
     {
-        // 最大分配 4 个线程
+        // 资产的解码之间不存在依赖（依赖关系由依赖图在主线程上处理），因此可以占满除主线程以外的所有核心
         //  vcore  threads
         //     1        1
         //     2        1
-        //     4        2
-        //     8        4
-        //    16        4
-        return std::min(4u, std::max(1u, ThreadPool<>::GetSystemThreadCount() / 2));
+        //     4        3
+        //     8        7
+        //    16       15
+        auto cores = ThreadPool<>::GetSystemThreadCount();
+        return std::max(1u, cores > 1u ? cores - 1u : 1u);
     }
 
+    /**
+     * 加载任务的处理阶段
+     */
+    enum class LoadingPhases
+    {
+        Dispatch,  // 驱动状态机并派发异步任务
+        PostLoad,  // 执行主线程上的 PostLoad
+    };
+
     /**
      * 资产加载器锁
      * 用于防止重入。
@@ -76,6 +87,7 @@ static const uint32_t kMaxTaskExecuteTimeMs = 100;
 #if LSTG_ASSET_HOT_RELOAD
 static const uint32_t kMaxHotReloadCheckTimeMs = 5;
 static const size_t kMaxWatchTaskPerFrame = 3;  // 一帧最多检查 3 个资源
+static const uint32_t kNotifiedWatchTaskSweepInterval = 60;  // 每 60 帧清理一次已卸载资产的通知任务
 #endif
 
 AssetSystem& AssetSystem::GetInstance() noexcept
@@ -187,202 +199,237 @@ Result<Asset::AssetPtr> AssetSystem::CreateAsset(Asset::AssetPoolPtr pool, std::
 void AssetSystem::OnUpdate(double /* elapsedTime */) noexcept
 {
     // 刷新所有加载中任务的状态
+    // 分两轮处理：第一轮驱动状态机，并尽早将解码派发到工作线程；第二轮再集中执行需要在主线程上进行的 PostLoad（如创建 GPU 资源）。
+    // 这样主线程上的工作不会推迟后续任务的派发，各个资产的解码可以在所有工作线程上并行进行。
     if (!m_stLoadingTasks.empty())
     {
         bool executeEnabled = true;
         auto begin = std::chrono::steady_clock::now();
         auto end = begin;
 
-        // 检查所有加载任务
-        for (int32_t i = 0; i < static_cast<int32_t>(m_stLoadingTasks.size()); )
+        for (auto phase : { LoadingPhases::Dispatch, LoadingPhases::PostLoad })
         {
-            auto task = m_stLoadingTasks[i];
-            auto state = task->GetState();
-            auto asset = task->GetAsset();
-            assert(asset);
-
-            // 如果资源上锁了，则跳过
-            // 用于防止阻塞加载时的反复重入。
-            if (task->IsLock())
+            // 检查所有加载任务
+            for (int32_t i = 0; i < static_cast<int32_t>(m_stLoadingTasks.size()); )
             {
-                ++i;
-                continue;
-            }
+                auto task = m_stLoadingTasks[i];
+                auto state = task->GetState();
+                auto asset = task->GetAsset();
+                assert(asset);
+
+                // 如果资源上锁了，则跳过
+                // 用于防止阻塞加载时的反复重入。
+                if (task->IsLock())
+                {
+                    ++i;
+                    continue;
+                }
 
-            // 如果关联的资产已经被从 Pool 删除，可以直接干掉加载任务
-            if (state != Asset::AssetLoadingStates::Loading && asset->IsWildAsset())
-            {
-                LSTG_LOG_TRACE_CAT(AssetSystem, "Asset is already removed from pool, name={}", asset->GetName());
-                goto ASSET_FAIL;
-            }
+                // 如果关联的资产已经被从 Pool 删除，可以直接干掉加载任务
+                if (state != Asset::AssetLoadingStates::Loading && asset->IsWildAsset())
+                {
+                    LSTG_LOG_TRACE_CAT(AssetSystem, "Asset is already removed from pool, name={}", asset->GetName());
+                    goto ASSET_FAIL;
+                }
 
-            // 调用 Update
-            {
+                // 调用 Update
+                if (phase == LoadingPhases::Dispatch)
+                {
+                    {
 #ifdef LSTG_DEVELOPMENT
-                LSTG_PER_FRAME_PROFILE(AssetTask_Update);
+                        LSTG_PER_FRAME_PROFILE(AssetTask_Update);
 #endif
-                AssetLoaderLock lockGuard(task);
-                task->Update();
-            }
+                        AssetLoaderLock lockGuard(task);
+                        task->Update();
+                    }
+                    state = task->GetState();
 
-            // 等待依赖加载或者正在加载，此时跳过
-            if (state == Asset::AssetLoadingStates::DependencyLoading || state == Asset::AssetLoadingStates::AsyncLoadCommitted ||
-                state == Asset::AssetLoadingStates::Loading)
-            {
-                ++i;
-                continue;
-            }
+                    // Update 中可能发生重入（例如阻塞加载子资产），此时需要重新定位任务
+                    if (static_cast<size_t>(i) >= m_stLoadingTasks.size() || m_stLoadingTasks[i] != task)
+                    {
+                        auto it = std::find(m_stLoadingTasks.begin(), m_stLoadingTasks.end(), task);
+                        assert(it != m_stLoadingTasks.end());
+                        i = static_cast<int32_t>(it - m_stLoadingTasks.begin());
+                    }
+                }
 
-            // 可以发起加载过程
-            if (executeEnabled && state == Asset::AssetLoadingStates::Pending)
-            {
+                // 等待依赖加载
+                // 若存在尚未加载完毕的依赖，将任务挂起到依赖资产上，待其加载结束后再唤醒，避免逐帧轮询
+                if (state == Asset::AssetLoadingStates::DependencyLoading)
+                {
+                    if (phase == LoadingPhases::Dispatch && WaitForDependencies(task))
+                    {
+                        m_stLoadingTasks.erase(m_stLoadingTasks.begin() + i);
+                        continue;
+                    }
+                    ++i;
+                    continue;
+                }
+
+                // 正在加载，此时跳过
+                if (state == Asset::AssetLoadingStates::AsyncLoadCommitted || state == Asset::AssetLoadingStates::Loading ||
+                    state == Asset::AssetLoadingStates::Uploading)
+                {
+                    ++i;
+                    continue;
+                }
+
+                // 可以发起加载过程
+                if (executeEnabled && phase == LoadingPhases::Dispatch && state == Asset::AssetLoadingStates::Pending)
+                {
 #ifdef LSTG_DEVELOPMENT
-                LSTG_PER_FRAME_PROFILE(AssetTask_PreLoad);
+                    LSTG_PER_FRAME_PROFILE(AssetTask_PreLoad);
 #endif
 
-                AssetLoaderLock lockGuard(task);
-                auto ret = task->PreLoad();
-                state = task->GetState();
+                    AssetLoaderLock lockGuard(task);
+                    auto ret = task->PreLoad();
+                    state = task->GetState();
 
-                // 刷新时间
-                end = chrono::steady_clock::now();
-                if (chrono::duration_cast<chrono::milliseconds>(end - begin).count() > kMaxTaskExecuteTimeMs)
-                    executeEnabled = false;
+                    // 刷新时间
+                    end = chrono::steady_clock::now();
+                    if (chrono::duration_cast<chrono::milliseconds>(end - begin).count() > kMaxTaskExecuteTimeMs)
+                        executeEnabled = false;
 
-                if (!ret)
-                {
-                    assert(state == Asset::AssetLoadingStates::Error);
-                    LSTG_LOG_ERROR_CAT(AssetSystem, "Pre-load asset fail, err={}, asset={}", ret.GetError(), asset->GetName());
-                    goto ASSET_FAIL;
+                    if (!ret)
+                    {
+                        assert(state == Asset::AssetLoadingStates::Error);
+                        LSTG_LOG_ERROR_CAT(AssetSystem, "Pre-load asset fail, err={}, asset={}", ret.GetError(), asset->GetName());
+                        goto ASSET_FAIL;
+                    }
+                    assert(state == Asset::AssetLoadingStates::Preloaded || state == Asset::AssetLoadingStates::Loaded);
                 }
-                assert(state == Asset::AssetLoadingStates::Preloaded || state == Asset::AssetLoadingStates::Loaded);
-            }
 
-            // 可以发起异步加载过程
-            if (state == Asset::AssetLoadingStates::Preloaded)
-            {
-                // 这个状态不需要锁
-                auto ret = CommitAsyncLoadTask(task);
-                state = task->GetState();
-                if (!ret)
+                // 可以发起异步加载过程
+                if (state == Asset::AssetLoadingStates::Preloaded)
                 {
-                    LSTG_LOG_TRACE_CAT(AssetSystem, "Commit async loading task fail, err={}, name={}", ret.GetError(), asset->GetName());
-                    goto ASSET_FAIL;
+                    // 这个状态不需要锁
+                    auto ret = CommitAsyncLoadTask(task);
+                    state = task->GetState();
+                    if (!ret)
+                    {
+                        LSTG_LOG_TRACE_CAT(AssetSystem, "Commit async loading task fail, err={}, name={}", ret.GetError(), asset->GetName());
+                        goto ASSET_FAIL;
+                    }
+                    assert(state == Asset::AssetLoadingStates::AsyncLoadCommitted || state == Asset::AssetLoadingStates::Loading ||
+                        state == Asset::AssetLoadingStates::AsyncLoaded);
                 }
-                assert(state == Asset::AssetLoadingStates::AsyncLoadCommitted || state == Asset::AssetLoadingStates::Loading ||
-                    state == Asset::AssetLoadingStates::AsyncLoaded);
-            }
 
-            // 如果异步加载成功
-            if (executeEnabled && state == Asset::AssetLoadingStates::AsyncLoaded)
-            {
+                // 如果异步加载成功
+                // PostLoad 推迟到第二轮集中执行，使得本帧所有可以派发的异步任务先行开始
+                if (executeEnabled && phase == LoadingPhases::PostLoad && state == Asset::AssetLoadingStates::AsyncLoaded)
+                {
 #ifdef LSTG_DEVELOPMENT
-                LSTG_PER_FRAME_PROFILE(AssetTask_PostLoad);
+                    LSTG_PER_FRAME_PROFILE(AssetTask_PostLoad);
 #endif
 
-                AssetLoaderLock lockGuard(task);
-                auto ret = task->PostLoad();
-                state = task->GetState();
+                    AssetLoaderLock lockGuard(task);
+                    auto ret = task->PostLoad();
+                    state = task->GetState();
 
-                // 刷新时间
-                end = chrono::steady_clock::now();
-                if (chrono::duration_cast<chrono::milliseconds>(end - begin).count() > kMaxTaskExecuteTimeMs)
-                    executeEnabled = false;
+                    // 刷新时间
+                    end = chrono::steady_clock::now();
+                    if (chrono::duration_cast<chrono::milliseconds>(end - begin).count() > kMaxTaskExecuteTimeMs)
+                        executeEnabled = false;
 
-                if (!ret)
-                {
-                    assert(state == Asset::AssetLoadingStates::Error);
-                    LSTG_LOG_ERROR_CAT(AssetSystem, "Post load asset fail, err={}, asset={}", ret.GetError(), asset->GetName());
-                    goto ASSET_FAIL;
+                    if (!ret)
+                    {
+                        assert(state == Asset::AssetLoadingStates::Error);
+                        LSTG_LOG_ERROR_CAT(AssetSystem, "Post load asset fail, err={}, asset={}", ret.GetError(), asset->GetName());
+                        goto ASSET_FAIL;
+                    }
+                    assert(state == Asset::AssetLoadingStates::Loaded || state == Asset::AssetLoadingStates::Uploading);
                 }
-                assert(state == Asset::AssetLoadingStates::Loaded);
-            }
 
-            // 如果加载成功
-            if (state == Asset::AssetLoadingStates::Loaded)
-            {
-                if (asset->GetName().empty())
-                    LSTG_LOG_TRACE_CAT(AssetSystem, "Asset #{} loaded", asset->m_uId);
-                else
-                    LSTG_LOG_TRACE_CAT(AssetSystem, "Asset \"{}\" loaded", asset->GetName());
+                // 如果加载成功
+                if (state == Asset::AssetLoadingStates::Loaded)
+                {
+                    if (asset->GetName().empty())
+                        LSTG_LOG_TRACE_CAT(AssetSystem, "Asset #{} loaded", asset->m_uId);
+                    else
+                        LSTG_LOG_TRACE_CAT(AssetSystem, "Asset \"{}\" loaded", asset->GetName());
 
-                // 设置关联任务为 Loaded 状态
+                    // 设置关联任务为 Loaded 状态
 #if !LSTG_ASSET_HOT_RELOAD
-                assert(asset->GetState() == Asset::AssetStates::Uninitialized);
+                    assert(asset->GetState() == Asset::AssetStates::Uninitialized);
 #endif
-                asset->SetState(Asset::AssetStates::Loaded);
+                    asset->SetState(Asset::AssetStates::Loaded);
+                    WakeDependentTasks(asset);
 
 #if LSTG_ASSET_HOT_RELOAD
-                // 当热更新支持时，将任务丢到监控列表
-                if (task->SupportHotReload())
-                {
-                    try
-                    {
-                        m_stWatchTasks.push_back(task);
-                    }
-                    catch (...)  // bad_alloc
-                    {
-                        LSTG_LOG_ERROR_CAT(AssetSystem, "Cannot alloc memory");
-                    }
-                }
+                    // 当热更新支持时，将任务丢到监控列表
+                    if (task->SupportHotReload())
+                        AddWatchTask(task);
 #endif
 
-                m_stLoadingTasks.erase(m_stLoadingTasks.begin() + i);
-                continue;
-            }
+                    m_stLoadingTasks.erase(m_stLoadingTasks.begin() + i);
+                    continue;
+                }
 
-            // 如果状态不为失败（此时可能异步加载失败）
-            if (state != Asset::AssetLoadingStates::Error)
-            {
-                ++i;
-                continue;
-            }
+                // 如果状态不为失败（此时可能异步加载失败）
+                if (state != Asset::AssetLoadingStates::Error)
+                {
+                    ++i;
+                    continue;
+                }
 
-        ASSET_FAIL:
-            // 设置关联任务为 Error 状态
+            ASSET_FAIL:
+                // 设置关联任务为 Error 状态
 #if LSTG_ASSET_HOT_RELOAD
-            if (asset->GetState() == Asset::AssetStates::Uninitialized)  // 在热更新支持下，如果异步加载没有成功，则不对原对象发起变动
-            {
+                if (asset->GetState() == Asset::AssetStates::Uninitialized)  // 在热更新支持下，如果异步加载没有成功，则不对原对象发起变动
+                {
+                    asset->SetState(Asset::AssetStates::Error);
+                    if (asset->GetName().empty())
+                        LSTG_LOG_ERROR_CAT(AssetSystem, "Asset #{} load fail", asset->GetId());
+                    else
+                        LSTG_LOG_ERROR_CAT(AssetSystem, "Asset {} load fail", asset->GetName());
+                }
+                else
+                {
+                    if (asset->GetName().empty())
+                        LSTG_LOG_ERROR_CAT(AssetSystem, "Asset #{} reload fail", asset->GetId());
+                    else
+                        LSTG_LOG_ERROR_CAT(AssetSystem, "Asset {} reload fail", asset->GetName());
+                }
+
+                // 失败后也要放回监控任务列表
+                if (task->SupportHotReload())
+                    AddWatchTask(task);
+#else
+                assert(asset->GetState() == Asset::AssetStates::Uninitialized);
                 asset->SetState(Asset::AssetStates::Error);
                 if (asset->GetName().empty())
                     LSTG_LOG_ERROR_CAT(AssetSystem, "Asset #{} load fail", asset->GetId());
                 else
                     LSTG_LOG_ERROR_CAT(AssetSystem, "Asset {} load fail", asset->GetName());
+#endif
+                WakeDependentTasks(asset);
+                m_stLoadingTasks.erase(m_stLoadingTasks.begin() + i);
             }
-            else
-            {
-                if (asset->GetName().empty())
-                    LSTG_LOG_ERROR_CAT(AssetSystem, "Asset #{} reload fail", asset->GetId());
-                else
-                    LSTG_LOG_ERROR_CAT(AssetSystem, "Asset {} reload fail", asset->GetName());
-            }
+        }
+    }
 
-            // 失败后也要放回监控任务列表
-            if (task->SupportHotReload())
-            {
-                try
-                {
-                    m_stWatchTasks.push_back(task);
-                }
-                catch (...)  // bad_alloc
-                {
-                    LSTG_LOG_ERROR_CAT(AssetSystem, "Cannot alloc memory");
-                }
-            }
-#else
-            assert(asset->GetState() == Asset::AssetStates::Uninitialized);
-            asset->SetState(Asset::AssetStates::Error);
-            if (asset->GetName().empty())
-                LSTG_LOG_ERROR_CAT(AssetSystem, "Asset #{} load fail", asset->GetId());
-            else
-                LSTG_LOG_ERROR_CAT(AssetSystem, "Asset {} load fail", asset->GetName());
+#if LSTG_ASSET_HOT_RELOAD
+    // 处理文件变更通知
+    if (!m_stNotifiedWatchTasks.empty())
+    {
+#ifdef LSTG_DEVELOPMENT
+        LSTG_PER_FRAME_PROFILE(AssetTask_WatchNotify);
 #endif
-            m_stLoadingTasks.erase(m_stLoadingTasks.begin() + i);
+        ProcessChangedFiles();
+
+        // 任务持有资产，资产卸载后需要及时释放，否则会一直存活到文件下一次变化
+        if (m_uNotifiedWatchSweepCountdown == 0)
+        {
+            m_uNotifiedWatchSweepCountdown = kNotifiedWatchTaskSweepInterval;
+            SweepNotifiedWatchTasks();
+        }
+        else
+        {
+            --m_uNotifiedWatchSweepCountdown;
         }
     }
 
-#if LSTG_ASSET_HOT_RELOAD
-    // 刷新所有监控任务的状态
+    // 刷新所有轮询任务的状态
     if (!m_stWatchTasks.empty())
     {
 #ifdef LSTG_DEVELOPMENT
@@ -409,32 +456,9 @@ void AssetSystem::OnUpdate(double /* elapsedTime */) noexcept
                 continue;
             }
 
-            // 若资源已过期
-            if (task->CheckIsOutdated())
-            {
-                try
-                {
-                    LSTG_LOG_INFO_CAT(AssetSystem, "Reload asset \"{}\"", task->GetAsset()->GetName());
-
-                    // 先尝试加入任务队列
-                    m_stLoadingTasks.emplace_back(task);
-
-                    // 发起重新加载操作
-                    {
-#ifdef LSTG_DEVELOPMENT
-                        LSTG_PER_FRAME_PROFILE(AssetTask_PrepareToReload);
-#endif
-                        task->PrepareToReload();
-                    }
-
-                    // 从队列删除
-                    m_stWatchTasks.erase(m_stWatchTasks.begin() + static_cast<ptrdiff_t>(m_uLastCheckedTask));
-                }
-                catch (...)
-                {
-                    LSTG_LOG_ERROR_CAT(AssetSystem, "Cannot alloc memory");
-                }
-            }
+            // 若资源已过期，发起重新加载并从队列删除
+            if (task->CheckIsOutdated() && ReloadTask(task))
+                m_stWatchTasks.erase(m_stWatchTasks.begin() + static_cast<ptrdiff_t>(m_uLastCheckedTask));
 
             // 刷新时间
             end = chrono::steady_clock::now();
@@ -448,6 +472,14 @@ void AssetSystem::OnUpdate(double /* elapsedTime */) noexcept
     }
 #endif
 
+    // 执行纹理上传，完成后由加载器在下一次 Update 中切换到 Loaded 状态
+    {
+#ifdef LSTG_DEVELOPMENT
+        LSTG_PER_FRAME_PROFILE(AssetTask_TextureUpload);
+#endif
+        m_pRenderSystem->UpdateTextureUploads();
+    }
+
     // 更新线程池
     {
 #ifdef LSTG_DEVELOPMENT
@@ -457,6 +489,205 @@ void AssetSystem::OnUpdate(double /* elapsedTime */) noexcept
     }
 }
 
+bool AssetSystem::WaitForDependencies(const Asset::AssetLoaderPtr& loader) noexcept
+{
+    try
+    {
+        m_stDependencyScratch.clear();
+        loader->GetDependencies(m_stDependencyScratch);
+
+        // 挂起到第一个尚未结束加载的依赖上，唤醒后会再次检查剩余的依赖
+        for (auto& dep : m_stDependencyScratch)
+        {
+            assert(dep);
+            if (dep->GetState() != Asset::AssetStates::Uninitialized)
+                continue;
+
+            m_stDependencyWaitingTasks[dep].emplace_back(loader);
+            m_stDependencyScratch.clear();
+            return true;
+        }
+    }
+    catch (...)  // bad_alloc
+    {
+        // 无法挂起时退化为逐帧轮询
+        LSTG_LOG_ERROR_CAT(AssetSystem, "Cannot alloc memory");
+    }
+    m_stDependencyScratch.clear();
+    return false;
+}
+
+void AssetSystem::WakeDependentTasks(const Asset::AssetPtr& asset) noexcept
+{
+    if (m_stDependencyWaitingTasks.empty())
+        return;
+
+    auto it = m_stDependencyWaitingTasks.find(asset);
+    if (it == m_stDependencyWaitingTasks.end())
+        return;
+
+    auto tasks = std::move(it->second);
+    m_stDependencyWaitingTasks.erase(it);
+
+    // 放回加载队列末尾，若当前正在遍历队列，本轮即可继续处理
+    for (auto& task : tasks)
+    {
+        try
+        {
+            m_stLoadingTasks.emplace_back(std::move(task));
+        }
+        catch (...)  // bad_alloc
+        {
+            LSTG_LOG_ERROR_CAT(AssetSystem, "Cannot alloc memory");
+        }
+    }
+}
+
+#if LSTG_ASSET_HOT_RELOAD
+void AssetSystem::AddWatchTask(Asset::AssetLoaderPtr loader) noexcept
+{
+    // 优先使用文件变更通知，不支持时退化到轮询
+    if (WatchTaskByNotification(loader))
+        return;
+
+    try
+    {
+        m_stWatchTasks.emplace_back(std::move(loader));
+    }
+    catch (...)  // bad_alloc
+    {
+        LSTG_LOG_ERROR_CAT(AssetSystem, "Cannot alloc memory");
+    }
+}
+
+bool AssetSystem::WatchTaskByNotification(const Asset::AssetLoaderPtr& loader) noexcept
+{
+    auto path = loader->GetWatchedPath();
+    if (path.empty())
+        return false;
+
+    try
+    {
+        auto fullPath = VFS::Path::Normalize(fmt::format("{0}/{1}", m_pVirtualFileSystem->GetAssetBaseDirectory(), path));
+        auto ret = m_pVirtualFileSystem->WatchFile(fullPath.ToStringView());
+        if (!ret)
+        {
+            if (ret.GetError() != make_error_code(errc::not_supported))
+                LSTG_LOG_WARN_CAT(AssetSystem, "Watch file \"{}\" fail, fallback to polling: {}", fullPath.ToStringView(), ret.GetError());
+            return false;
+        }
+        m_stNotifiedWatchTasks.emplace(fullPath.ToString(), loader);
+        return true;
+    }
+    catch (...)  // bad_alloc
+    {
+        return false;
+    }
+}
+
+void AssetSystem::ProcessChangedFiles() noexcept
+{
+    m_stChangedFiles.clear();
+    auto ret = m_pVirtualFileSystem->PollChangedFiles(m_stChangedFiles);
+    if (!ret)
+    {
+        LSTG_LOG_ERROR_CAT(AssetSystem, "Poll changed files fail: {}", ret.GetError());
+        return;
+    }
+
+    for (const auto& file : m_stChangedFiles)
+    {
+        try
+        {
+            auto key = file.ToString();
+            auto range = m_stNotifiedWatchTasks.equal_range(key);
+            if (range.first == range.second)
+                continue;
+
+            // 取出关联的任务，需要在遍历完后再行处理，因为重新监视会修改表
+            std::vector<Asset::AssetLoaderPtr> tasks;
+            for (auto it = range.first; it != range.second; ++it)
+                tasks.emplace_back(it->second);
+            m_stNotifiedWatchTasks.erase(range.first, range.second);
+
+            for (auto& task : tasks)
+            {
+                assert(!task->IsLock());
+
+                // 如果关联资源已经卸载，则终止任务
+                if (task->GetAsset()->IsWildAsset())
+                    continue;
+
+                // 文件可能只是被触碰而内容没有变化，仍然交给加载器判断
+                // 重新加载失败时，任务会在加载流程结束后重新加入监视
+                if (task->CheckIsOutdated() && ReloadTask(task))
+                    continue;
+
+                // 文件被替换后原有监视可能失效，重新监视
+                AddWatchTask(std::move(task));
+            }
+
+            // 没有任务继续关注该文件时释放监视
+            UnwatchIfUnused(key);
+        }
+        catch (...)  // bad_alloc
+        {
+            LSTG_LOG_ERROR_CAT(AssetSystem, "Cannot alloc memory");
+        }
+    }
+}
+
+void AssetSystem::SweepNotifiedWatchTasks() noexcept
+{
+    auto it = m_stNotifiedWatchTasks.begin();
+    while (it != m_stNotifiedWatchTasks.end())
+    {
+        if (!it->second->GetAsset()->IsWildAsset())
+        {
+            ++it;
+            continue;
+        }
+
+        // 取出节点，避免复制路径
+        auto node = m_stNotifiedWatchTasks.extract(it++);
+        UnwatchIfUnused(node.key());
+    }
+}
+
+void AssetSystem::UnwatchIfUnused(const std::string& path) noexcept
+{
+    if (m_stNotifiedWatchTasks.find(path) != m_stNotifiedWatchTasks.end())
+        return;
+
+    auto ret = m_pVirtualFileSystem->UnwatchFile(path);
+    if (!ret)
+        LSTG_LOG_WARN_CAT(AssetSystem, "Unwatch file \"{}\" fail: {}", path, ret.GetError());
+}
+
+bool AssetSystem::ReloadTask(const Asset::AssetLoaderPtr& loader) noexcept
+{
+    try
+    {
+        LSTG_LOG_INFO_CAT(AssetSystem, "Reload asset \"{}\"", loader->GetAsset()->GetName());
+
+        // 先尝试加入任务队列
+        m_stLoadingTasks.emplace_back(loader);
+    }
+    catch (...)  // bad_alloc
+    {
+        LSTG_LOG_ERROR_CAT(AssetSystem, "Cannot alloc memory");
+        return false;
+    }
+
+    // 发起重新加载操作
+#ifdef LSTG_DEVELOPMENT
+    LSTG_PER_FRAME_PROFILE(AssetTask_PrepareToReload);
+#endif
+    loader->PrepareToReload();
+    return true;
+}
+#endif
+
 void AssetSystem::RegisterCoreAssetFactories()
 {
     auto ret = RegisterAssetFactory(make_shared<Asset::BasicTexture2DAssetFactory>());
@@ -476,8 +707,15 @@ Result<Asset::AssetPtr> AssetSystem::CreateAsset(Asset::AssetPoolPtr pool, Asset
         LSTG_LOG_TRACE_CAT(AssetSystem, "Create asset error, err={}, asset={}", ret.GetError(), name);
         return ret.GetError();
     }
-    auto asset = std::move(std::get<0>(*ret));
-    auto loader = std::move(std::get<1>(*ret));
+    return AddCreatedAsset(std::move(pool), name, std::move(*ret));
+}
+
+Result<Asset::AssetPtr> AssetSystem::AddCreatedAsset(Asset::AssetPoolPtr pool, std::string_view name,
+    Asset::CreateAssetResult result) noexcept
+{
+    assert(pool);
+    auto asset = std::move(std::get<0>(result));
+    auto loader = std::move(std::get<1>(result));
 
     // 加入到队列
     if (loader)
@@ -6,6 +6,7 @@
  */
 #include "SDLSoundDecoder.hpp"
 
+#include <lstg/Core/Subsystem/VFS/BufferedStream.hpp>
 #include "../../detail/SDLHelper.hpp"
 #include "detail/SDLSoundError.hpp"
 
@@ -40,6 +41,9 @@ SDLSoundDecoder::SDLSoundDecoder(VFS::StreamPtr stream)
 {
     static SDLSoundSubsystemScope kSDLSoundScope;
 
+    // SDL_sound 的解码器会发出大量小读取，经过缓冲后再交给底层流
+    m_pStream = VFS::MakeBufferedStream(std::move(m_pStream)).ThrowIfError();
+
     // 构造 RWOps
     lstg::detail::SDLRWOpsPtr rwOps;
     rwOps = lstg::detail::CreateRWOpsFromStream(m_pStream.get());
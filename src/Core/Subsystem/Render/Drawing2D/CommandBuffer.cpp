@@ -32,6 +32,7 @@ void CommandBuffer::Begin() noexcept
     m_uCurrentBaseVertexIndex = 0;
     m_stVertices.clear();
     m_stIndexes.clear();
+    m_stInstances.clear();
     m_stCommandGroups.clear();
     m_stCurrentGroup = {};
     m_stCurrentQueue = {};
@@ -49,6 +50,7 @@ CommandBuffer::DrawData CommandBuffer::End() noexcept
         m_stCommandGroups,
         m_stVertices,
         m_stIndexes,
+        m_stInstances,
         m_stCameraReferences,
         m_stTextureReferences,
         m_stMaterialReferences,
@@ -160,42 +162,11 @@ Result<void> CommandBuffer::DrawQuad(TexturePtr tex2d, const Vertex (&arr)[4]) n
 
 Result<Span<Vertex>> CommandBuffer::DrawQuadInPlace(TexturePtr tex2d) noexcept
 {
-    // 创建纹理
-    auto texId = AllocTexture(std::move(tex2d));
-    if (!texId)
-        return texId.GetError();
-
-    // 创建材质
-    auto matId = AllocMaterial(m_pCurrentMaterial);
-    if (!matId)
-        return matId.GetError();
-
     // 创建命令（若没有）
-    auto ret = InstantialCommand();
+    auto ret = InstantialDrawCommand(std::move(tex2d), false);
     if (!ret)
         return ret.GetError();
 
-    if ((*m_stCurrentDrawCommand)->TextureId == static_cast<size_t>(-1))
-    {
-        // 此时是新创建的命令，直接设置 TextureId 和 MatId
-        assert((*m_stCurrentDrawCommand)->MaterialId == static_cast<size_t>(-1));
-        assert((*m_stCurrentDrawCommand)->IndexCount == 0);
-        (*m_stCurrentDrawCommand)->TextureId = *texId;
-        (*m_stCurrentDrawCommand)->MaterialId = *matId;
-    }
-    else if ((*m_stCurrentDrawCommand)->TextureId != *texId || (*m_stCurrentDrawCommand)->MaterialId != *matId)
-    {
-        // 此时需要创建新的 Command
-        PrepareNewCommand();
-        ret = InstantialCommand();
-        if (!ret)
-            return ret.GetError();
-        assert((*m_stCurrentDrawCommand)->TextureId == static_cast<size_t>(-1));
-        assert((*m_stCurrentDrawCommand)->MaterialId == static_cast<size_t>(-1));
-        (*m_stCurrentDrawCommand)->TextureId = *texId;
-        (*m_stCurrentDrawCommand)->MaterialId = *matId;
-    }
-
     // 防止索引越界
     assert(m_stVertices.size() + 4 - m_uCurrentBaseVertexIndex <= std::numeric_limits<uint16_t>::max());
 
@@ -236,6 +207,30 @@ Result<Span<Vertex>> CommandBuffer::DrawQuadInPlace(TexturePtr tex2d) noexcept
     return Span<Vertex> { vertexStart, 4 };
 }
 
+Result<void> CommandBuffer::DrawSpriteInstance(TexturePtr tex2d, const SpriteInstance& instance) noexcept
+{
+    static_assert(is_trivially_copyable_v<SpriteInstance>);
+    assert(IsSpriteInstancingAvailable());
+
+    // 创建命令（若没有）
+    auto ret = InstantialDrawCommand(std::move(tex2d), true);
+    if (!ret)
+        return ret.GetError();
+
+    // 分配实例
+    try
+    {
+        m_stInstances.push_back(instance);
+    }
+    catch (...)  // bad_alloc
+    {
+        return make_error_code(errc::not_enough_memory);
+    }
+
+    ++(*m_stCurrentDrawCommand)->InstanceCount;
+    return {};
+}
+
 Result<void> CommandBuffer::Clear(ColorRGBA32 color) noexcept
 {
     // Clear 总是会占用一个独立的 Queue
@@ -411,6 +406,9 @@ Result<void> CommandBuffer::InstantialCommand() noexcept
                 m_stIndexes.size(),
                 0,
                 m_uCurrentBaseVertexIndex,
+                false,
+                m_stInstances.size(),
+                0,
             };
             (*m_stCurrentQueue)->get()->Commands.emplace_back(command);
             m_stCurrentDrawCommand = (*m_stCurrentQueue)->get()->Commands.end() - 1;
@@ -430,3 +428,47 @@ Result<void> CommandBuffer::InstantialCommand() noexcept
     }
     return {};
 }
+
+Result<void> CommandBuffer::InstantialDrawCommand(TexturePtr tex2d, bool instanced) noexcept
+{
+    // 创建纹理
+    auto texId = AllocTexture(std::move(tex2d));
+    if (!texId)
+        return texId.GetError();
+
+    // 创建材质
+    auto matId = AllocMaterial(m_pCurrentMaterial);
+    if (!matId)
+        return matId.GetError();
+
+    // 创建命令（若没有）
+    auto ret = InstantialCommand();
+    if (!ret)
+        return ret.GetError();
+
+    if ((*m_stCurrentDrawCommand)->TextureId == static_cast<size_t>(-1))
+    {
+        // 此时是新创建的命令，直接设置 TextureId、MatId 和绘制方式
+        assert((*m_stCurrentDrawCommand)->MaterialId == static_cast<size_t>(-1));
+        assert((*m_stCurrentDrawCommand)->IndexCount == 0);
+        assert((*m_stCurrentDrawCommand)->InstanceCount == 0);
+        (*m_stCurrentDrawCommand)->TextureId = *texId;
+        (*m_stCurrentDrawCommand)->MaterialId = *matId;
+        (*m_stCurrentDrawCommand)->Instanced = instanced;
+    }
+    else if ((*m_stCurrentDrawCommand)->TextureId != *texId || (*m_stCurrentDrawCommand)->MaterialId != *matId ||
+        (*m_stCurrentDrawCommand)->Instanced != instanced)
+    {
+        // 此时需要创建新的 Command
+        PrepareNewCommand();
+        ret = InstantialCommand();
+        if (!ret)
+            return ret.GetError();
+        assert((*m_stCurrentDrawCommand)->TextureId == static_cast<size_t>(-1));
+        assert((*m_stCurrentDrawCommand)->MaterialId == static_cast<size_t>(-1));
+        (*m_stCurrentDrawCommand)->TextureId = *texId;
+        (*m_stCurrentDrawCommand)->MaterialId = *matId;
+        (*m_stCurrentDrawCommand)->Instanced = instanced;
+    }
+    return {};
+}
@@ -13,20 +13,12 @@ using namespace std;
 using namespace lstg;
 using namespace lstg::Subsystem::Render::Drawing2D;
 
-static const char* kDefault2DEffect = R"EFFECT(
-local vs, ps
+static const char* kDefault2DVertexShader = R"EFFECT(
+local vs
 do
     -- External CBuffer
     local cbCameraState = importConstantBuffer "_CameraState"
 
-    -- CBuffer
-    local cbFogState = constantBuffer "FogState"
-        :scalar("FogType", ScalarTypes.UINT)
-        :scalar("FogColorRGBA32", ScalarTypes.UINT)
-        :scalar("FogArg1", ScalarTypes.FLOAT)
-        :scalar("FogArg2", ScalarTypes.FLOAT)
-        :build()
-
     -- Vertex Layout
     local vl2d = vertexLayout()
         :slot(0, SemanticNames.POSITION, 0)  -- vec3
@@ -35,10 +27,6 @@ do
         :slot(3, SemanticNames.COLOR, 1, true)  -- uint8_t[4] -> vec4
         :build()
 
-    -- Texture
-    local texMainTexture = texture2d "MainTexture"
-        :build()
-
     -- Vertex Shader
     vs = vertexShader [=[
         struct VSInput
@@ -73,6 +61,90 @@ do
         :use(cbCameraState)
         :vertexLayout(vl2d)
         :build()
+end
+)EFFECT";
+
+static const char* kDefault2DInstancedVertexShader = R"EFFECT(
+local vs
+do
+    -- External CBuffer
+    local cbCameraState = importConstantBuffer "_CameraState"
+
+    -- Vertex Layout
+    -- POSITION0 为逐顶点数据，其余均为逐实例数据（SpriteInstance）
+    local vl2d = vertexLayout()
+        :slot(0, SemanticNames.POSITION, 0)  -- vec2, 四边形角点
+        :slot(1, SemanticNames.POSITION, 1)  -- vec4, 平移 + 旋转
+        :slot(2, SemanticNames.TEXCOORD, 0)  -- vec2, 缩放
+        :slot(3, SemanticNames.TEXCOORD, 1)  -- vec4, 形状
+        :slot(4, SemanticNames.TEXCOORD, 2)  -- vec4, 纹理坐标
+        :slot(5, SemanticNames.COLOR, 0, true)  -- uint8_t[4] -> vec4
+        :slot(6, SemanticNames.COLOR, 1, true)  -- uint8_t[4] -> vec4
+        :build()
+
+    -- Vertex Shader
+    vs = vertexShader [=[
+        struct VSInput
+        {
+            float2 Corner: ATTRIB0;  // POSITION0
+            float4 PositionRotation: ATTRIB1;  // POSITION1
+            float2 Scale: ATTRIB2;  // TEXCOORD0
+            float4 Shape: ATTRIB3;  // TEXCOORD1
+            float4 TexRect: ATTRIB4;  // TEXCOORD2
+            float4 AdditiveColor: ATTRIB5;  // COLOR0
+            float4 MultiplierColor: ATTRIB6;  // COLOR1
+        };
+
+        struct VSOutput
+        {
+            float4 Position: SV_POSITION;
+            float2 UV: TEXCOORD0;
+            float FogDepth: FOGDISTANCE;
+            float4 AdditiveColor: COLOR0;
+            float4 MultiplierColor: COLOR1;
+        };
+
+        void main(in VSInput inVert, out VSOutput outVert)
+        {
+            // 与 SpriteDrawing 的 Shape -> Transform -> Translate 保持一致：先缩放，再旋转，最后平移
+            float2 local = (inVert.Shape.xy + (inVert.Shape.zw - inVert.Shape.xy) * inVert.Corner) * inVert.Scale;
+            float sinR = sin(inVert.PositionRotation.w);
+            float cosR = cos(inVert.PositionRotation.w);
+            float3 position = float3(
+                local.x * cosR - local.y * sinR + inVert.PositionRotation.x,
+                local.x * sinR + local.y * cosR + inVert.PositionRotation.y,
+                inVert.PositionRotation.z);
+
+            float4 cameraViewPos = mul(_CameraViewMatrix, float4(position, 1.0));
+            outVert.Position = mul(_CameraProjectViewMatrix, float4(position, 1.0));
+            outVert.UV = inVert.TexRect.xy + (inVert.TexRect.zw - inVert.TexRect.xy) * inVert.Corner;
+            outVert.FogDepth = cameraViewPos.z;
+            outVert.AdditiveColor = inVert.AdditiveColor;
+            outVert.MultiplierColor = inVert.MultiplierColor;
+        }
+    ]=]
+        :name("Default 2D Instanced Vertex Shader")
+        :entry("main")
+        :use(cbCameraState)
+        :vertexLayout(vl2d)
+        :build()
+end
+)EFFECT";
+
+static const char* kDefault2DEffectBody = R"EFFECT(
+local ps
+do
+    -- CBuffer
+    local cbFogState = constantBuffer "FogState"
+        :scalar("FogType", ScalarTypes.UINT)
+        :scalar("FogColorRGBA32", ScalarTypes.UINT)
+        :scalar("FogArg1", ScalarTypes.FLOAT)
+        :scalar("FogArg2", ScalarTypes.FLOAT)
+        :build()
+
+    -- Texture
+    local texMainTexture = texture2d "MainTexture"
+        :build()
 
     -- Pixel Shader
     ps = pixelShader [=[
@@ -342,7 +414,7 @@ CommandExecutor::CommandExecutor(RenderSystem& renderSystem)
     : m_stRenderSystem(renderSystem), m_pDefaultTexture(renderSystem.GetDefaultTexture2D())
 {
     // 创建默认的 2D 渲染 Shader
-    auto effect = renderSystem.GetEffectFactory()->CreateEffect(kDefault2DEffect);
+    auto effect = renderSystem.GetEffectFactory()->CreateEffect(string{kDefault2DVertexShader} + kDefault2DEffectBody);
     if (!effect)
     {
         LSTG_LOG_ERROR_CAT(CommandExecutor, "Create default 2d effect fail: {}", effect.GetError());
@@ -358,6 +430,24 @@ CommandExecutor::CommandExecutor(RenderSystem& renderSystem)
     }
     m_pDefaultMaterial = std::move(*material);
 
+    // 创建实例化 2D 渲染 Shader
+    // 与默认 Shader 共享 PixelShader 及 Pass 定义，仅在 VertexShader 中展开四边形
+    effect = renderSystem.GetEffectFactory()->CreateEffect(string{kDefault2DInstancedVertexShader} + kDefault2DEffectBody);
+    if (!effect)
+    {
+        LSTG_LOG_ERROR_CAT(CommandExecutor, "Create default 2d instanced effect fail: {}", effect.GetError());
+        effect.ThrowIfError();
+    }
+
+    // 创建实例化 Material
+    material = renderSystem.CreateMaterial(*effect);
+    if (!material)
+    {
+        LSTG_LOG_ERROR_CAT(CommandExecutor, "Create default 2d instanced material fail: {}", material.GetError());
+        material.ThrowIfError();
+    }
+    m_pInstancedMaterial = std::move(*material);
+
     // 创建动态 Mesh
     Render::GraphDef::MeshDefinition meshDefinition;
     {
@@ -390,6 +480,64 @@ CommandExecutor::CommandExecutor(RenderSystem& renderSystem)
         mesh.ThrowIfError();
     }
     m_pMesh = std::move(*mesh);
+
+    // 创建实例化 Mesh
+    // 顶点缓冲区只存放单位四边形的四个角点，逐实例数据每帧提交
+    Render::GraphDef::MeshDefinition instancedMeshDefinition;
+    {
+        using ScalarTypes = Render::GraphDef::MeshDefinition::VertexElementScalarTypes;
+        using Components = Render::GraphDef::MeshDefinition::VertexElementComponents;
+        using SemanticNames = Render::GraphDef::MeshDefinition::VertexElementSemanticNames;
+        instancedMeshDefinition.SetVertexStride(sizeof(glm::vec2));
+        instancedMeshDefinition.SetPrimitiveTopologyType(Render::GraphDef::MeshDefinition::PrimitiveTopologyTypes::TriangleList);
+        instancedMeshDefinition.AddVertexElement(
+            {ScalarTypes::Float, Components::Two},
+            {SemanticNames::Position, 0},
+            0);
+        instancedMeshDefinition.SetInstanceStride(sizeof(SpriteInstance));
+        instancedMeshDefinition.AddInstanceElement(
+            {ScalarTypes::Float, Components::Four},
+            {SemanticNames::Position, 1},
+            offsetof(SpriteInstance, Position));  // Position + Rotation
+        instancedMeshDefinition.AddInstanceElement(
+            {ScalarTypes::Float, Components::Two},
+            {SemanticNames::TextureCoord, 0},
+            offsetof(SpriteInstance, Scale));
+        instancedMeshDefinition.AddInstanceElement(
+            {ScalarTypes::Float, Components::Four},
+            {SemanticNames::TextureCoord, 1},
+            offsetof(SpriteInstance, Shape));
+        instancedMeshDefinition.AddInstanceElement(
+            {ScalarTypes::Float, Components::Four},
+            {SemanticNames::TextureCoord, 2},
+            offsetof(SpriteInstance, TexRect));
+        instancedMeshDefinition.AddInstanceElement(
+            {ScalarTypes::UInt8, Components::Four},
+            {SemanticNames::Color, 0},
+            offsetof(SpriteInstance, Color0));
+        instancedMeshDefinition.AddInstanceElement(
+            {ScalarTypes::UInt8, Components::Four},
+            {SemanticNames::Color, 1},
+            offsetof(SpriteInstance, Color1));
+    }
+    static_assert(offsetof(SpriteInstance, Rotation) == offsetof(SpriteInstance, Position) + sizeof(glm::vec3));
+
+    // 角点顺序与 DrawQuadInPlace 一致
+    // 0 -- 1
+    // | \  |
+    // |  \ |
+    // 3 -- 2
+    static const glm::vec2 kQuadCorners[] = { {0.f, 0.f}, {1.f, 0.f}, {1.f, 1.f}, {0.f, 1.f} };
+    static const uint16_t kQuadIndexes[] = { 0, 1, 2, 0, 2, 3 };
+    mesh = renderSystem.CreateStaticMesh(instancedMeshDefinition,
+        {reinterpret_cast<const uint8_t*>(kQuadCorners), sizeof(kQuadCorners)},
+        Span<const uint16_t>{kQuadIndexes, std::extent_v<decltype(kQuadIndexes)>});
+    if (!mesh)
+    {
+        LSTG_LOG_ERROR_CAT(CommandExecutor, "Create instanced mesh fail: {}", mesh.GetError());
+        mesh.ThrowIfError();
+    }
+    m_pInstancedMesh = std::move(*mesh);
 }
 
 Result<void> CommandExecutor::Execute(CommandBuffer::DrawData& drawData) noexcept
@@ -427,6 +575,14 @@ Result<void> CommandExecutor::Execute(CommandBuffer::DrawData& drawData) noexcep
         LSTG_LOG_ERROR_CAT(CommandExecutor, "Commit mesh data fail: {}", ret.GetError());
         return ret.GetError();
     }
+    ret = m_pInstancedMesh->CommitInstances(
+        {reinterpret_cast<const uint8_t*>(drawData.InstanceBuffer.data()),
+            drawData.InstanceBuffer.size() * sizeof(drawData.InstanceBuffer[0])});
+    if (!ret)
+    {
+        LSTG_LOG_ERROR_CAT(CommandExecutor, "Commit instance data fail: {}", ret.GetError());
+        return ret.GetError();
+    }
 
     // 遍历命令
     m_uDrawCalls = 0;
@@ -561,7 +717,8 @@ void CommandExecutor::OnDrawQueue(CommandBuffer::DrawData& drawData, CommandBuff
         assert(cmd.MaterialId < drawData.MaterialList.size());
         auto mat = drawData.MaterialList[cmd.MaterialId];
         if (!mat) // 没有指定材质时，fallback 到默认材质
-            mat = m_pDefaultMaterial;
+            mat = cmd.Instanced ? m_pInstancedMaterial : m_pDefaultMaterial;
+        assert(!cmd.Instanced || mat == m_pInstancedMaterial);
 
         // 设置混合状态
         switch (cmd.ColorBlend)
@@ -613,9 +770,21 @@ void CommandExecutor::OnDrawQueue(CommandBuffer::DrawData& drawData, CommandBuff
 #undef SET_UNIFORM_WITH_LOG
 
         // 绘制
-        ret = m_stRenderSystem.Draw(m_pMesh.get(), cmd.IndexCount, cmd.BaseVertexIndex, cmd.IndexStart);
-        if (!ret)
-            LSTG_LOG_ERROR_CAT(CommandExecutor, "Draw index={}, start={} fail: {}", cmd.IndexCount, cmd.IndexStart, ret.GetError());
+        if (cmd.Instanced)
+        {
+            ret = m_stRenderSystem.DrawInstanced(m_pInstancedMesh.get(), 6, cmd.InstanceCount, cmd.InstanceStart);
+            if (!ret)
+            {
+                LSTG_LOG_ERROR_CAT(CommandExecutor, "Draw instance count={}, start={} fail: {}", cmd.InstanceCount, cmd.InstanceStart,
+                    ret.GetError());
+            }
+        }
+        else
+        {
+            ret = m_stRenderSystem.Draw(m_pMesh.get(), cmd.IndexCount, cmd.BaseVertexIndex, cmd.IndexStart);
+            if (!ret)
+                LSTG_LOG_ERROR_CAT(CommandExecutor, "Draw index={}, start={} fail: {}", cmd.IndexCount, cmd.IndexStart, ret.GetError());
+        }
         ++m_uDrawCalls;
     }
 }
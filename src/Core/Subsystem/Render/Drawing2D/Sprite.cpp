@@ -102,6 +102,67 @@ Result<SpriteDrawing> Sprite::Draw(CommandBuffer& buffer, std::optional<ColorBle
     return SpriteDrawing::Draw(buffer, m_pTexture ? m_pTexture->GetUnderlayTexture() : nullptr, m_stPrecomputedVertex);
 }
 
+Result<void> Sprite::DrawTransformed(CommandBuffer& buffer, glm::vec3 position, float rot, glm::vec2 scale,
+    std::optional<ColorBlendMode> blendModeOverride) const noexcept
+{
+    if (m_bInstancingCompatible && buffer.IsSpriteInstancingAvailable())
+    {
+        buffer.SetColorBlendMode(blendModeOverride ? *blendModeOverride : m_iBlendMode);
+
+        auto instance = m_stPrecomputedInstance;
+        instance.Position = position;
+        instance.Rotation = rot;
+        instance.Scale = scale;
+        return buffer.DrawSpriteInstance(m_pTexture ? m_pTexture->GetUnderlayTexture() : nullptr, instance);
+    }
+
+    auto draw = Draw(buffer, blendModeOverride);
+    if (!draw)
+        return draw.GetError();
+    draw->Transform(rot, scale.x, scale.y);
+    draw->Translate(position.x, position.y, position.z);
+    return {};
+}
+
+void Sprite::PrepareTransformed(PreparedSpriteDrawing& out, glm::vec3 position, float rot, glm::vec2 scale,
+    bool instancingAvailable) const noexcept
+{
+    if (m_bInstancingCompatible && instancingAvailable)
+    {
+        out.Instanced = true;
+        out.Instance = m_stPrecomputedInstance;
+        out.Instance.Position = position;
+        out.Instance.Rotation = rot;
+        out.Instance.Scale = scale;
+        return;
+    }
+
+    // 与 DrawTransformed 使用相同的变换过程，保证结果一致
+    out.Instanced = false;
+    out.Vertices = m_stPrecomputedVertex;
+    SpriteDrawing::Attach(Span<Vertex>(out.Vertices.data(), out.Vertices.size()))
+        .Transform(rot, scale.x, scale.y)
+        .Translate(position.x, position.y, position.z);
+}
+
+Result<void> Sprite::DrawPrepared(CommandBuffer& buffer, const PreparedSpriteDrawing& prepared,
+    std::optional<ColorBlendMode> blendModeOverride) const noexcept
+{
+    buffer.SetColorBlendMode(blendModeOverride ? *blendModeOverride : m_iBlendMode);
+
+    auto tex = m_pTexture ? m_pTexture->GetUnderlayTexture() : nullptr;
+    if (prepared.Instanced)
+    {
+        assert(buffer.IsSpriteInstancingAvailable());
+        return buffer.DrawSpriteInstance(std::move(tex), prepared.Instance);
+    }
+
+    auto ret = SpriteDrawing::Draw(buffer, std::move(tex), prepared.Vertices);
+    if (!ret)
+        return ret.GetError();
+    return {};
+}
+
 void Sprite::PrecomputedVertex(int what) noexcept
 {
     if ((what & SHAPE_CHANGED) == SHAPE_CHANGED)
@@ -116,6 +177,7 @@ void Sprite::PrecomputedVertex(int what) noexcept
         m_stPrecomputedVertex[1].Position = { w - cx, cy, 0.f };
         m_stPrecomputedVertex[2].Position = { w - cx, cy - h, 0.f };
         m_stPrecomputedVertex[3].Position = { -cx, cy - h, 0.f };
+        m_stPrecomputedInstance.Shape = { -cx, cy, w - cx, cy - h };
     }
 
     if (m_pTexture && (what & UV_CHANGED) == UV_CHANGED)
@@ -131,6 +193,7 @@ void Sprite::PrecomputedVertex(int what) noexcept
         m_stPrecomputedVertex[1].TexCoord = { u + uw, v };
         m_stPrecomputedVertex[2].TexCoord = { u + uw, v + vh };
         m_stPrecomputedVertex[3].TexCoord = { u, v + vh };
+        m_stPrecomputedInstance.TexRect = { u, v, u + uw, v + vh };
     }
 
     if ((what & ADDITIVE_COLOR_CHANGED) == ADDITIVE_COLOR_CHANGED)
@@ -147,4 +210,16 @@ void Sprite::PrecomputedVertex(int what) noexcept
         m_stPrecomputedVertex[2].Color1 = m_stMultiplyBlendColor[2];
         m_stPrecomputedVertex[3].Color1 = m_stMultiplyBlendColor[3];
     }
+
+    if ((what & (ADDITIVE_COLOR_CHANGED | MULTIPLY_COLOR_CHANGED)) != 0)
+    {
+        m_stPrecomputedInstance.Color0 = m_stAdditiveBlendColor[0];
+        m_stPrecomputedInstance.Color1 = m_stMultiplyBlendColor[0];
+        m_bInstancingCompatible = true;
+        for (size_t i = 1; i < 4; ++i)
+        {
+            if (m_stAdditiveBlendColor[i] != m_stAdditiveBlendColor[0] || m_stMultiplyBlendColor[i] != m_stMultiplyBlendColor[0])
+                m_bInstancingCompatible = false;
+        }
+    }
 }
@@ -7,6 +7,9 @@
 #include "FreeTypeStream.hpp"
 
 #include <lstg/Core/Logging.hpp>
+#include <lstg/Core/Subsystem/VFS/ContainerStream.hpp>
+#include <lstg/Core/Subsystem/VFS/InflateStream.hpp>
+#include <lstg/Core/Subsystem/VFS/BlockCacheStream.hpp>
 
 using namespace std;
 using namespace lstg;
@@ -59,6 +62,14 @@ void FreeTypeStream::OnClose(FT_Stream stream) noexcept
 FreeTypeStream::FreeTypeStream(VFS::StreamPtr s)
 {
     // 将输入流转换到可以随机访问的内存流
+    // 解压流虽然可以随机访问，但 FreeType 会频繁地在字体表之间跳转，每次回退都需要从检查点重新解压，因此仍然整体载入内存
+    // 经过块缓存的解压流同理，字体存活期间的访问不应依赖缓存是否被淘汰
+    if (dynamic_cast<VFS::InflateStream*>(s.get()) || dynamic_cast<VFS::BlockCacheStream*>(s.get()))
+    {
+        auto memoryStream = make_shared<VFS::MemoryStream>();
+        VFS::ReadAll(memoryStream->GetContainer(), s.get()).ThrowIfError();
+        s = std::move(memoryStream);
+    }
     Stream = ConvertToSeekableStream(std::move(s)).ThrowIfError();
     assert(Stream->IsSeekable() && Stream->GetLength());
 
@@ -89,6 +100,14 @@ FreeTypeStream::FreeTypeStream(VFS::StreamPtr s)
     // 回调
     read = OnRead;
     close = OnClose;
+
+    // 流位于内存中（例如内存映射的文件）时，交给 FreeType 直接访问，Stream 仅用于保持内存的生命周期
+    auto view = Stream->GetMemoryView();
+    if (view && view->GetSize() == size)
+    {
+        base = const_cast<unsigned char*>(view->GetData());
+        read = nullptr;
+    }
 }
 
 void FreeTypeStream::RefreshPosition() noexcept
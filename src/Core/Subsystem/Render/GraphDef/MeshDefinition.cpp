@@ -18,44 +18,63 @@ bool MeshDefinition::operator==(const MeshDefinition& def) const noexcept
 {
     return m_iTopologyType == def.m_iTopologyType &&
         m_iVertexStride == def.m_iVertexStride &&
-        m_stVertexElements == def.m_stVertexElements;
+        m_stVertexElements == def.m_stVertexElements &&
+        m_iInstanceStride == def.m_iInstanceStride &&
+        m_stInstanceElements == def.m_stInstanceElements;
 }
 
-Result<void> MeshDefinition::AddVertexElement(VertexElementType type, VertexElementSemantic semantic, size_t offset) noexcept
+namespace
 {
-    if (ContainsSemantic(semantic))
-        return make_error_code(DefinitionError::SymbolAlreadyDefined);
-
-    try
+    Result<void> InsertElementSortedByOffset(std::vector<MeshDefinition::VertexElement>& elements, MeshDefinition::VertexElementType type,
+        MeshDefinition::VertexElementSemantic semantic, size_t offset) noexcept
     {
-        // 我们按照 Offset 排序
-        auto it = std::lower_bound(m_stVertexElements.begin(), m_stVertexElements.end(), offset, [](const VertexElement& e, size_t offset) {
-            return e.Offset < offset;
-        });
+        try
+        {
+            // 我们按照 Offset 排序
+            auto it = std::lower_bound(elements.begin(), elements.end(), offset, [](const MeshDefinition::VertexElement& e, size_t offset) {
+                return e.Offset < offset;
+            });
 
-        VertexElement target;
-        target.Type = type;
-        target.Semantic = semantic;
-        target.Offset = offset;
+            MeshDefinition::VertexElement target;
+            target.Type = type;
+            target.Semantic = semantic;
+            target.Offset = offset;
 
-        if (it == m_stVertexElements.end())
-        {
-            m_stVertexElements.emplace_back(std::move(target));
+            if (it == elements.end())
+            {
+                elements.emplace_back(std::move(target));
+            }
+            else
+            {
+                // 不允许出现重叠
+                assert(it->Offset > offset);
+                elements.insert(it, std::move(target));
+            }
+            return {};
         }
-        else
+        catch (...)
         {
-            // 不允许出现重叠
-            assert(it->Offset > offset);
-            m_stVertexElements.insert(it, std::move(target));
+            return make_error_code(errc::not_enough_memory);
         }
-        return {};
-    }
-    catch (...)
-    {
-        return make_error_code(errc::not_enough_memory);
     }
 }
 
+Result<void> MeshDefinition::AddVertexElement(VertexElementType type, VertexElementSemantic semantic, size_t offset) noexcept
+{
+    if (ContainsSemantic(semantic))
+        return make_error_code(DefinitionError::SymbolAlreadyDefined);
+
+    return InsertElementSortedByOffset(m_stVertexElements, type, semantic, offset);
+}
+
+Result<void> MeshDefinition::AddInstanceElement(VertexElementType type, VertexElementSemantic semantic, size_t offset) noexcept
+{
+    if (ContainsSemantic(semantic))
+        return make_error_code(DefinitionError::SymbolAlreadyDefined);
+
+    return InsertElementSortedByOffset(m_stInstanceElements, type, semantic, offset);
+}
+
 bool MeshDefinition::ContainsSemantic(VertexElementSemantic semantic) const noexcept
 {
     for (const auto& e : m_stVertexElements)
@@ -63,6 +82,11 @@ bool MeshDefinition::ContainsSemantic(VertexElementSemantic semantic) const noex
         if (e.Semantic == semantic)
             return true;
     }
+    for (const auto& e : m_stInstanceElements)
+    {
+        if (e.Semantic == semantic)
+            return true;
+    }
     return false;
 }
 
@@ -79,5 +103,14 @@ size_t MeshDefinition::GetHashCode() const noexcept
         ret ^= std::hash<uint8_t>{}(std::get<1>(e.Semantic));
         ret ^= std::hash<size_t>{}(e.Offset);
     }
+    ret ^= std::hash<size_t>{}(m_iInstanceStride);
+    for (const auto& e : m_stInstanceElements)
+    {
+        ret ^= std::hash<VertexElementScalarTypes>{}(std::get<0>(e.Type));
+        ret ^= std::hash<VertexElementComponents>{}(std::get<1>(e.Type));
+        ret ^= std::hash<VertexElementSemanticNames>{}(std::get<0>(e.Semantic));
+        ret ^= std::hash<uint8_t>{}(std::get<1>(e.Semantic));
+        ret ^= std::hash<size_t>{}(e.Offset) * 31;
+    }
     return ret;
 }
@@ -55,6 +55,11 @@ Mesh::~Mesh()
         m_pIndexBuffer->Release();
         m_pIndexBuffer = nullptr;
     }
+    if (m_pInstanceBuffer)
+    {
+        m_pInstanceBuffer->Release();
+        m_pInstanceBuffer = nullptr;
+    }
 }
 
 size_t Mesh::GetVertexCount() const noexcept
@@ -150,3 +155,54 @@ Result<void> Mesh::Commit(Span<const uint8_t> vertexData, Span<const uint8_t> in
     }
     return {};
 }
+
+Result<void> Mesh::CommitInstances(Span<const uint8_t> instanceData) noexcept
+{
+    // 参数检查
+    auto stride = m_pDefinition->GetInstanceStride();
+    if (stride == 0)
+        return make_error_code(errc::invalid_argument);
+    if (instanceData.size() % stride != 0)
+        return make_error_code(errc::invalid_argument);
+    if (instanceData.size() == 0)
+        return {};
+
+    // 检查是否需要申请更大的空间
+    if (!m_pInstanceBuffer || m_pInstanceBuffer->GetDesc().Size < instanceData.size())
+    {
+        Diligent::RefCntAutoPtr<Diligent::IBuffer> instanceBuffer;
+
+        // 计算需要的大小，总是取 2 的幂次
+        auto desiredSize = ::max(16u, ::NextPowerOf2(instanceData.size()));
+        assert(!m_pInstanceBuffer || desiredSize > m_pInstanceBuffer->GetDesc().Size);
+
+        Diligent::BufferDesc instanceBufferDesc;
+        instanceBufferDesc.Name = m_pInstanceBuffer ? m_pInstanceBuffer->GetDesc().Name : "";
+        instanceBufferDesc.BindFlags = Diligent::BIND_VERTEX_BUFFER;
+        instanceBufferDesc.Size = desiredSize;
+        instanceBufferDesc.Usage = Diligent::USAGE_DYNAMIC;
+        instanceBufferDesc.CPUAccessFlags = Diligent::CPU_ACCESS_WRITE;
+        m_stDevice.GetDevice()->CreateBuffer(instanceBufferDesc, nullptr, &instanceBuffer);
+        if (!instanceBuffer)
+            return make_error_code(errc::io_error);
+
+        if (m_pInstanceBuffer)
+            m_pInstanceBuffer->Release();
+        m_pInstanceBuffer = instanceBuffer;
+        m_pInstanceBuffer->AddRef();
+    }
+
+    // 复制数据
+    {
+        assert(m_pInstanceBuffer && m_pInstanceBuffer->GetDesc().Size >= instanceData.size());
+        auto context = m_stDevice.GetImmediateContext();
+
+        void* data = nullptr;
+        context->MapBuffer(m_pInstanceBuffer, Diligent::MAP_WRITE, Diligent::MAP_FLAG_DISCARD, data);
+        if (!data)
+            return make_error_code(errc::io_error);
+        ::memcpy(data, instanceData.data(), instanceData.size());
+        context->UnmapBuffer(m_pInstanceBuffer, Diligent::MAP_WRITE);
+    }
+    return {};
+}
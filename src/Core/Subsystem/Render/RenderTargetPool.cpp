@@ -0,0 +1,99 @@
+/**
+ * @file
+ * @date 2022/8/20
+ * @author 9chu
+ * 此文件为 LuaSTGPlus 项目的一部分，版权与许可声明详见 COPYRIGHT.txt。
+ */
+#include <lstg/Core/Subsystem/Render/RenderTargetPool.hpp>
+
+#include <cassert>
+#include <algorithm>
+
+using namespace std;
+using namespace lstg;
+using namespace lstg::Subsystem::Render;
+
+RenderTargetPool::RenderTargetPool(uint32_t maxIdleFrames)
+    : m_uMaxIdleFrames(maxIdleFrames)
+{
+}
+
+TexturePtr RenderTargetPool::TryAcquire(const Key& key) noexcept
+{
+    for (auto& e : m_stEntries)
+    {
+        if (e.PoolKey == key && e.IsFree())
+        {
+            e.LastUsedFrame = m_ullFrame;
+            ++m_uReusedCounter;
+            return e.Texture;
+        }
+    }
+    return nullptr;
+}
+
+Result<void> RenderTargetPool::Add(const Key& key, TexturePtr texture, size_t bytes) noexcept
+{
+    assert(texture);
+    try
+    {
+        m_stEntries.emplace_back(Entry { key, std::move(texture), bytes, m_ullFrame });
+    }
+    catch (...)  // bad_alloc
+    {
+        return make_error_code(errc::not_enough_memory);
+    }
+    ++m_uCreatedCounter;
+
+    // 更新峰值
+    size_t total = 0;
+    for (const auto& e : m_stEntries)
+        total += e.Bytes;
+    m_stStatistics.PeakBytes = std::max(m_stStatistics.PeakBytes, total);
+    return {};
+}
+
+void RenderTargetPool::NewFrame() noexcept
+{
+    size_t released = 0;
+    size_t pooledBytes = 0;
+    size_t inUseBytes = 0;
+
+    auto it = m_stEntries.begin();
+    while (it != m_stEntries.end())
+    {
+        if (!it->IsFree())
+        {
+            // 仍被外部持有，刷新使用时间
+            it->LastUsedFrame = m_ullFrame;
+            inUseBytes += it->Bytes;
+        }
+        else if (m_ullFrame - it->LastUsedFrame >= m_uMaxIdleFrames)
+        {
+            // 空闲过久，释放
+            it = m_stEntries.erase(it);
+            ++released;
+            continue;
+        }
+        pooledBytes += it->Bytes;
+        ++it;
+    }
+
+    m_stStatistics.PooledCount = m_stEntries.size();
+    m_stStatistics.PooledBytes = pooledBytes;
+    m_stStatistics.InUseBytes = inUseBytes;
+    m_stStatistics.PeakBytes = std::max(m_stStatistics.PeakBytes, pooledBytes);
+    m_stStatistics.CreatedInFrame = m_uCreatedCounter;
+    m_stStatistics.ReusedInFrame = m_uReusedCounter;
+    m_stStatistics.ReleasedInFrame = released;
+    m_uCreatedCounter = 0;
+    m_uReusedCounter = 0;
+
+    ++m_ullFrame;
+}
+
+void RenderTargetPool::Purge() noexcept
+{
+    auto it = std::remove_if(m_stEntries.begin(), m_stEntries.end(), [](const Entry& e) { return e.IsFree(); });
+    m_stEntries.erase(it, m_stEntries.end());
+}
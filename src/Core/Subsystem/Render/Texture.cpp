@@ -103,6 +103,13 @@ Result<void> Texture::Commit(Math::ImageRectangle range, Span<const uint8_t> dat
         return make_error_code(errc::invalid_argument);
     }
 
+    // 块压缩格式无法按像素更新
+    if (Render::detail::IsBlockCompressed(Render::detail::FromDiligent(desc.Format)))
+    {
+        LSTG_LOG_ERROR_CAT(Texture, "Cannot commit pixels to block compressed texture");
+        return make_error_code(errc::not_supported);
+    }
+
     // 检查范围
     Diligent::Box updateRange;
     updateRange.MinX = std::min<uint32_t>(desc.Width, range.Left());
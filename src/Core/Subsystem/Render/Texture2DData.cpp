@@ -61,6 +61,18 @@ Texture2DFormats Texture2DData::GetFormat() const noexcept
     return m_pImpl->GetFormat();
 }
 
+bool Texture2DData::IsCompressed() const noexcept
+{
+    assert(m_pImpl);
+    return m_pImpl->IsCompressed();
+}
+
+size_t Texture2DData::GetMipLevels() const noexcept
+{
+    assert(m_pImpl);
+    return m_pImpl->GetMipLevels();
+}
+
 Span<const uint8_t> Texture2DData::GetBuffer() const noexcept
 {
     assert(m_pImpl);
@@ -6,11 +6,14 @@
  */
 #include "Texture2DDataImpl.hpp"
 
+#include <cstring>
+#include <limits>
 #include <stb_image.h>
 #include <GraphicsAccessories.hpp>
 #include <GraphicsUtilities.h>
 #include <lstg/Core/Logging.hpp>
 #include <lstg/Core/Subsystem/VFS/ContainerStream.hpp>
+#include <lstg/Core/Subsystem/VFS/BufferedStream.hpp>
 
 using namespace std;
 using namespace lstg;
@@ -63,6 +66,78 @@ namespace
     };
 
     using StbImageMemoryPtr = std::unique_ptr<uint8_t, StbImageMemoryDeleter>;
+
+    // <editor-fold desc="容器格式">
+
+    const uint8_t kDDSMagic[] = { 'D', 'D', 'S', ' ' };
+    const uint8_t kKTX2Magic[] = { 0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, '\r', '\n', 0x1A, '\n' };
+
+    const size_t kDDSHeaderSize = 4 + 124;
+    const size_t kDDSHeaderDX10Size = 20;
+    const uint32_t kDDSPixelFormatFourCC = 0x4;
+    const uint32_t kDDSPixelFormatRGB = 0x40;
+    const uint32_t kDDSCaps2CubeMap = 0x200;
+    const uint32_t kDDSDimensionTexture2D = 3;
+
+    const size_t kKTX2HeaderSize = 80;
+    const size_t kKTX2LevelIndexSize = 24;
+
+    constexpr uint32_t MakeFourCC(char a, char b, char c, char d) noexcept
+    {
+        return static_cast<uint32_t>(static_cast<uint8_t>(a)) | (static_cast<uint32_t>(static_cast<uint8_t>(b)) << 8u) |
+            (static_cast<uint32_t>(static_cast<uint8_t>(c)) << 16u) | (static_cast<uint32_t>(static_cast<uint8_t>(d)) << 24u);
+    }
+
+    uint32_t LoadUInt32LE(const uint8_t* p) noexcept
+    {
+        return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8u) | (static_cast<uint32_t>(p[2]) << 16u) |
+            (static_cast<uint32_t>(p[3]) << 24u);
+    }
+
+    uint64_t LoadUInt64LE(const uint8_t* p) noexcept
+    {
+        return static_cast<uint64_t>(LoadUInt32LE(p)) | (static_cast<uint64_t>(LoadUInt32LE(p + 4)) << 32u);
+    }
+
+    Diligent::TEXTURE_FORMAT DXGIFormatToDiligent(uint32_t format) noexcept
+    {
+        switch (format)
+        {
+            case 28: return Diligent::TEX_FORMAT_RGBA8_UNORM;  // DXGI_FORMAT_R8G8B8A8_UNORM
+            case 29: return Diligent::TEX_FORMAT_RGBA8_UNORM_SRGB;  // DXGI_FORMAT_R8G8B8A8_UNORM_SRGB
+            case 71: return Diligent::TEX_FORMAT_BC1_UNORM;  // DXGI_FORMAT_BC1_UNORM
+            case 72: return Diligent::TEX_FORMAT_BC1_UNORM_SRGB;  // DXGI_FORMAT_BC1_UNORM_SRGB
+            case 74: return Diligent::TEX_FORMAT_BC2_UNORM;  // DXGI_FORMAT_BC2_UNORM
+            case 75: return Diligent::TEX_FORMAT_BC2_UNORM_SRGB;  // DXGI_FORMAT_BC2_UNORM_SRGB
+            case 77: return Diligent::TEX_FORMAT_BC3_UNORM;  // DXGI_FORMAT_BC3_UNORM
+            case 78: return Diligent::TEX_FORMAT_BC3_UNORM_SRGB;  // DXGI_FORMAT_BC3_UNORM_SRGB
+            case 98: return Diligent::TEX_FORMAT_BC7_UNORM;  // DXGI_FORMAT_BC7_UNORM
+            case 99: return Diligent::TEX_FORMAT_BC7_UNORM_SRGB;  // DXGI_FORMAT_BC7_UNORM_SRGB
+            default: return Diligent::TEX_FORMAT_UNKNOWN;
+        }
+    }
+
+    Diligent::TEXTURE_FORMAT VkFormatToDiligent(uint32_t format) noexcept
+    {
+        switch (format)
+        {
+            case 37: return Diligent::TEX_FORMAT_RGBA8_UNORM;  // VK_FORMAT_R8G8B8A8_UNORM
+            case 43: return Diligent::TEX_FORMAT_RGBA8_UNORM_SRGB;  // VK_FORMAT_R8G8B8A8_SRGB
+            case 131:  // VK_FORMAT_BC1_RGB_UNORM_BLOCK
+            case 133: return Diligent::TEX_FORMAT_BC1_UNORM;  // VK_FORMAT_BC1_RGBA_UNORM_BLOCK
+            case 132:  // VK_FORMAT_BC1_RGB_SRGB_BLOCK
+            case 134: return Diligent::TEX_FORMAT_BC1_UNORM_SRGB;  // VK_FORMAT_BC1_RGBA_SRGB_BLOCK
+            case 135: return Diligent::TEX_FORMAT_BC2_UNORM;  // VK_FORMAT_BC2_UNORM_BLOCK
+            case 136: return Diligent::TEX_FORMAT_BC2_UNORM_SRGB;  // VK_FORMAT_BC2_SRGB_BLOCK
+            case 137: return Diligent::TEX_FORMAT_BC3_UNORM;  // VK_FORMAT_BC3_UNORM_BLOCK
+            case 138: return Diligent::TEX_FORMAT_BC3_UNORM_SRGB;  // VK_FORMAT_BC3_SRGB_BLOCK
+            case 145: return Diligent::TEX_FORMAT_BC7_UNORM;  // VK_FORMAT_BC7_UNORM_BLOCK
+            case 146: return Diligent::TEX_FORMAT_BC7_UNORM_SRGB;  // VK_FORMAT_BC7_SRGB_BLOCK
+            default: return Diligent::TEX_FORMAT_UNKNOWN;
+        }
+    }
+
+    // </editor-fold>
 }
 
 Result<void> Texture2DDataImpl::ReadImageInfoFromStream(uint32_t& width, uint32_t& height, VFS::StreamPtr stream) noexcept
@@ -71,6 +146,32 @@ Result<void> Texture2DDataImpl::ReadImageInfoFromStream(uint32_t& width, uint32_
     if (!seekableStream)
         return seekableStream.GetError();
 
+    // 容器格式直接从头部读取
+    {
+        uint8_t header[kDDSHeaderSize] = {};
+        auto position = (*seekableStream)->GetPosition();
+        if (!position)
+            return position.GetError();
+        auto read = (*seekableStream)->Read(header, sizeof(header));
+        if (!read)
+            return read.GetError();
+        if (*read >= 32 && ::memcmp(header, kDDSMagic, sizeof(kDDSMagic)) == 0)
+        {
+            height = LoadUInt32LE(header + 12);
+            width = LoadUInt32LE(header + 16);
+            return {};
+        }
+        if (*read >= 32 && ::memcmp(header, kKTX2Magic, sizeof(kKTX2Magic)) == 0)
+        {
+            width = LoadUInt32LE(header + 20);
+            height = LoadUInt32LE(header + 24);
+            return {};
+        }
+        auto seek = (*seekableStream)->Seek(static_cast<int64_t>(*position), VFS::StreamSeekOrigins::Begin);
+        if (!seek)
+            return seek.GetError();
+    }
+
     ::stbi_io_callbacks callbacks {
         StbImageReadStreamBridge,
         StbImageSkipStreamBridge,
@@ -94,6 +195,39 @@ Texture2DDataImpl::Texture2DDataImpl(VFS::StreamPtr stream, bool convertToRGBA32
     auto seekableStream = ConvertToSeekableStream(std::move(stream));
     seekableStream.ThrowIfError();
 
+    // 检查是否为预烘焙的容器格式
+    {
+        uint8_t magic[sizeof(kKTX2Magic)] = {};
+        auto position = (*seekableStream)->GetPosition();
+        position.ThrowIfError();
+        auto read = (*seekableStream)->Read(magic, sizeof(magic));
+        read.ThrowIfError();
+        auto seek = (*seekableStream)->Seek(static_cast<int64_t>(*position), VFS::StreamSeekOrigins::Begin);
+        seek.ThrowIfError();
+
+        auto isDDS = (*read >= sizeof(kDDSMagic) && ::memcmp(magic, kDDSMagic, sizeof(kDDSMagic)) == 0);
+        auto isKTX2 = (*read >= sizeof(kKTX2Magic) && ::memcmp(magic, kKTX2Magic, sizeof(kKTX2Magic)) == 0);
+        if (isDDS || isKTX2)
+        {
+            // 内存映射的流直接解析，不产生中间拷贝
+            vector<uint8_t> storage;
+            if (!(*seekableStream)->GetMemoryView())
+            {
+                auto length = (*seekableStream)->GetLength();
+                if (length && *length > *position)
+                    storage.reserve(static_cast<size_t>(*length - *position));
+            }
+            auto content = VFS::ReadAllView(storage, seekableStream->get());
+            content.ThrowIfError();
+
+            if (isDDS)
+                LoadFromDDS(*content);
+            else
+                LoadFromKTX2(*content);
+            return;
+        }
+    }
+
     // 解码图像
     int x, y, channels;
     StbImageMemoryPtr data;
@@ -102,10 +236,26 @@ Texture2DDataImpl::Texture2DDataImpl(VFS::StreamPtr stream, bool convertToRGBA32
         StbImageSkipStreamBridge,
         StbImageIsEofStreamBridge,
     };
-    data.reset(::stbi_load_from_callbacks(&callbacks, seekableStream->get(), &x, &y, &channels, 0));
+    auto view = (*seekableStream)->GetMemoryView();
+    if (view)
+    {
+        // 内存映射的流直接交给 stb_image 解码
+        auto position = (*seekableStream)->GetPosition();
+        position.ThrowIfError();
+        auto offset = static_cast<size_t>(std::min<uint64_t>(*position, view->GetSize()));
+        auto size = std::min<size_t>(view->GetSize() - offset, static_cast<size_t>(std::numeric_limits<int>::max()));
+        data.reset(::stbi_load_from_memory(view->GetData() + offset, static_cast<int>(size), &x, &y, &channels, 0));
+    }
+    else
+    {
+        // stb_image 每次只通过回调读取很少的数据，经过缓冲后再交给底层流
+        auto bufferedStream = VFS::MakeBufferedStream(std::move(*seekableStream));
+        bufferedStream.ThrowIfError();
+        data.reset(::stbi_load_from_callbacks(&callbacks, bufferedStream->get(), &x, &y, &channels, 0));
+    }
     if (!data)
     {
-        LSTG_LOG_ERROR_CAT(Texture2DDataImpl, "stbi_load_from_callbacks fail: {}", ::stbi_failure_reason());
+        LSTG_LOG_ERROR_CAT(Texture2DDataImpl, "stbi_load fail: {}", ::stbi_failure_reason());
         throw system_error(make_error_code(errc::io_error));
     }
 
@@ -201,6 +351,10 @@ Texture2DDataImpl::Texture2DDataImpl(VFS::StreamPtr stream, bool convertToRGBA32
 
 Texture2DDataImpl::Texture2DDataImpl(uint32_t width, uint32_t height, Texture2DFormats format)
 {
+    // 块压缩格式只能从容器加载
+    if (IsBlockCompressed(format))
+        throw system_error(make_error_code(errc::invalid_argument));
+
     // 填充图像大小和位深
     auto componentSize = GetPixelComponentSize(format);
     m_stDesc.Type = Diligent::RESOURCE_DIM_TEX_2D;
@@ -229,6 +383,11 @@ Subsystem::Render::Texture2DFormats Texture2DDataImpl::GetFormat() const noexcep
     return FromDiligent(m_stDesc.Format);
 }
 
+bool Texture2DDataImpl::IsCompressed() const noexcept
+{
+    return IsBlockCompressed(GetFormat());
+}
+
 Span<const uint8_t> Texture2DDataImpl::GetBuffer() const noexcept
 {
     assert(!m_stMipMaps.empty());
@@ -256,6 +415,18 @@ Result<void> Texture2DDataImpl::GenerateMipmap(size_t count) noexcept
         return {};  // ignore
     }
 
+    // 块压缩格式无法在 CPU 上生成 mipmap，只能使用容器中预计算的数据
+    if (IsCompressed())
+    {
+        if (m_stSubResources.size() >= mipLevels)
+        {
+            m_stSubResources.resize(mipLevels);
+            m_stMipMaps.resize(mipLevels);
+            return {};
+        }
+        return make_error_code(errc::not_supported);
+    }
+
     // 生成 mipmap
     try
     {
@@ -296,3 +467,187 @@ Result<void> Texture2DDataImpl::GenerateMipmap(size_t count) noexcept
         return make_error_code(errc::not_enough_memory);
     }
 }
+
+void Texture2DDataImpl::LoadFromDDS(Span<const uint8_t> content)
+{
+    if (content.GetSize() < kDDSHeaderSize || LoadUInt32LE(content.GetData() + 4) != 124)
+    {
+        LSTG_LOG_ERROR_CAT(Texture2DDataImpl, "Invalid DDS header");
+        throw system_error(make_error_code(errc::invalid_argument));
+    }
+
+    auto header = content.GetData();
+    auto height = LoadUInt32LE(header + 12);
+    auto width = LoadUInt32LE(header + 16);
+    auto mipCount = std::max<uint32_t>(1u, LoadUInt32LE(header + 28));
+    auto pixelFormatFlags = LoadUInt32LE(header + 80);
+    auto fourCC = LoadUInt32LE(header + 84);
+    auto caps2 = LoadUInt32LE(header + 112);
+    if ((caps2 & kDDSCaps2CubeMap) != 0)
+    {
+        LSTG_LOG_ERROR_CAT(Texture2DDataImpl, "DDS cube map is not supported");
+        throw system_error(make_error_code(errc::not_supported));
+    }
+
+    // 解析像素格式
+    // 旧式 FourCC 没有色彩空间信息，与 stb_image 解码路径保持一致，视作 sRGB
+    auto format = Diligent::TEX_FORMAT_UNKNOWN;
+    size_t dataOffset = kDDSHeaderSize;
+    if ((pixelFormatFlags & kDDSPixelFormatFourCC) != 0)
+    {
+        if (fourCC == MakeFourCC('D', 'X', '1', '0'))
+        {
+            if (content.GetSize() < kDDSHeaderSize + kDDSHeaderDX10Size)
+            {
+                LSTG_LOG_ERROR_CAT(Texture2DDataImpl, "Invalid DDS DX10 header");
+                throw system_error(make_error_code(errc::invalid_argument));
+            }
+            auto dx10Header = header + kDDSHeaderSize;
+            auto dimension = LoadUInt32LE(dx10Header + 4);
+            auto arraySize = LoadUInt32LE(dx10Header + 12);
+            if (dimension != kDDSDimensionTexture2D || arraySize > 1)
+            {
+                LSTG_LOG_ERROR_CAT(Texture2DDataImpl, "Only single 2D texture is supported in DDS, dimension={}, arraySize={}",
+                    dimension, arraySize);
+                throw system_error(make_error_code(errc::not_supported));
+            }
+            format = DXGIFormatToDiligent(LoadUInt32LE(dx10Header));
+            dataOffset += kDDSHeaderDX10Size;
+        }
+        else if (fourCC == MakeFourCC('D', 'X', 'T', '1'))
+        {
+            format = Diligent::TEX_FORMAT_BC1_UNORM_SRGB;
+        }
+        else if (fourCC == MakeFourCC('D', 'X', 'T', '2') || fourCC == MakeFourCC('D', 'X', 'T', '3'))
+        {
+            format = Diligent::TEX_FORMAT_BC2_UNORM_SRGB;
+        }
+        else if (fourCC == MakeFourCC('D', 'X', 'T', '4') || fourCC == MakeFourCC('D', 'X', 'T', '5'))
+        {
+            format = Diligent::TEX_FORMAT_BC3_UNORM_SRGB;
+        }
+    }
+    else if ((pixelFormatFlags & kDDSPixelFormatRGB) != 0)
+    {
+        // 仅支持内存布局为 RGBA 的 32 位格式
+        auto bitCount = LoadUInt32LE(header + 88);
+        auto rMask = LoadUInt32LE(header + 92);
+        auto gMask = LoadUInt32LE(header + 96);
+        auto bMask = LoadUInt32LE(header + 100);
+        if (bitCount == 32 && rMask == 0x000000FFu && gMask == 0x0000FF00u && bMask == 0x00FF0000u)
+            format = Diligent::TEX_FORMAT_RGBA8_UNORM_SRGB;
+    }
+    if (format == Diligent::TEX_FORMAT_UNKNOWN)
+    {
+        LSTG_LOG_ERROR_CAT(Texture2DDataImpl, "Unsupported DDS pixel format, flags={}, fourCC={:#x}", pixelFormatFlags, fourCC);
+        throw system_error(make_error_code(errc::not_supported));
+    }
+
+    m_stDesc.Type = Diligent::RESOURCE_DIM_TEX_2D;
+    m_stDesc.Width = width;
+    m_stDesc.Height = height;
+    m_stDesc.Format = format;
+
+    // DDS 中各层 mipmap 紧密排列
+    vector<uint64_t> levelOffsets;
+    levelOffsets.reserve(mipCount);
+    uint64_t offset = dataOffset;
+    for (uint32_t m = 0; m < mipCount; ++m)
+    {
+        levelOffsets.push_back(offset);
+        offset += Diligent::GetMipLevelProperties(m_stDesc, m).MipSize;
+    }
+    LoadMipChain(content, levelOffsets);
+}
+
+void Texture2DDataImpl::LoadFromKTX2(Span<const uint8_t> content)
+{
+    if (content.GetSize() < kKTX2HeaderSize)
+    {
+        LSTG_LOG_ERROR_CAT(Texture2DDataImpl, "Invalid KTX2 header");
+        throw system_error(make_error_code(errc::invalid_argument));
+    }
+
+    auto header = content.GetData();
+    auto vkFormat = LoadUInt32LE(header + 12);
+    auto width = LoadUInt32LE(header + 20);
+    auto height = LoadUInt32LE(header + 24);
+    auto depth = LoadUInt32LE(header + 28);
+    auto layerCount = LoadUInt32LE(header + 32);
+    auto faceCount = LoadUInt32LE(header + 36);
+    auto levelCount = std::max<uint32_t>(1u, LoadUInt32LE(header + 40));
+    auto supercompressionScheme = LoadUInt32LE(header + 44);
+    if (depth > 1 || layerCount > 1 || faceCount != 1)
+    {
+        LSTG_LOG_ERROR_CAT(Texture2DDataImpl, "Only single 2D texture is supported in KTX2, depth={}, layers={}, faces={}",
+            depth, layerCount, faceCount);
+        throw system_error(make_error_code(errc::not_supported));
+    }
+    if (supercompressionScheme != 0)
+    {
+        LSTG_LOG_ERROR_CAT(Texture2DDataImpl, "KTX2 supercompression scheme {} is not supported", supercompressionScheme);
+        throw system_error(make_error_code(errc::not_supported));
+    }
+    auto format = VkFormatToDiligent(vkFormat);
+    if (format == Diligent::TEX_FORMAT_UNKNOWN)
+    {
+        LSTG_LOG_ERROR_CAT(Texture2DDataImpl, "Unsupported KTX2 vkFormat {}", vkFormat);
+        throw system_error(make_error_code(errc::not_supported));
+    }
+    if (content.GetSize() < kKTX2HeaderSize + kKTX2LevelIndexSize * levelCount)
+    {
+        LSTG_LOG_ERROR_CAT(Texture2DDataImpl, "Invalid KTX2 level index");
+        throw system_error(make_error_code(errc::invalid_argument));
+    }
+
+    m_stDesc.Type = Diligent::RESOURCE_DIM_TEX_2D;
+    m_stDesc.Width = width;
+    m_stDesc.Height = height;
+    m_stDesc.Format = format;
+
+    // 读取 Level Index，第 0 项总是最大的一层
+    vector<uint64_t> levelOffsets;
+    levelOffsets.reserve(levelCount);
+    for (uint32_t m = 0; m < levelCount; ++m)
+    {
+        auto levelIndex = header + kKTX2HeaderSize + kKTX2LevelIndexSize * m;
+        auto byteLength = LoadUInt64LE(levelIndex + 8);
+        if (byteLength != Diligent::GetMipLevelProperties(m_stDesc, m).MipSize)
+        {
+            LSTG_LOG_ERROR_CAT(Texture2DDataImpl, "Unexpected KTX2 level size {} at level {}", byteLength, m);
+            throw system_error(make_error_code(errc::invalid_argument));
+        }
+        levelOffsets.push_back(LoadUInt64LE(levelIndex));
+    }
+    LoadMipChain(content, levelOffsets);
+}
+
+void Texture2DDataImpl::LoadMipChain(Span<const uint8_t> content, const std::vector<uint64_t>& levelOffsets)
+{
+    assert(!levelOffsets.empty());
+    if (m_stDesc.Width == 0 || m_stDesc.Height == 0 ||
+        levelOffsets.size() > Diligent::ComputeMipLevelsCount(m_stDesc.Width, m_stDesc.Height))
+    {
+        LSTG_LOG_ERROR_CAT(Texture2DDataImpl, "Invalid texture size {}x{} with {} mip levels", m_stDesc.Width, m_stDesc.Height,
+            levelOffsets.size());
+        throw system_error(make_error_code(errc::invalid_argument));
+    }
+
+    m_stSubResources.resize(levelOffsets.size());
+    m_stMipMaps.resize(levelOffsets.size());
+    for (size_t m = 0; m < levelOffsets.size(); ++m)
+    {
+        auto mipLevelProps = Diligent::GetMipLevelProperties(m_stDesc, static_cast<uint32_t>(m));
+        auto offset = levelOffsets[m];
+        auto size = mipLevelProps.MipSize;
+        if (offset > content.GetSize() || size > content.GetSize() - offset)
+        {
+            LSTG_LOG_ERROR_CAT(Texture2DDataImpl, "Mip level {} out of range, offset={}, size={}", m, offset, size);
+            throw system_error(make_error_code(errc::invalid_argument));
+        }
+
+        m_stMipMaps[m].assign(content.GetData() + offset, content.GetData() + offset + size);
+        m_stSubResources[m].pData = m_stMipMaps[m].data();
+        m_stSubResources[m].Stride = mipLevelProps.RowSize;
+    }
+}
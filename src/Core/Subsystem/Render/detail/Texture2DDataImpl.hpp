@@ -32,7 +32,8 @@ namespace lstg::Subsystem::Render::detail
     public:
         /**
          * 从文件加载纹理
-         * 支持 stb_image 所兼容格式
+         * 支持 stb_image 所兼容格式，以及 DDS/KTX2 容器。
+         * 从容器加载时保持容器内的像素格式和 Mipmap，convertToRGBA32 不生效。
          * @param stream 数据流
          * @param convertToRGBA32 是否转换到 RGBA32
          */
@@ -67,6 +68,16 @@ namespace lstg::Subsystem::Render::detail
          */
         [[nodiscard]] Texture2DFormats GetFormat() const noexcept;
 
+        /**
+         * 是否为块压缩格式
+         */
+        [[nodiscard]] bool IsCompressed() const noexcept;
+
+        /**
+         * 获取 Mipmap 层数
+         */
+        [[nodiscard]] size_t GetMipLevels() const noexcept { return m_stSubResources.size(); }
+
         /**
          * 获取数据块
          */
@@ -80,6 +91,11 @@ namespace lstg::Subsystem::Render::detail
          */
         Result<void> GenerateMipmap(size_t count = 0) noexcept;
 
+    private:
+        void LoadFromDDS(Span<const uint8_t> content);
+        void LoadFromKTX2(Span<const uint8_t> content);
+        void LoadMipChain(Span<const uint8_t> content, const std::vector<uint64_t>& levelOffsets);
+
     private:
         Diligent::TextureDesc m_stDesc;
         std::vector<Diligent::TextureSubResData> m_stSubResources;
@@ -28,6 +28,22 @@ namespace lstg::Subsystem::Render::detail
                 return Subsystem::Render::Texture2DFormats::R16G16;
             case Diligent::TEX_FORMAT_RGBA16_UNORM:
                 return Subsystem::Render::Texture2DFormats::R16G16B16A16;
+            case Diligent::TEX_FORMAT_BC1_UNORM:
+                return Subsystem::Render::Texture2DFormats::BC1;
+            case Diligent::TEX_FORMAT_BC1_UNORM_SRGB:
+                return Subsystem::Render::Texture2DFormats::BC1_SRGB;
+            case Diligent::TEX_FORMAT_BC2_UNORM:
+                return Subsystem::Render::Texture2DFormats::BC2;
+            case Diligent::TEX_FORMAT_BC2_UNORM_SRGB:
+                return Subsystem::Render::Texture2DFormats::BC2_SRGB;
+            case Diligent::TEX_FORMAT_BC3_UNORM:
+                return Subsystem::Render::Texture2DFormats::BC3;
+            case Diligent::TEX_FORMAT_BC3_UNORM_SRGB:
+                return Subsystem::Render::Texture2DFormats::BC3_SRGB;
+            case Diligent::TEX_FORMAT_BC7_UNORM:
+                return Subsystem::Render::Texture2DFormats::BC7;
+            case Diligent::TEX_FORMAT_BC7_UNORM_SRGB:
+                return Subsystem::Render::Texture2DFormats::BC7_SRGB;
             default:
                 assert(false);
                 return Subsystem::Render::Texture2DFormats::R8G8B8A8;
@@ -52,12 +68,53 @@ namespace lstg::Subsystem::Render::detail
                 return Diligent::TEX_FORMAT_RG16_UNORM;
             case Subsystem::Render::Texture2DFormats::R16G16B16A16:
                 return Diligent::TEX_FORMAT_RGBA16_UNORM;
+            case Subsystem::Render::Texture2DFormats::BC1:
+                return Diligent::TEX_FORMAT_BC1_UNORM;
+            case Subsystem::Render::Texture2DFormats::BC1_SRGB:
+                return Diligent::TEX_FORMAT_BC1_UNORM_SRGB;
+            case Subsystem::Render::Texture2DFormats::BC2:
+                return Diligent::TEX_FORMAT_BC2_UNORM;
+            case Subsystem::Render::Texture2DFormats::BC2_SRGB:
+                return Diligent::TEX_FORMAT_BC2_UNORM_SRGB;
+            case Subsystem::Render::Texture2DFormats::BC3:
+                return Diligent::TEX_FORMAT_BC3_UNORM;
+            case Subsystem::Render::Texture2DFormats::BC3_SRGB:
+                return Diligent::TEX_FORMAT_BC3_UNORM_SRGB;
+            case Subsystem::Render::Texture2DFormats::BC7:
+                return Diligent::TEX_FORMAT_BC7_UNORM;
+            case Subsystem::Render::Texture2DFormats::BC7_SRGB:
+                return Diligent::TEX_FORMAT_BC7_UNORM_SRGB;
             default:
                 assert(false);
                 return Diligent::TEX_FORMAT_RGBA8_UNORM;
         }
     }
 
+    /**
+     * 是否为块压缩格式
+     */
+    inline bool IsBlockCompressed(Subsystem::Render::Texture2DFormats format) noexcept
+    {
+        switch (format)
+        {
+            case Texture2DFormats::BC1:
+            case Texture2DFormats::BC1_SRGB:
+            case Texture2DFormats::BC2:
+            case Texture2DFormats::BC2_SRGB:
+            case Texture2DFormats::BC3:
+            case Texture2DFormats::BC3_SRGB:
+            case Texture2DFormats::BC7:
+            case Texture2DFormats::BC7_SRGB:
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    /**
+     * 获取像素大小
+     * @note 块压缩格式没有像素大小的概念，不应调用该方法
+     */
     inline uint32_t GetPixelComponentSize(Subsystem::Render::Texture2DFormats format) noexcept
     {
         switch (format)
@@ -9,9 +9,11 @@
 #include <vector>
 #include <SDL2/SDL.h>
 #include <glm/gtc/matrix_transform.hpp>
+#include <GraphicsAccessories.hpp>
 #include <lstg/Core/Pal.hpp>
 #include <lstg/Core/Logging.hpp>
 #include <lstg/Core/Subsystem/SubsystemContainer.hpp>
+#include <lstg/Core/Subsystem/ProfileSystem.hpp>
 #include <lstg/Core/Subsystem/Render/GraphicsDefinitionCache.hpp>
 #include <lstg/Core/AppBase.hpp>  // for Cmdline
 #include <lstg/Core/Subsystem/Render/RenderEvent.hpp>
@@ -33,6 +35,8 @@ LSTG_DEF_LOG_CATEGORY(RenderSystem);
 
 static const unsigned kDefaultTexture2DWidth = 16;
 static const unsigned kDefaultTexture2DHeight = 16;
+static const uint32_t kRenderTargetPoolMaxIdleFrames = 120;  // 约 2 秒
+static const size_t kDefaultTextureUploadBudget = 4 * 1024 * 1024;  // 每帧 4MB
 
 namespace
 {
@@ -280,7 +284,8 @@ glm::vec<2, uint32_t> RenderSystem::GetDefaultTexture2DSize() noexcept
 
 RenderSystem::RenderSystem(SubsystemContainer& container)
     : m_pWindowSystem(container.Get<WindowSystem>()), m_pVirtualFileSystem(container.Get<VirtualFileSystem>()),
-    m_pEventBusSystem(container.Get<EventBusSystem>())
+    m_pEventBusSystem(container.Get<EventBusSystem>()), m_stRenderTargetPool(kRenderTargetPoolMaxIdleFrames),
+    m_uTextureUploadBudget(kDefaultTextureUploadBudget)
 {
     assert(m_pWindowSystem && m_pVirtualFileSystem && m_pEventBusSystem);
 
@@ -309,6 +314,14 @@ RenderSystem::RenderSystem(SubsystemContainer& container)
     if (!m_pRenderDevice)
         LSTG_THROW(Render::RenderDeviceInitializeFailedException, "No available render device");
 
+    // 查询纹理格式支持情况
+    for (auto i = static_cast<int>(Render::Texture2DFormats::R8); i <= static_cast<int>(Render::Texture2DFormats::BC7_SRGB); ++i)
+    {
+        auto format = Render::detail::ToDiligent(static_cast<Render::Texture2DFormats>(i));
+        if (m_pRenderDevice->GetDevice()->GetTextureFormatInfo(format).Supported)
+            m_uSupportedTextureFormats |= (1u << static_cast<unsigned>(i));
+    }
+
     // 初始化效果工厂
     m_pEffectFactory = make_shared<Render::EffectFactory>(*m_pVirtualFileSystem, *m_pRenderDevice);
 
@@ -438,8 +451,121 @@ Result<Render::TexturePtr> RenderSystem::CreateTexture2D(const Render::Texture2D
     return make_shared<Render::Texture>(*m_pRenderDevice, texture);
 }
 
+bool RenderSystem::IsTextureFormatSupported(Render::Texture2DFormats format) const noexcept
+{
+    return (m_uSupportedTextureFormats & (1u << static_cast<unsigned>(format))) != 0;
+}
+
+Result<Render::TextureUploadRequestPtr> RenderSystem::CreateTexture2DAsync(Render::Texture2DData data) noexcept
+{
+    Diligent::TextureDesc desc = data.m_pImpl->m_stDesc;
+    desc.BindFlags = Diligent::BIND_SHADER_RESOURCE;
+    desc.Usage = Diligent::USAGE_DEFAULT;  // 需要通过 UpdateTexture 分片写入
+    desc.MipLevels = data.m_pImpl->m_stSubResources.size();
+    assert(desc.MipLevels != 0);
+
+    // 统计数据大小
+    size_t totalBytes = 0;
+    for (size_t i = 0; i < data.m_pImpl->m_stSubResources.size(); ++i)
+        totalBytes += static_cast<size_t>(Diligent::GetMipLevelProperties(desc, static_cast<uint32_t>(i)).MipSize);
+
+    // 创建空纹理
+    Diligent::RefCntAutoPtr<Diligent::ITexture> texture;
+    m_pRenderDevice->GetDevice()->CreateTexture(desc, nullptr, &texture);
+    if (!texture)
+        return make_error_code(errc::not_enough_memory);
+
+    try
+    {
+        auto tex = make_shared<Render::Texture>(*m_pRenderDevice, texture);
+        auto request = make_shared<Render::TextureUploadRequest>(std::move(tex), std::move(data), totalBytes);
+        m_stTextureUploadQueue.push_back(request);
+        return request;
+    }
+    catch (...)  // bad_alloc
+    {
+        return make_error_code(errc::not_enough_memory);
+    }
+}
+
+void RenderSystem::UpdateTextureUploads() noexcept
+{
+    auto context = m_pRenderDevice->GetImmediateContext();
+
+    size_t budget = m_uTextureUploadBudget;
+    bool anyUploaded = false;
+    while (!m_stTextureUploadQueue.empty())
+    {
+        auto& request = m_stTextureUploadQueue.front();
+
+        // 请求已被取消
+        if (request.use_count() == 1)
+        {
+            m_stTextureUploadQueue.pop_front();
+            continue;
+        }
+
+        assert(request->m_iState == Render::TextureUploadStates::Uploading && request->m_stData);
+        const auto& impl = *request->m_stData->m_pImpl;
+        auto* nativeTexture = request->m_pTexture->m_pNativeHandler;
+        while (request->m_uCurrentMipLevel < impl.m_stSubResources.size())
+        {
+            // 预算耗尽，留到下一次
+            // 每次调用至少上传一行，保证进度
+            if (budget == 0 && anyUploaded)
+                return;
+
+            const auto& subResource = impl.m_stSubResources[request->m_uCurrentMipLevel];
+            auto mipLevelProps = Diligent::GetMipLevelProperties(impl.m_stDesc, static_cast<uint32_t>(request->m_uCurrentMipLevel));
+            auto mipWidth = mipLevelProps.LogicalWidth;
+            auto mipHeight = mipLevelProps.LogicalHeight;
+            auto mipRows = mipLevelProps.RowCount;  // 块压缩格式下为像素块的行数
+            auto blockHeight = mipRows > 0 ? (mipLevelProps.StorageHeight / mipRows) : 1u;
+            auto stride = static_cast<size_t>(subResource.Stride);
+            assert(stride > 0 && blockHeight > 0);
+
+            // 按行切分，块压缩格式按块行切分，保证更新区域与块对齐
+            auto rowsLeft = mipRows - request->m_uCurrentRow;
+            auto rows = static_cast<uint32_t>(std::min<size_t>(rowsLeft, std::max<size_t>(1u, budget / stride)));
+
+            Diligent::Box updateRange;
+            updateRange.MinX = 0;
+            updateRange.MaxX = mipWidth;
+            updateRange.MinY = request->m_uCurrentRow * blockHeight;
+            updateRange.MaxY = std::min<uint32_t>(mipHeight, (request->m_uCurrentRow + rows) * blockHeight);
+
+            Diligent::TextureSubResData subResData;
+            subResData.pData = static_cast<const uint8_t*>(subResource.pData) + stride * request->m_uCurrentRow;
+            subResData.Stride = subResource.Stride;
+            context->UpdateTexture(nativeTexture, static_cast<uint32_t>(request->m_uCurrentMipLevel), 0, updateRange, subResData,
+                Diligent::RESOURCE_STATE_TRANSITION_MODE_TRANSITION, Diligent::RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+            auto uploaded = stride * rows;
+            request->m_uUploadedBytes += uploaded;
+            budget -= std::min(budget, uploaded);
+            anyUploaded = true;
+
+            request->m_uCurrentRow += rows;
+            if (request->m_uCurrentRow >= mipRows)
+            {
+                ++request->m_uCurrentMipLevel;
+                request->m_uCurrentRow = 0;
+            }
+        }
+
+        // 上传完毕，释放 CPU 侧数据
+        request->m_iState = Render::TextureUploadStates::Finished;
+        request->m_stData.reset();
+        m_stTextureUploadQueue.pop_front();
+    }
+}
+
 Result<Render::TexturePtr> RenderSystem::CreateDynamicTexture2D(uint32_t width, uint32_t height, Render::Texture2DFormats format) noexcept
 {
+    // 块压缩格式无法逐像素更新
+    if (Render::detail::IsBlockCompressed(format))
+        return make_error_code(errc::invalid_argument);
+
     try
     {
         auto stride = Render::detail::AlignedScanLineSize(width * Render::detail::GetPixelComponentSize(format));
@@ -522,6 +648,46 @@ Result<Render::TexturePtr> RenderSystem::CreateDepthStencil(uint32_t width, uint
     return make_shared<Render::Texture>(*m_pRenderDevice, texture);
 }
 
+Result<Render::TexturePtr> RenderSystem::AcquireRenderTarget(uint32_t width, uint32_t height) noexcept
+{
+    auto format = m_pRenderDevice->GetSwapChain()->GetDesc().ColorBufferFormat;
+    Render::RenderTargetPool::Key key { width, height, static_cast<uint32_t>(format), false };
+    auto pooled = m_stRenderTargetPool.TryAcquire(key);
+    if (pooled)
+        return pooled;
+
+    auto ret = CreateRenderTarget(width, height);
+    if (!ret)
+        return ret.GetError();
+
+    const auto& attribs = Diligent::GetTextureFormatAttribs(format);
+    auto bytes = static_cast<size_t>(width) * height * attribs.ComponentSize * attribs.NumComponents;
+    auto add = m_stRenderTargetPool.Add(key, *ret, bytes);
+    if (!add)
+        LSTG_LOG_WARN_CAT(RenderSystem, "Cannot add render target {}x{} to pool: {}", width, height, add.GetError());
+    return ret;
+}
+
+Result<Render::TexturePtr> RenderSystem::AcquireDepthStencil(uint32_t width, uint32_t height) noexcept
+{
+    auto format = m_pRenderDevice->GetSwapChain()->GetDesc().DepthBufferFormat;
+    Render::RenderTargetPool::Key key { width, height, static_cast<uint32_t>(format), true };
+    auto pooled = m_stRenderTargetPool.TryAcquire(key);
+    if (pooled)
+        return pooled;
+
+    auto ret = CreateDepthStencil(width, height);
+    if (!ret)
+        return ret.GetError();
+
+    const auto& attribs = Diligent::GetTextureFormatAttribs(format);
+    auto bytes = static_cast<size_t>(width) * height * attribs.ComponentSize * attribs.NumComponents;
+    auto add = m_stRenderTargetPool.Add(key, *ret, bytes);
+    if (!add)
+        LSTG_LOG_WARN_CAT(RenderSystem, "Cannot add depth stencil {}x{} to pool: {}", width, height, add.GetError());
+    return ret;
+}
+
 Result<Render::MeshPtr> RenderSystem::CreateStaticMesh(const Render::GraphDef::MeshDefinition& def, Span<const uint8_t> vertexData,
     Span<const uint8_t> indexData, bool use32BitIndex) noexcept
 {
@@ -671,6 +837,23 @@ void RenderSystem::EndFrame() noexcept
     // 执行 Present
     m_pRenderDevice->Present();
 
+    // 回收 RT 池
+    m_stRenderTargetPool.NewFrame();
+
+#ifdef LSTG_DEVELOPMENT
+#define SET_COUNTER(NAME, WHAT) \
+    ProfileSystem::GetInstance().SetPerformanceCounter(PerformanceCounterTypes::PerFrame, #NAME, static_cast<double>(WHAT))
+
+    const auto& poolStatistics = m_stRenderTargetPool.GetStatistics();
+    SET_COUNTER(RenderSystem_RTPoolPooled, poolStatistics.PooledBytes / 1024);
+    SET_COUNTER(RenderSystem_RTPoolInUse, poolStatistics.InUseBytes / 1024);
+    SET_COUNTER(RenderSystem_RTPoolPeak, poolStatistics.PeakBytes / 1024);
+    SET_COUNTER(RenderSystem_RTPoolCreated, poolStatistics.CreatedInFrame);
+    SET_COUNTER(RenderSystem_RTPoolReused, poolStatistics.ReusedInFrame);
+    SET_COUNTER(RenderSystem_RTPoolReleased, poolStatistics.ReleasedInFrame);
+#undef SET_COUNTER
+#endif
+
 #ifdef LSTG_ROTATABLE_SCREEN
     // 检查 SwapChain 大小，必要时触发事件
     SyncSwapChainSize();
@@ -836,6 +1019,21 @@ Result<void> RenderSystem::Clear(std::optional<Render::ColorRGBA32> clearColor,
 }
 
 Result<void> RenderSystem::Draw(Render::Mesh* mesh, size_t indexCount, size_t vertexOffset, size_t indexOffset) noexcept
+{
+    return DrawImpl(mesh, indexCount, vertexOffset, indexOffset, 0, 0);
+}
+
+Result<void> RenderSystem::DrawInstanced(Render::Mesh* mesh, size_t indexCount, size_t instanceCount, size_t instanceOffset) noexcept
+{
+    if (!mesh || !mesh->m_pInstanceBuffer || mesh->GetDefinition()->GetInstanceStride() == 0)
+        return make_error_code(errc::invalid_argument);
+    if (instanceCount == 0)
+        return {};
+    return DrawImpl(mesh, indexCount, 0, 0, instanceCount, instanceOffset);
+}
+
+Result<void> RenderSystem::DrawImpl(Render::Mesh* mesh, size_t indexCount, size_t vertexOffset, size_t indexOffset, size_t instanceCount,
+    size_t instanceOffset) noexcept
 {
     if (!mesh)
         return make_error_code(errc::invalid_argument);
@@ -865,10 +1063,13 @@ Result<void> RenderSystem::Draw(Render::Mesh* mesh, size_t indexCount, size_t ve
     {
         assert(vertexOffset < mesh->GetVertexCount());
         assert(indexOffset < mesh->GetIndexCount());
-        Diligent::IBuffer* vertexBuffers[] = {mesh->m_pVertexBuffer};
-        Uint64 vertexOffsets[] = {mesh->GetDefinition()->GetVertexStride() * vertexOffset};
-        context->SetVertexBuffers(0, 1, vertexBuffers, vertexOffsets, Diligent::RESOURCE_STATE_TRANSITION_MODE_TRANSITION,
-            Diligent::SET_VERTEX_BUFFERS_FLAG_RESET);
+        Diligent::IBuffer* vertexBuffers[] = {mesh->m_pVertexBuffer, mesh->m_pInstanceBuffer};
+        Uint64 vertexOffsets[] = {
+            mesh->GetDefinition()->GetVertexStride() * vertexOffset,
+            mesh->GetDefinition()->GetInstanceStride() * instanceOffset,  // 不使用 FirstInstanceLocation，以兼容 GLES
+        };
+        context->SetVertexBuffers(0, instanceCount > 0 ? 2 : 1, vertexBuffers, vertexOffsets,
+            Diligent::RESOURCE_STATE_TRANSITION_MODE_TRANSITION, Diligent::SET_VERTEX_BUFFERS_FLAG_RESET);
         context->SetIndexBuffer(mesh->m_pIndexBuffer, indexOffset * (mesh->Is32BitsIndex() ? 4 : 2),
             Diligent::RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
     }
@@ -876,6 +1077,7 @@ Result<void> RenderSystem::Draw(Render::Mesh* mesh, size_t indexCount, size_t ve
     // 依次渲染 Pass
     Diligent::DrawIndexedAttribs drawAttrs;
     drawAttrs.NumIndices = indexCount;
+    drawAttrs.NumInstances = std::max<size_t>(1, instanceCount);
     drawAttrs.IndexType = mesh->Is32BitsIndex() ? Diligent::VT_UINT32 : Diligent::VT_UINT16;
     drawAttrs.Flags = Diligent::DRAW_FLAG_VERIFY_STATES;
     for (const auto& pass : m_pCurrentPassGroup->GetPasses())
@@ -1202,6 +1404,26 @@ Result<void> RenderSystem::PreparePipeline(const Render::GraphDef::EffectPassDef
                         break;
                     }
                 }
+                for (const auto& im : meshDef->GetInstanceElements())
+                {
+                    if (found)
+                        break;
+                    if (im.Semantic == s.second.Semantic)
+                    {
+                        vertexLayout.emplace_back(Diligent::LayoutElement {
+                            s.second.SlotIndex,  // _InputIndex
+                            1,  // _BufferSlot
+                            static_cast<unsigned>(std::get<1>(im.Type)),  // _NumComponents
+                            Render::GraphDef::detail::ToDiligent(std::get<0>(im.Type)),  // _ValueType
+                            s.second.Normalized,  // _IsNormalized
+                            static_cast<unsigned>(im.Offset),  // _RelativeOffset
+                            static_cast<unsigned>(meshDef->GetInstanceStride()),  // _Stride
+                            Diligent::INPUT_ELEMENT_FREQUENCY_PER_INSTANCE,  // _Frequency
+                            1  // _InstanceDataStepRate
+                        });
+                        found = true;
+                    }
+                }
                 if (!found)
                 {
                     LSTG_LOG_WARN_CAT(RenderSystem, "Pass \"{}\" vertex layout slot {} missing in mesh", pass->GetName(),
@@ -0,0 +1,241 @@
+/**
+ * @file
+ * @date 2022/9/12
+ * @author 9chu
+ * 此文件为 LuaSTGPlus 项目的一部分，版权与许可声明详见 COPYRIGHT.txt。
+ */
+#include <lstg/Core/Subsystem/Script/BytecodeCache.hpp>
+
+#include <cstring>
+#include <lstg/Core/Hash.hpp>
+#include <lstg/Core/Logging.hpp>
+#include <lstg/Core/Subsystem/VirtualFileSystem.hpp>
+
+using namespace std;
+using namespace lstg;
+using namespace lstg::Subsystem::Script;
+
+LSTG_DEF_LOG_CATEGORY(BytecodeCache);
+
+namespace
+{
+    /**
+     * 缓存文件头
+     * 其后紧跟缓存键和字节码。
+     */
+    struct CacheFileHeader
+    {
+        char Magic[4];
+        uint32_t Version;
+        int64_t LastModified;
+        uint64_t SourceSize;
+        uint32_t ContentHash;
+        uint32_t KeyLength;
+    };
+    static_assert(sizeof(CacheFileHeader) == 32);
+
+    const char kCacheFileMagic[4] = { 'L', 'S', 'B', 'C' };
+    const uint32_t kPathHashSeed = 0x9747B28Cu;
+
+    int BytecodeWriter(lua_State* L, const void* p, size_t sz, void* ud) noexcept
+    {
+        static_cast<void>(L);
+        auto& out = *static_cast<vector<uint8_t>*>(ud);
+        try
+        {
+            auto bytes = static_cast<const uint8_t*>(p);
+            out.insert(out.end(), bytes, bytes + sz);
+        }
+        catch (...)  // bad_alloc
+        {
+            return 1;
+        }
+        return 0;
+    }
+}
+
+bool BytecodeCache::IsBytecode(Span<const uint8_t> source) noexcept
+{
+    // LuaJIT 和 Lua 5.1 的字节码都以 ESC 开头，luaL_loadbuffer 会据此自动识别
+    return !source.IsEmpty() && source[0] == '\x1b';
+}
+
+BytecodeCache::BytecodeCache(VirtualFileSystem& fs) noexcept
+    : m_stFileSystem(fs)
+{
+}
+
+Result<void> BytecodeCache::SetCacheDirectory(std::string dir) noexcept
+{
+    if (!dir.empty())
+    {
+        auto attr = m_stFileSystem.GetFileAttribute(dir);
+        if (!attr)
+        {
+            auto ret = m_stFileSystem.CreateDirectory(dir);
+            if (!ret)
+                return ret.GetError();
+        }
+        else if (attr->Type != VFS::FileType::Directory)
+        {
+            return make_error_code(errc::not_a_directory);
+        }
+    }
+
+    try
+    {
+        if (!m_pPendingWrites)
+            m_pPendingWrites = make_shared<unordered_set<string>>();
+    }
+    catch (...)  // bad_alloc
+    {
+        return make_error_code(errc::not_enough_memory);
+    }
+
+    m_stCacheDirectory = std::move(dir);
+    return {};
+}
+
+int BytecodeCache::Load(lua_State* L, Span<const uint8_t> source, std::string_view path, std::time_t lastModified,
+    const char* chunkName) noexcept
+{
+    auto data = reinterpret_cast<const char*>(source.data());
+
+    // 未启用缓存或输入已经是字节码时直接加载
+    if (m_stCacheDirectory.empty() || IsBytecode(source))
+        return luaL_loadbuffer(L, data, source.size(), chunkName);
+
+    // 同一文件可能以不同的块名称加载（require / import），块名称会被写入字节码，因此一并作为键
+    string key, cachePath;
+    try
+    {
+        key.reserve(path.size() + 1 + strlen(chunkName));
+        key.append(path);
+        key.push_back('\0');
+        key.append(chunkName);
+        cachePath = MakeCachePath(key);
+    }
+    catch (...)  // bad_alloc
+    {
+        return luaL_loadbuffer(L, data, source.size(), chunkName);
+    }
+
+    auto contentHash = MurmurHash3(source);
+    if (TryLoadCache(L, cachePath, key, lastModified, source, contentHash, chunkName))
+    {
+        ++m_uHitCount;
+        return 0;
+    }
+    ++m_uMissCount;
+
+    auto ret = luaL_loadbuffer(L, data, source.size(), chunkName);
+    if (ret == 0)
+        WriteCache(L, std::move(cachePath), key, lastModified, source, contentHash);
+    return ret;
+}
+
+std::string BytecodeCache::MakeCachePath(std::string_view key) const
+{
+    Span<const uint8_t> keyBytes { reinterpret_cast<const uint8_t*>(key.data()), key.size() };
+    return fmt::format("{}/{:08x}{:08x}{}", m_stCacheDirectory, MurmurHash3(keyBytes), MurmurHash3(keyBytes, kPathHashSeed),
+        kExtension);
+}
+
+bool BytecodeCache::TryLoadCache(lua_State* L, const std::string& cachePath, std::string_view key, std::time_t lastModified,
+    Span<const uint8_t> source, uint32_t contentHash, const char* chunkName) noexcept
+{
+    vector<uint8_t> buffer;
+    try
+    {
+        auto ret = m_stFileSystem.ReadFile(buffer, cachePath);
+        if (!ret)
+            return false;
+    }
+    catch (...)  // bad_alloc
+    {
+        return false;
+    }
+
+    // 校验文件头
+    CacheFileHeader header {};
+    if (buffer.size() < sizeof(header))
+        return false;
+    ::memcpy(&header, buffer.data(), sizeof(header));
+    if (::memcmp(header.Magic, kCacheFileMagic, sizeof(kCacheFileMagic)) != 0 || header.Version != kVersion ||
+        header.LastModified != static_cast<int64_t>(lastModified) || header.SourceSize != source.size() ||
+        header.ContentHash != contentHash || header.KeyLength != key.size())
+    {
+        return false;
+    }
+    if (buffer.size() < sizeof(header) + header.KeyLength ||
+        ::memcmp(buffer.data() + sizeof(header), key.data(), key.size()) != 0)
+    {
+        return false;
+    }
+
+    Span<const uint8_t> bytecode { buffer.data() + sizeof(header) + header.KeyLength,
+        buffer.size() - sizeof(header) - header.KeyLength };
+    if (!IsBytecode(bytecode))
+        return false;
+
+    // 虚拟机版本不一致时字节码会被拒绝，此时回退到源码并覆盖缓存
+    auto load = luaL_loadbuffer(L, reinterpret_cast<const char*>(bytecode.data()), bytecode.size(), chunkName);
+    if (load != 0)
+    {
+        LSTG_LOG_WARN_CAT(BytecodeCache, "Discard bytecode cache \"{}\": {}", cachePath, lua_tostring(L, -1));
+        lua_pop(L, 1);
+        return false;
+    }
+    return true;
+}
+
+void BytecodeCache::WriteCache(lua_State* L, std::string cachePath, std::string_view key, std::time_t lastModified,
+    Span<const uint8_t> source, uint32_t contentHash) noexcept
+{
+    assert(m_pPendingWrites);
+    assert(lua_isfunction(L, -1));
+
+    // 上一次写入尚未完成时跳过，避免两个写请求交错
+    auto& pending = *m_pPendingWrites;
+    if (pending.find(cachePath) != pending.end())
+        return;
+
+    try
+    {
+        CacheFileHeader header {};
+        ::memcpy(header.Magic, kCacheFileMagic, sizeof(kCacheFileMagic));
+        header.Version = kVersion;
+        header.LastModified = static_cast<int64_t>(lastModified);
+        header.SourceSize = source.size();
+        header.ContentHash = contentHash;
+        header.KeyLength = static_cast<uint32_t>(key.size());
+
+        vector<uint8_t> data;
+        data.reserve(sizeof(header) + key.size() + source.size());
+        data.resize(sizeof(header) + key.size());
+        ::memcpy(data.data(), &header, sizeof(header));
+        ::memcpy(data.data() + sizeof(header), key.data(), key.size());
+        if (lua_dump(L, BytecodeWriter, &data) != 0)
+        {
+            LSTG_LOG_WARN_CAT(BytecodeCache, "Fail to dump bytecode for \"{}\"", cachePath);
+            return;
+        }
+
+        pending.insert(cachePath);
+        auto ret = m_stFileSystem.WriteFileAsync(cachePath, std::move(data),
+            [pendingWrites = m_pPendingWrites, cachePath](std::error_code ec) {
+                pendingWrites->erase(cachePath);
+                if (ec)
+                    LSTG_LOG_WARN_CAT(BytecodeCache, "Fail to write bytecode cache \"{}\": {}", cachePath, ec);
+            });
+        if (!ret)
+        {
+            pending.erase(cachePath);
+            LSTG_LOG_WARN_CAT(BytecodeCache, "Fail to write bytecode cache \"{}\": {}", cachePath, ret.GetError());
+        }
+    }
+    catch (...)  // bad_alloc
+    {
+        pending.erase(cachePath);
+    }
+}
@@ -0,0 +1,162 @@
+/**
+ * @file
+ * @date 2022/10/3
+ * @author 9chu
+ * 此文件为 LuaSTGPlus 项目的一部分，版权与许可声明详见 COPYRIGHT.txt。
+ */
+#include <lstg/Core/Subsystem/Script/CoroutineScheduler.hpp>
+
+#include <lstg/Core/Logging.hpp>
+
+using namespace std;
+using namespace lstg;
+using namespace lstg::Subsystem::Script;
+
+LSTG_DEF_LOG_CATEGORY(CoroutineScheduler);
+
+bool CoroutineScheduler::WaitNodeComparer::operator()(const WaitNode* a, const WaitNode* b) const noexcept
+{
+    if (a->WakeFrame != b->WakeFrame)
+        return a->WakeFrame < b->WakeFrame;
+    return a->Sequence < b->Sequence;
+}
+
+CoroutineScheduler::CoroutineScheduler(LuaStack mainThread) noexcept
+    : m_stMainThread(mainThread)
+{
+}
+
+CoroutineScheduler::~CoroutineScheduler()
+{
+    Clear();
+}
+
+Result<void> CoroutineScheduler::Schedule(LuaStack& stack, int idx, uint32_t frames) noexcept
+{
+    auto thread = lua_tothread(stack, idx);
+    if (!thread || thread == static_cast<lua_State*>(m_stMainThread))
+        return make_error_code(errc::invalid_argument);
+
+    WaitNode* node = nullptr;
+    auto it = m_stWaiting.find(thread);
+    if (it != m_stWaiting.end())
+    {
+        node = it->second;
+        m_stHeap.Remove(node);
+    }
+    else
+    {
+        try
+        {
+            node = AllocNode();
+            m_stWaiting.emplace(thread, node);
+        }
+        catch (...)  // bad_alloc
+        {
+            if (node)
+                FreeNode(node);
+            return make_error_code(errc::not_enough_memory);
+        }
+
+        node->Thread = thread;
+        lua_pushvalue(stack, idx);
+        node->Ref = luaL_ref(stack, LUA_REGISTRYINDEX);
+    }
+
+    // 至少等待一帧，避免 Update 中重复登记的协程在同一帧内被反复唤醒
+    node->WakeFrame = m_ullCurrentFrame + std::max<uint32_t>(frames, 1);
+    node->Sequence = ++m_ullSequence;
+    m_stHeap.Insert(node);
+    return {};
+}
+
+bool CoroutineScheduler::Cancel(LuaStack& stack, int idx) noexcept
+{
+    auto thread = lua_tothread(stack, idx);
+    if (!thread)
+        return false;
+
+    auto it = m_stWaiting.find(thread);
+    if (it == m_stWaiting.end())
+        return false;
+
+    auto node = it->second;
+    m_stWaiting.erase(it);
+    m_stHeap.Remove(node);
+    luaL_unref(m_stMainThread, LUA_REGISTRYINDEX, node->Ref);
+    FreeNode(node);
+    return true;
+}
+
+size_t CoroutineScheduler::Update() noexcept
+{
+    ++m_ullCurrentFrame;
+
+    size_t count = 0;
+    auto top = m_stHeap.GetTop();
+    while (top && top->WakeFrame <= m_ullCurrentFrame)
+    {
+        auto thread = top->Thread;
+
+        // 协程在唤醒期间由主线程栈持有
+        lua_rawgeti(m_stMainThread, LUA_REGISTRYINDEX, top->Ref);
+        luaL_unref(m_stMainThread, LUA_REGISTRYINDEX, top->Ref);
+        m_stHeap.Remove(top);
+        m_stWaiting.erase(thread);
+        FreeNode(top);
+
+        // 与 coroutine.resume 一致，只唤醒挂起或尚未开始的协程
+        auto status = lua_status(thread);
+        if (status == LUA_YIELD || (status == 0 && lua_gettop(thread) > 0))
+        {
+            ++count;
+            auto ret = lua_resume(thread, 0);
+            if (ret != 0 && ret != LUA_YIELD)
+            {
+                auto msg = lua_tostring(thread, -1);
+                LSTG_LOG_ERROR_CAT(CoroutineScheduler, "Error in coroutine: {}", msg ? msg : "<unknown>");
+            }
+            lua_settop(thread, 0);  // 丢弃 yield 或返回的值
+        }
+        lua_pop(m_stMainThread, 1);
+
+        top = m_stHeap.GetTop();
+    }
+    return count;
+}
+
+void CoroutineScheduler::Clear() noexcept
+{
+    for (const auto& p : m_stWaiting)
+    {
+        m_stHeap.Remove(p.second);
+        luaL_unref(m_stMainThread, LUA_REGISTRYINDEX, p.second->Ref);
+        FreeNode(p.second);
+    }
+    m_stWaiting.clear();
+    assert(m_stHeap.GetTop() == nullptr);
+}
+
+CoroutineScheduler::WaitNode* CoroutineScheduler::AllocNode()
+{
+    if (m_stFreeNodes.empty())
+    {
+        // 保证 FreeNode 时不需要分配内存
+        m_stFreeNodes.reserve(m_stNodes.size() + 1);
+        m_stNodes.emplace_back(make_unique<WaitNode>());
+        return m_stNodes.back().get();
+    }
+    auto node = m_stFreeNodes.back();
+    m_stFreeNodes.pop_back();
+    return node;
+}
+
+void CoroutineScheduler::FreeNode(WaitNode* node) noexcept
+{
+    node->Thread = nullptr;
+    node->Ref = LUA_NOREF;
+    node->WakeFrame = 0;
+    node->Sequence = 0;
+    assert(m_stFreeNodes.size() < m_stFreeNodes.capacity());
+    m_stFreeNodes.push_back(node);
+}
@@ -0,0 +1,95 @@
+/**
+ * @file
+ * @date 2022/10/4
+ * @author 9chu
+ * 此文件为 LuaSTGPlus 项目的一部分，版权与许可声明详见 COPYRIGHT.txt。
+ */
+#include <lstg/Core/Subsystem/Script/GarbageCollector.hpp>
+
+#include <algorithm>
+#include <chrono>
+
+using namespace std;
+using namespace lstg;
+using namespace lstg::Subsystem::Script;
+
+namespace
+{
+    /**
+     * 每次单步回收的大小（KB）
+     */
+    const int kStepSizeKb = 16;
+
+    /**
+     * 分配触发回收的参数
+     * 堆增长到上一周期结束时的 150% 即开始新周期，每分配 1 单位内存推进 3 单位回收工作。
+     * 比默认值（200/200）更积极，帧间回收跟不上时由分配点分摊的工作也能尽快收敛。
+     */
+    const int kPause = 150;
+    const int kStepMul = 300;
+
+    /**
+     * 堆相对上一周期结束时增长超过该倍数（且超过 kEmergencyMinGrowthKb）时放大本帧预算
+     * 说明预算已经跟不上分配速度，此时以 kEmergencyBudgetScale 倍的最长回收时间追赶，但依然受时间限制。
+     */
+    const int kEmergencyRatio = 4;
+    const int kEmergencyMinGrowthKb = 32 * 1024;
+    const double kEmergencyBudgetScale = 4.;
+}
+
+GarbageCollector::GarbageCollector(LuaStack mainThread) noexcept
+    : m_stMainThread(mainThread)
+{
+    lua_gc(m_stMainThread, LUA_GCSETPAUSE, kPause);
+    lua_gc(m_stMainThread, LUA_GCSETSTEPMUL, kStepMul);
+}
+
+void GarbageCollector::Suspend() noexcept
+{
+    if (m_uSuspendCount++ == 0)
+        lua_gc(m_stMainThread, LUA_GCSTOP, 0);
+}
+
+void GarbageCollector::Resume() noexcept
+{
+    assert(m_uSuspendCount > 0);
+    if (m_uSuspendCount > 0 && --m_uSuspendCount == 0)
+        lua_gc(m_stMainThread, LUA_GCRESTART, 0);
+}
+
+void GarbageCollector::SetBudget(double ratio, double minTime, double maxTime) noexcept
+{
+    m_dBudgetRatio = std::max(0., ratio);
+    m_dMinTime = std::max(0., minTime);
+    m_dMaxTime = std::max(m_dMinTime, maxTime);
+}
+
+double GarbageCollector::Update(double idleTime) noexcept
+{
+    m_dLastBudget = 0.;
+    m_dLastTime = 0.;
+    if (m_uSuspendCount > 0)
+        return 0.;
+
+    // 从上一帧的空闲时间中计算本帧预算
+    auto budget = std::clamp(idleTime * m_dBudgetRatio, m_dMinTime, m_dMaxTime);
+    auto heapKb = lua_gc(m_stMainThread, LUA_GCCOUNT, 0);
+    if (m_iBaselineKb > 0 && heapKb > std::max(m_iBaselineKb * kEmergencyRatio, m_iBaselineKb + kEmergencyMinGrowthKb))
+        budget = m_dMaxTime * kEmergencyBudgetScale;
+
+    auto start = chrono::steady_clock::now();
+    auto deadline = start + chrono::duration_cast<chrono::steady_clock::duration>(chrono::duration<double>(budget));
+    do
+    {
+        // 完成一个周期后留到下一帧再开始新的周期
+        if (lua_gc(m_stMainThread, LUA_GCSTEP, kStepSizeKb) != 0)
+        {
+            m_iBaselineKb = lua_gc(m_stMainThread, LUA_GCCOUNT, 0);
+            break;
+        }
+    } while (chrono::steady_clock::now() < deadline);
+
+    m_dLastBudget = budget;
+    m_dLastTime = chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - start).count() / 1000000000.;
+    return m_dLastTime;
+}
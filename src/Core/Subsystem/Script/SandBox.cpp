@@ -15,7 +15,7 @@ using namespace lstg::Subsystem::Script;
 LSTG_DEF_LOG_CATEGORY(SandBox);
 
 SandBox::SandBox(VirtualFileSystem& fs, LuaStack mainThread)
-    : m_stFileSystem(fs), m_stMainThread(mainThread)
+    : m_stFileSystem(fs), m_stMainThread(mainThread), m_stBytecodeCache(fs)
 {
 #ifdef LSTG_SHIPPING
     m_dCheckInterval = 0.;
@@ -172,18 +172,25 @@ Result<void> SandBox::ExecFile(ImportedFile& file)
     assert(!file.Env.IsEmptyOrNil());
 
     // 读取文件
-    vector<uint8_t> buffer;
-    auto ret = m_stFileSystem.ReadFile(buffer, file.Path.ToStringView());
-    if (!ret)
+    // 内存映射的文件直接交给编译器，此时 storage 不会被使用
+    vector<uint8_t> storage;
+    Result<Span<const uint8_t>> buffer = make_error_code(errc::io_error);
+    auto stream = m_stFileSystem.OpenFile(file.Path.ToStringView(), VFS::FileAccessMode::Read);
+    if (stream)
+        buffer = VFS::ReadAllView(storage, stream->get());
+    else
+        buffer = stream.GetError();
+    if (!buffer)
     {
-        auto ec = ret.GetError();
+        auto ec = buffer.GetError();
         LSTG_LOG_ERROR_CAT(SandBox, "Fail to read file \"{}\" ({}:{})", file.Path.ToStringView(), ec.category().name(), ec.value());
         return ec;
     }
 
     // 加载文件
     lua_checkstack(m_stMainThread, 2);
-    auto load = luaL_loadbuffer(m_stMainThread, reinterpret_cast<const char*>(buffer.data()), buffer.size(), file.LuaChunkName.c_str());
+    auto load = m_stBytecodeCache.Load(m_stMainThread, *buffer, file.Path.ToStringView(), file.LastModified,
+        file.LuaChunkName.c_str());
     if (load != 0)
     {
         LSTG_LOG_ERROR_CAT(SandBox, "Fail to compile file \"{}\": {}", file.Path.ToStringView(), lua_tostring(m_stMainThread, -1));
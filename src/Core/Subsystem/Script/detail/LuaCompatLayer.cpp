@@ -1138,5 +1138,33 @@ void LuaCompatLayer::Register(LuaState& state)
     lua_rawseti(state, -2, 1);
     lua_pop(state, 2);
 
+    // </editor-fold>
+    // <editor-fold desc="ffi">
+
+#ifdef LSTG_LUAJIT_FFI
+    // ffi 可以绕过沙箱直接读写内存，不对脚本开放，仅保存在注册表中供引擎内部使用
+    lua_getglobal(state, "package");  // package
+    lua_getfield(state, -1, "preload");  // package preload
+    assert(lua_istable(state, -1));
+    lua_getfield(state, -1, "ffi");  // package preload f|n
+    if (lua_isfunction(state, -1))
+    {
+        lua_pushstring(state, "ffi");  // package preload f s
+        lua_call(state, 1, 1);  // package preload ffi
+        lua_setfield(state, LUA_REGISTRYINDEX, kFFIModuleKey);  // package preload
+    }
+    else
+    {
+        lua_pop(state, 1);  // package preload
+        LSTG_LOG_WARN_CAT(LuaCompatLayer, "FFI module not found");
+    }
+    lua_pushnil(state);
+    lua_setfield(state, -2, "ffi");
+    lua_getfield(state, -2, "loaded");  // package preload loaded
+    lua_pushnil(state);
+    lua_setfield(state, -2, "ffi");
+    lua_pop(state, 3);
+#endif
+
     // </editor-fold>
 }
@@ -15,6 +15,11 @@ namespace lstg::Subsystem::Script::detail
     class LuaCompatLayer
     {
     public:
+        /**
+         * FFI 模块在注册表中的键
+         */
+        static constexpr const char* kFFIModuleKey = "__lstg_ffi";
+
         /**
          * 注册兼容层
          * @param state 状态机
@@ -6,6 +6,7 @@
  */
 #include <lstg/Core/Subsystem/ScriptSystem.hpp>
 
+#include <lstg/Core/AppBase.hpp>
 #include <lstg/Core/Logging.hpp>
 #include <lstg/Core/Subsystem/ProfileSystem.hpp>
 #include <lstg/Core/Subsystem/Script/LuaPush.hpp>
@@ -89,8 +90,9 @@ namespace
             const char* chunkName = lua_pushfstring(L, "@%s", path);
 
             // 读取文件
+            auto& vfs = self->GetSandBox().GetVirtualFileSystem();
             vector<uint8_t> buffer;
-            auto ret = self->GetSandBox().GetVirtualFileSystem().ReadFile(buffer, fullPath);
+            auto ret = vfs.ReadFile(buffer, fullPath);
             if (ret)
             {
                 auto p = buffer.data();
@@ -106,8 +108,9 @@ namespace
                     }
                 }
 
-                // 编译
-                luaL_loadbuffer(L, reinterpret_cast<const char*>(p), l, chunkName);
+                // 编译，优先使用字节码缓存
+                auto attr = vfs.GetFileAttribute(fullPath);
+                self->GetSandBox().GetBytecodeCache().Load(L, { p, l }, fullPath, attr ? attr->LastModified : 0, chunkName);
                 return 1;
             }
             
@@ -151,7 +154,8 @@ namespace
 }
 
 ScriptSystem::ScriptSystem(SubsystemContainer& container)
-    : m_stSandBox(*(container.Get<VirtualFileSystem>()), m_stState), m_stIoWorkingDirectory("/")
+    : m_stSandBox(*(container.Get<VirtualFileSystem>()), m_stState), m_stCoroutineScheduler(m_stState),
+    m_stGarbageCollector(m_stState), m_stIoWorkingDirectory("/")
 {
     Script::LuaStack::BalanceChecker stackChecker(m_stState);
 
@@ -212,16 +216,22 @@ Result<void> ScriptSystem::LoadScript(std::string_view path, bool sandbox) noexc
     }
 
     // 读取文件
-    vector<uint8_t> buffer;
-    auto ret = GetSandBox().GetVirtualFileSystem().ReadFile(buffer, fullPath);
-    if (!ret)
-        return ret.GetError();
+    // 内存映射的文件直接交给编译器，此时 storage 不会被使用
+    auto& vfs = GetSandBox().GetVirtualFileSystem();
+    auto attr = vfs.GetFileAttribute(fullPath);
+    vector<uint8_t> storage;
+    auto stream = vfs.OpenFile(fullPath, VFS::FileAccessMode::Read);
+    if (!stream)
+        return stream.GetError();
+    auto buffer = VFS::ReadAllView(storage, stream->get());
+    if (!buffer)
+        return buffer.GetError();
 
     // 编译
     try
     {
         string chunkName = fmt::format("@{}", path);
-        auto load = luaL_loadbuffer(m_stState, reinterpret_cast<const char*>(buffer.data()), buffer.size(), chunkName.c_str());
+        auto load = m_stSandBox.GetBytecodeCache().Load(m_stState, *buffer, fullPath, attr ? attr->LastModified : 0, chunkName.c_str());
         if (load != 0)
         {
             LSTG_LOG_ERROR_CAT(ScriptSystem, "Fail to compile \"{}\": {}", path, lua_tostring(m_stState, -1));
@@ -247,25 +257,40 @@ Result<void> ScriptSystem::LoadScript(std::string_view path, bool sandbox) noexc
     return {};
 }
 
+bool ScriptSystem::PushFFIModule() noexcept
+{
+#ifdef LSTG_LUAJIT_FFI
+    lua_getfield(m_stState, LUA_REGISTRYINDEX, Script::detail::LuaCompatLayer::kFFIModuleKey);
+    if (lua_istable(m_stState, -1))
+        return true;
+    lua_pop(m_stState, 1);
+#endif
+    return false;
+}
+
 void ScriptSystem::OnUpdate(double elapsedTime) noexcept
 {
     m_stSandBox.Update(elapsedTime);
 
-    {
-#ifdef LSTG_DEVELOPMENT
-        LSTG_PER_FRAME_PROFILE(ScriptSystem_AggressiveGC);
-#endif
-        lua_gc(m_stState, LUA_GCSTEP, 100);  // 每帧主动回收 100kb
-    }
-
-#ifdef LSTG_DEVELOPMENT
-    auto vmMemoryKb = lua_gc(m_stState, LUA_GCCOUNT, 0);
-    Subsystem::ProfileSystem::GetInstance().SetPerformanceCounter(Subsystem::PerformanceCounterTypes::PerFrame, "ScriptSystem_VMHeapSize",
-        static_cast<double>(vmMemoryKb));
-#endif
+    RunGarbageCollection();
 }
 
 void ScriptSystem::LogCallFail(const char* func, const char* what) noexcept
 {
     LSTG_LOG_ERROR_CAT(ScriptSystem, "Fail to call \"{}\": {}", func, what);
 }
+
+void ScriptSystem::RunGarbageCollection() noexcept
+{
+    m_stGarbageCollector.Update(AppBase::GetInstance().GetIdleTime());
+
+#ifdef LSTG_DEVELOPMENT
+    auto& profileSystem = Subsystem::ProfileSystem::GetInstance();
+    profileSystem.SetPerformanceCounter(Subsystem::PerformanceCounterTypes::PerFrame, "ScriptSystem_GCTime",
+        m_stGarbageCollector.GetLastTime());
+    profileSystem.SetPerformanceCounter(Subsystem::PerformanceCounterTypes::PerFrame, "ScriptSystem_GCBudget",
+        m_stGarbageCollector.GetLastBudget());
+    profileSystem.SetPerformanceCounter(Subsystem::PerformanceCounterTypes::PerFrame, "ScriptSystem_VMHeapSize",
+        static_cast<double>(lua_gc(m_stState, LUA_GCCOUNT, 0)));
+#endif
+}
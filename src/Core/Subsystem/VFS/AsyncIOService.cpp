@@ -0,0 +1,465 @@
+/**
+ * @file
+ * @date 2022/9/5
+ * @author 9chu
+ * 此文件为 LuaSTGPlus 项目的一部分，版权与许可声明详见 COPYRIGHT.txt。
+ */
+#include <lstg/Core/Subsystem/VFS/AsyncIOService.hpp>
+
+#include <cerrno>
+#include <lstg/Core/Logging.hpp>
+#include "detail/IoUring.hpp"
+
+using namespace std;
+using namespace lstg;
+using namespace lstg::Subsystem::VFS;
+
+LSTG_DEF_LOG_CATEGORY(AsyncIOService);
+
+static const size_t kReadChunkSize = 64 * 1024;  // 读取到结尾时缓冲区的初始大小
+static const size_t kMaxTransferSize = 1u << 30;  // 单次提交的最大读写长度
+static const unsigned kMaxPassesPerUpdate = 4;  // 每次 Update 最多推进的轮数
+
+struct AsyncIOService::NativeRequest
+{
+    enum class Stages
+    {
+        Open,
+        Transfer,
+        Close,
+    };
+
+    Stages Stage = Stages::Open;
+    bool IsWrite = false;
+    bool InFlight = false;
+    std::string NativePath;
+    int Fd = -1;
+    uint64_t Offset = 0;
+    size_t Length = 0;  // 读取长度，写入时不使用
+    size_t Transferred = 0;
+    std::vector<uint8_t> Buffer;
+    std::error_code Error;
+    AsyncReadCallback ReadCallback;
+    AsyncWriteCallback WriteCallback;
+
+    [[nodiscard]] bool IsTransferDone() const noexcept
+    {
+        if (IsWrite)
+            return Transferred >= Buffer.size();
+        return Length != kReadToEnd && Transferred >= Length;
+    }
+};
+
+AsyncIOService::AsyncIOService(IFileSystem& fileSystem) noexcept
+    : m_stFileSystem(fileSystem)
+{
+}
+
+AsyncIOService::~AsyncIOService()
+{
+    if (!m_pRing)
+        return;
+
+    // 已经提交的请求在完成前内核仍可能访问其缓冲区，必须等待其完成
+    for (auto it = m_stNativeRequests.begin(); it != m_stNativeRequests.end(); )
+    {
+        if (!it->second->InFlight)
+        {
+            detail::IoUring::CloseDescriptor(it->second->Fd);
+            it = m_stNativeRequests.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+    while (!m_stNativeRequests.empty())
+    {
+        if (!m_pRing->Submit(1))
+            break;
+        m_pRing->Poll([this](uint64_t id, int32_t result) noexcept {
+            auto it = m_stNativeRequests.find(id);
+            if (it == m_stNativeRequests.end())
+                return;
+            auto& request = *it->second;
+            if (request.Stage == NativeRequest::Stages::Open)
+                detail::IoUring::CloseDescriptor(result);
+            else if (request.Stage == NativeRequest::Stages::Transfer)
+                detail::IoUring::CloseDescriptor(request.Fd);
+            m_stNativeRequests.erase(it);
+        });
+    }
+}
+
+Result<void> AsyncIOService::Read(Path path, uint64_t offset, size_t length, AsyncReadCallback callback) noexcept
+{
+    if (IsNativeAvailable())
+    {
+        auto nativePath = m_stFileSystem.GetNativePath(path);
+        if (nativePath)
+        {
+            try
+            {
+                auto request = make_unique<NativeRequest>();
+                request->NativePath = nativePath->string();
+                request->Offset = offset;
+                request->Length = length;
+                if (length != kReadToEnd)
+                    request->Buffer.resize(length);
+                request->ReadCallback = std::move(callback);
+                return CommitNative(std::move(request));
+            }
+            catch (...)  // bad_alloc
+            {
+                return make_error_code(errc::not_enough_memory);
+            }
+        }
+    }
+
+    // 回退到线程池
+    auto pool = GetThreadPool();
+    if (!pool)
+        return make_error_code(errc::not_enough_memory);
+    try
+    {
+        auto job = [&fs = m_stFileSystem, path = std::move(path), offset, length]() {
+            auto stream = fs.OpenFile(path, FileAccessMode::Read, FileOpenFlags::None).ThrowIfError();
+            if (offset != 0)
+                stream->Seek(static_cast<int64_t>(offset), StreamSeekOrigins::Begin).ThrowIfError();
+
+            std::vector<uint8_t> data;
+            if (length == kReadToEnd)
+            {
+                ReadAll(data, stream.get()).ThrowIfError();
+                return data;
+            }
+
+            data.resize(length);
+            size_t filled = 0;
+            while (filled < length)
+            {
+                auto read = stream->Read(data.data() + filled, length - filled).ThrowIfError();
+                if (read == 0)
+                    break;
+                filled += read;
+            }
+            data.resize(filled);
+            return data;
+        };
+        auto completed = [this, callback = std::move(callback)](std::error_code ec, std::vector<uint8_t> data) {
+            assert(m_uFallbackPending > 0);
+            --m_uFallbackPending;
+            if (callback)
+                callback(ec, std::move(data));
+        };
+        pool->Commit<std::vector<uint8_t>>(std::move(job), std::move(completed));
+        ++m_uFallbackPending;
+    }
+    catch (...)  // bad_alloc
+    {
+        return make_error_code(errc::not_enough_memory);
+    }
+    return {};
+}
+
+Result<void> AsyncIOService::Write(Path path, std::vector<uint8_t> data, AsyncWriteCallback callback) noexcept
+{
+    if (IsNativeAvailable())
+    {
+        auto nativePath = m_stFileSystem.GetNativePath(path);
+        if (nativePath)
+        {
+            try
+            {
+                auto request = make_unique<NativeRequest>();
+                request->IsWrite = true;
+                request->NativePath = nativePath->string();
+                request->Buffer = std::move(data);
+                request->WriteCallback = std::move(callback);
+                return CommitNative(std::move(request));
+            }
+            catch (...)  // bad_alloc
+            {
+                return make_error_code(errc::not_enough_memory);
+            }
+        }
+    }
+
+    // 回退到线程池
+    auto pool = GetThreadPool();
+    if (!pool)
+        return make_error_code(errc::not_enough_memory);
+    try
+    {
+        auto job = [&fs = m_stFileSystem, path = std::move(path), data = std::move(data)]() {
+            auto stream = fs.OpenFile(path, FileAccessMode::Write, FileOpenFlags::Truncate).ThrowIfError();
+            stream->Write(data.data(), data.size()).ThrowIfError();
+            stream->Flush().ThrowIfError();
+        };
+        auto completed = [this, callback = std::move(callback)](std::error_code ec) {
+            assert(m_uFallbackPending > 0);
+            --m_uFallbackPending;
+            if (callback)
+                callback(ec);
+        };
+        pool->Commit<void>(std::move(job), std::move(completed));
+        ++m_uFallbackPending;
+    }
+    catch (...)  // bad_alloc
+    {
+        return make_error_code(errc::not_enough_memory);
+    }
+    return {};
+}
+
+void AsyncIOService::Update() noexcept
+{
+    if (m_pThreadPool)
+        m_pThreadPool->Update();
+
+    if (!m_pRing || m_stNativeRequests.empty())
+        return;
+
+    std::vector<NativeRequestPtr> finished;
+    try
+    {
+        // 完成一个阶段后立即提交下一阶段，页缓存命中时一次 Update 内即可走完打开、读写、关闭
+        for (unsigned pass = 0; pass < kMaxPassesPerUpdate; ++pass)
+        {
+            while (!m_stBacklog.empty())
+            {
+                auto it = m_stNativeRequests.find(m_stBacklog.front());
+                if (it != m_stNativeRequests.end() && !PrepareNativeStage(it->first, *it->second))
+                    break;
+                m_stBacklog.pop_front();
+            }
+
+            auto ret = m_pRing->Submit();
+            if (!ret)
+            {
+                LSTG_LOG_ERROR_CAT(AsyncIOService, "Submit io_uring requests fail: {}", ret.GetError());
+                break;
+            }
+
+            auto count = m_pRing->Poll([&](uint64_t id, int32_t result) {
+                auto it = m_stNativeRequests.find(id);
+                assert(it != m_stNativeRequests.end());
+                auto& request = *it->second;
+                request.InFlight = false;
+
+                if (OnNativeCompleted(request, result))
+                {
+                    finished.emplace_back(std::move(it->second));
+                    m_stNativeRequests.erase(it);
+                }
+                else if (!PrepareNativeStage(id, request))
+                {
+                    m_stBacklog.push_back(id);
+                }
+            });
+            if (count == 0)
+                break;
+        }
+        m_pRing->Submit();
+    }
+    catch (...)  // bad_alloc
+    {
+        LSTG_LOG_ERROR_CAT(AsyncIOService, "Not enough memory when dispatching io_uring completions");
+    }
+
+    // 执行回调，回调中可以发起新的请求
+    for (auto& request : finished)
+    {
+        try
+        {
+            if (request->IsWrite)
+            {
+                if (request->WriteCallback)
+                    request->WriteCallback(request->Error);
+            }
+            else if (request->ReadCallback)
+            {
+                if (request->Error)
+                    request->Buffer.clear();
+                else
+                    request->Buffer.resize(request->Transferred);
+                request->ReadCallback(request->Error, std::move(request->Buffer));
+            }
+        }
+        catch (const std::exception& ex)
+        {
+            LSTG_LOG_ERROR_CAT(AsyncIOService, "Unhandled exception in completion callback: {}", ex.what());
+        }
+        catch (...)
+        {
+            LSTG_LOG_ERROR_CAT(AsyncIOService, "Unhandled exception in completion callback");
+        }
+    }
+}
+
+size_t AsyncIOService::GetPendingCount() const noexcept
+{
+    return m_stNativeRequests.size() + m_uFallbackPending;
+}
+
+bool AsyncIOService::IsNativeAvailable() noexcept
+{
+    // 延迟创建，没有使用异步 I/O 时不占用内核资源
+    if (!m_bRingInitialized)
+    {
+        m_bRingInitialized = true;
+        if (detail::IoUring::IsSupported())
+        {
+            try
+            {
+                m_pRing = make_unique<detail::IoUring>(kQueueDepth);
+                LSTG_LOG_INFO_CAT(AsyncIOService, "Async I/O is backed by io_uring");
+            }
+            catch (const system_error& ex)
+            {
+                LSTG_LOG_INFO_CAT(AsyncIOService, "io_uring is not available, fallback to thread pool: {}", ex.code());
+            }
+            catch (...)  // bad_alloc
+            {
+                LSTG_LOG_ERROR_CAT(AsyncIOService, "Not enough memory when creating io_uring");
+            }
+        }
+    }
+    return m_pRing != nullptr;
+}
+
+Result<void> AsyncIOService::CommitNative(NativeRequestPtr request) noexcept
+{
+    assert(m_pRing);
+    auto id = m_ullNextRequestId++;
+    auto& ref = *request;
+    try
+    {
+        m_stNativeRequests.emplace(id, std::move(request));
+        if (!PrepareNativeStage(id, ref))
+            m_stBacklog.push_back(id);
+    }
+    catch (...)  // bad_alloc
+    {
+        if (!ref.InFlight)
+            m_stNativeRequests.erase(id);
+        return make_error_code(errc::not_enough_memory);
+    }
+
+    // 立即提交，使 I/O 尽早开始
+    auto ret = m_pRing->Submit();
+    if (!ret)
+        LSTG_LOG_WARN_CAT(AsyncIOService, "Submit io_uring requests fail, retry on next update: {}", ret.GetError());
+    return {};
+}
+
+bool AsyncIOService::PrepareNativeStage(uint64_t id, NativeRequest& request) noexcept
+{
+    assert(m_pRing && !request.InFlight);
+
+    bool prepared = false;
+    switch (request.Stage)
+    {
+        case NativeRequest::Stages::Open:
+            prepared = m_pRing->PrepareOpen(id, request.NativePath.c_str(), request.IsWrite);
+            break;
+        case NativeRequest::Stages::Transfer:
+            if (request.IsWrite)
+            {
+                auto count = std::min(request.Buffer.size() - request.Transferred, kMaxTransferSize);
+                prepared = m_pRing->PrepareWrite(id, request.Fd, request.Buffer.data() + request.Transferred,
+                    static_cast<uint32_t>(count), request.Transferred);
+            }
+            else
+            {
+                // 读取到结尾时按需扩大缓冲区
+                if (request.Length == kReadToEnd && request.Transferred == request.Buffer.size())
+                {
+                    try
+                    {
+                        request.Buffer.resize(std::max(kReadChunkSize, request.Buffer.size() * 2));
+                    }
+                    catch (...)  // bad_alloc
+                    {
+                        request.Error = make_error_code(errc::not_enough_memory);
+                        request.Stage = NativeRequest::Stages::Close;
+                        return PrepareNativeStage(id, request);
+                    }
+                }
+                auto count = std::min(request.Buffer.size() - request.Transferred, kMaxTransferSize);
+                prepared = m_pRing->PrepareRead(id, request.Fd, request.Buffer.data() + request.Transferred,
+                    static_cast<uint32_t>(count), request.Offset + request.Transferred);
+            }
+            break;
+        case NativeRequest::Stages::Close:
+            prepared = m_pRing->PrepareClose(id, request.Fd);
+            break;
+        default:
+            assert(false);
+            break;
+    }
+    request.InFlight = prepared;
+    return prepared;
+}
+
+bool AsyncIOService::OnNativeCompleted(NativeRequest& request, int32_t result) noexcept
+{
+    switch (request.Stage)
+    {
+        case NativeRequest::Stages::Open:
+            if (result < 0)
+            {
+                request.Error = error_code(-result, system_category());
+                return true;
+            }
+            request.Fd = result;
+            request.Stage = request.IsTransferDone() ? NativeRequest::Stages::Close : NativeRequest::Stages::Transfer;
+            return false;
+        case NativeRequest::Stages::Transfer:
+            if (result < 0)
+            {
+                if (-result == EINTR || -result == EAGAIN)
+                    return false;  // 重试
+                request.Error = error_code(-result, system_category());
+                request.Stage = NativeRequest::Stages::Close;
+                return false;
+            }
+            if (result == 0)
+            {
+                // 读取到达文件结尾；写入没有进展视为错误
+                if (request.IsWrite)
+                    request.Error = make_error_code(errc::io_error);
+                request.Stage = NativeRequest::Stages::Close;
+                return false;
+            }
+            request.Transferred += static_cast<size_t>(result);
+            if (request.IsTransferDone())
+                request.Stage = NativeRequest::Stages::Close;
+            return false;
+        case NativeRequest::Stages::Close:
+            request.Fd = -1;
+            if (result < 0 && !request.Error)
+                request.Error = error_code(-result, system_category());
+            return true;
+        default:
+            assert(false);
+            return true;
+    }
+}
+
+ThreadPool<>* AsyncIOService::GetThreadPool() noexcept
+{
+    if (!m_pThreadPool)
+    {
+        try
+        {
+            m_pThreadPool = make_unique<ThreadPool<>>(kFallbackThreadCount);
+        }
+        catch (...)  // bad_alloc or system_error
+        {
+            LSTG_LOG_ERROR_CAT(AsyncIOService, "Create I/O thread pool fail");
+            return nullptr;
+        }
+    }
+    return m_pThreadPool.get();
+}
@@ -0,0 +1,143 @@
+/**
+ * @file
+ * @date 2022/9/3
+ * @author 9chu
+ * 此文件为 LuaSTGPlus 项目的一部分，版权与许可声明详见 COPYRIGHT.txt。
+ */
+#include <lstg/Core/Subsystem/VFS/BlockCache.hpp>
+
+#include <cassert>
+
+using namespace std;
+using namespace lstg;
+using namespace lstg::Subsystem::VFS;
+
+uint64_t BlockCache::AllocArchiveId() noexcept
+{
+    static atomic<uint64_t> kNextId { 1 };
+    return kNextId.fetch_add(1, memory_order_relaxed);
+}
+
+BlockCache::BlockCache(size_t capacity) noexcept
+    : m_uCapacity(capacity), m_ullHits(0), m_ullMisses(0)
+{
+}
+
+size_t BlockCache::GetCapacity() const noexcept
+{
+    lock_guard<mutex> guard(m_stMutex);
+    return m_uCapacity;
+}
+
+void BlockCache::SetCapacity(size_t capacity) noexcept
+{
+    lock_guard<mutex> guard(m_stMutex);
+    m_uCapacity = capacity;
+    Evict();
+}
+
+BlockCache::BlockPtr BlockCache::Get(const Key& key) noexcept
+{
+    lock_guard<mutex> guard(m_stMutex);
+    auto it = m_stLookupTable.find(key);
+    if (it == m_stLookupTable.end())
+    {
+        m_ullMisses.fetch_add(1, memory_order_relaxed);
+        return nullptr;
+    }
+    m_ullHits.fetch_add(1, memory_order_relaxed);
+    m_stNodes.splice(m_stNodes.begin(), m_stNodes, it->second);
+    return it->second->second;
+}
+
+void BlockCache::Put(const Key& key, BlockPtr block) noexcept
+{
+    assert(block);
+    auto size = block->size();
+
+    lock_guard<mutex> guard(m_stMutex);
+    if (size > m_uCapacity)
+        return;
+
+    try
+    {
+        auto it = m_stLookupTable.find(key);
+        if (it != m_stLookupTable.end())
+        {
+            assert(m_uUsedBytes >= it->second->second->size());
+            m_uUsedBytes -= it->second->second->size();
+            it->second->second = std::move(block);
+            m_stNodes.splice(m_stNodes.begin(), m_stNodes, it->second);
+        }
+        else
+        {
+            m_stNodes.emplace_front(key, std::move(block));
+            try
+            {
+                m_stLookupTable.emplace(key, m_stNodes.begin());
+            }
+            catch (...)
+            {
+                m_stNodes.pop_front();
+                throw;
+            }
+        }
+        m_uUsedBytes += size;
+    }
+    catch (...)  // bad_alloc
+    {
+        // 缓存失败不影响读取，直接忽略
+        return;
+    }
+    Evict();
+}
+
+void BlockCache::Purge(uint64_t archive) noexcept
+{
+    lock_guard<mutex> guard(m_stMutex);
+    for (auto it = m_stNodes.begin(); it != m_stNodes.end(); )
+    {
+        if (it->first.Archive == archive)
+        {
+            m_uUsedBytes -= it->second->size();
+            m_stLookupTable.erase(it->first);
+            it = m_stNodes.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+void BlockCache::Clear() noexcept
+{
+    lock_guard<mutex> guard(m_stMutex);
+    m_stLookupTable.clear();
+    m_stNodes.clear();
+    m_uUsedBytes = 0;
+}
+
+BlockCache::Statistics BlockCache::GetStatistics() const noexcept
+{
+    Statistics ret;
+    ret.Hits = m_ullHits.load(memory_order_relaxed);
+    ret.Misses = m_ullMisses.load(memory_order_relaxed);
+
+    lock_guard<mutex> guard(m_stMutex);
+    ret.UsedBytes = m_uUsedBytes;
+    ret.Capacity = m_uCapacity;
+    return ret;
+}
+
+void BlockCache::Evict() noexcept
+{
+    while (m_uUsedBytes > m_uCapacity && !m_stNodes.empty())
+    {
+        auto& back = m_stNodes.back();
+        assert(m_uUsedBytes >= back.second->size());
+        m_uUsedBytes -= back.second->size();
+        m_stLookupTable.erase(back.first);
+        m_stNodes.pop_back();
+    }
+}
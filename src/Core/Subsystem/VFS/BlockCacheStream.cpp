@@ -0,0 +1,208 @@
+/**
+ * @file
+ * @date 2022/9/3
+ * @author 9chu
+ * 此文件为 LuaSTGPlus 项目的一部分，版权与许可声明详见 COPYRIGHT.txt。
+ */
+#include <lstg/Core/Subsystem/VFS/BlockCacheStream.hpp>
+
+#include <limits>
+
+using namespace std;
+using namespace lstg;
+using namespace lstg::Subsystem::VFS;
+
+BlockCacheStream::BlockCacheStream(StreamPtr underlay, BlockCachePtr cache, uint64_t archive, uint64_t entry, uint64_t length) noexcept
+    : m_pUnderlayStream(std::move(underlay)), m_pCache(std::move(cache)), m_ullArchiveId(archive), m_ullEntryId(entry),
+    m_ullLength(length)
+{
+    assert(m_pUnderlayStream && m_pCache);
+}
+
+BlockCacheStream::BlockCacheStream(const BlockCacheStream& org)
+    : m_pCache(org.m_pCache), m_ullArchiveId(org.m_ullArchiveId), m_ullEntryId(org.m_ullEntryId), m_ullLength(org.m_ullLength),
+    m_ullPosition(org.m_ullPosition), m_ullUnderlayPosition(org.m_ullUnderlayPosition),
+    m_ullCurrentBlockIndex(org.m_ullCurrentBlockIndex), m_pCurrentBlock(org.m_pCurrentBlock)
+{
+    auto clone = org.m_pUnderlayStream->Clone();
+    clone.ThrowIfError();
+    m_pUnderlayStream = std::move(*clone);
+}
+
+bool BlockCacheStream::IsReadable() const noexcept
+{
+    return true;
+}
+
+bool BlockCacheStream::IsWriteable() const noexcept
+{
+    return false;
+}
+
+bool BlockCacheStream::IsSeekable() const noexcept
+{
+    return m_pUnderlayStream->IsSeekable();
+}
+
+Result<uint64_t> BlockCacheStream::GetLength() const noexcept
+{
+    return m_ullLength;
+}
+
+Result<void> BlockCacheStream::SetLength(uint64_t length) noexcept
+{
+    return make_error_code(errc::not_supported);
+}
+
+Result<uint64_t> BlockCacheStream::GetPosition() const noexcept
+{
+    return m_ullPosition;
+}
+
+Result<void> BlockCacheStream::Seek(int64_t offset, StreamSeekOrigins origin) noexcept
+{
+    // 只修改读取位置，数据在读取时按块加载
+    uint64_t base = 0;
+    switch (origin)
+    {
+        case StreamSeekOrigins::Begin:
+            base = 0;
+            break;
+        case StreamSeekOrigins::Current:
+            base = m_ullPosition;
+            break;
+        case StreamSeekOrigins::End:
+            base = m_ullLength;
+            break;
+        default:
+            assert(false);
+            return make_error_code(errc::invalid_argument);
+    }
+
+    // 与 WindowedStream 一致，超出范围时限定到边界
+    if (offset < 0)
+        m_ullPosition = base - std::min(base, static_cast<uint64_t>(-offset));
+    else
+        m_ullPosition = base + std::min(m_ullLength - std::min(base, m_ullLength), static_cast<uint64_t>(offset));
+    return {};
+}
+
+Result<bool> BlockCacheStream::IsEof() const noexcept
+{
+    return m_ullPosition >= m_ullLength;
+}
+
+Result<void> BlockCacheStream::Flush() noexcept
+{
+    return {};
+}
+
+Result<size_t> BlockCacheStream::Read(uint8_t* buffer, size_t length) noexcept
+{
+    size_t total = 0;
+    while (length > 0 && m_ullPosition < m_ullLength)
+    {
+        auto index = m_ullPosition / BlockCache::kBlockSize;
+        if (!m_pCurrentBlock || m_ullCurrentBlockIndex != index)
+        {
+            auto ret = LoadBlock(index);
+            if (!ret)
+            {
+                // 已经读出的部分仍然有效，错误在下次读取时返回
+                if (total > 0)
+                    break;
+                return ret.GetError();
+            }
+        }
+
+        assert(m_pCurrentBlock);
+        auto offset = static_cast<size_t>(m_ullPosition - index * BlockCache::kBlockSize);
+        assert(offset < m_pCurrentBlock->size());
+        auto count = std::min(length, m_pCurrentBlock->size() - offset);
+        ::memcpy(buffer, m_pCurrentBlock->data() + offset, count);
+        buffer += count;
+        length -= count;
+        total += count;
+        m_ullPosition += count;
+    }
+    return total;
+}
+
+Result<void> BlockCacheStream::Write(const uint8_t* buffer, size_t length) noexcept
+{
+    return make_error_code(errc::not_supported);
+}
+
+Result<StreamPtr> BlockCacheStream::Clone() const noexcept
+{
+    try
+    {
+        return make_shared<BlockCacheStream>(*this);
+    }
+    catch (const system_error& ex)
+    {
+        return ex.code();
+    }
+    catch (...)  // bad_alloc
+    {
+        return make_error_code(errc::not_enough_memory);
+    }
+}
+
+Result<void> BlockCacheStream::LoadBlock(uint64_t index) noexcept
+{
+    BlockCache::Key key { m_ullArchiveId, m_ullEntryId, index };
+    auto block = m_pCache->Get(key);
+    if (!block)
+    {
+        auto start = index * BlockCache::kBlockSize;
+        assert(start < m_ullLength);
+        auto size = static_cast<size_t>(std::min<uint64_t>(BlockCache::kBlockSize, m_ullLength - start));
+
+        // 顺序读取时底层流已经位于块的开头，无需 Seek
+        if (m_ullUnderlayPosition != start)
+        {
+            auto ret = m_pUnderlayStream->Seek(static_cast<int64_t>(start), StreamSeekOrigins::Begin);
+            if (!ret)
+                return ret.GetError();
+            m_ullUnderlayPosition = start;
+        }
+
+        shared_ptr<vector<uint8_t>> data;
+        try
+        {
+            data = make_shared<vector<uint8_t>>(size);
+        }
+        catch (...)  // bad_alloc
+        {
+            return make_error_code(errc::not_enough_memory);
+        }
+
+        size_t filled = 0;
+        while (filled < size)
+        {
+            auto ret = m_pUnderlayStream->Read(data->data() + filled, size - filled);
+            if (!ret)
+            {
+                // 底层位置已不可知，下次强制 Seek
+                m_ullUnderlayPosition = std::numeric_limits<uint64_t>::max();
+                return ret.GetError();
+            }
+            if (*ret == 0)
+                break;
+            filled += *ret;
+            m_ullUnderlayPosition += *ret;
+        }
+
+        // 长度由档案记录，数据提前结束说明档案已损坏
+        if (filled != size)
+            return make_error_code(errc::io_error);
+
+        block = std::move(data);
+        m_pCache->Put(key, block);
+    }
+
+    m_pCurrentBlock = std::move(block);
+    m_ullCurrentBlockIndex = index;
+    return {};
+}
@@ -0,0 +1,220 @@
+/**
+ * @file
+ * @date 2022/9/3
+ * @author 9chu
+ * 此文件为 LuaSTGPlus 项目的一部分，版权与许可声明详见 COPYRIGHT.txt。
+ */
+#include <lstg/Core/Subsystem/VFS/BufferedStream.hpp>
+
+#include <lstg/Core/Subsystem/VFS/BlockCacheStream.hpp>
+
+using namespace std;
+using namespace lstg;
+using namespace lstg::Subsystem::VFS;
+
+BufferedStream::BufferedStream(StreamPtr underlay, size_t bufferSize)
+    : m_pUnderlayStream(std::move(underlay))
+{
+    assert(m_pUnderlayStream && bufferSize > 0);
+    m_stBuffer.resize(bufferSize);
+
+    // 不支持 GetPosition 的流只用于顺序读取，此时起点无关紧要
+    auto position = m_pUnderlayStream->GetPosition();
+    m_ullBufferStart = position ? *position : 0;
+}
+
+BufferedStream::BufferedStream(const BufferedStream& org)
+    : m_stBuffer(org.m_stBuffer), m_ullBufferStart(org.m_ullBufferStart), m_uBufferLength(org.m_uBufferLength),
+    m_uBufferOffset(org.m_uBufferOffset)
+{
+    // 底层流的副本与原始流位于相同位置，缓冲区可以直接复制
+    auto clone = org.m_pUnderlayStream->Clone();
+    clone.ThrowIfError();
+    m_pUnderlayStream = std::move(*clone);
+}
+
+bool BufferedStream::IsReadable() const noexcept
+{
+    return m_pUnderlayStream->IsReadable();
+}
+
+bool BufferedStream::IsWriteable() const noexcept
+{
+    return false;
+}
+
+bool BufferedStream::IsSeekable() const noexcept
+{
+    return m_pUnderlayStream->IsSeekable();
+}
+
+Result<uint64_t> BufferedStream::GetLength() const noexcept
+{
+    return m_pUnderlayStream->GetLength();
+}
+
+Result<void> BufferedStream::SetLength(uint64_t length) noexcept
+{
+    return make_error_code(errc::not_supported);
+}
+
+Result<uint64_t> BufferedStream::GetPosition() const noexcept
+{
+    return m_ullBufferStart + m_uBufferOffset;
+}
+
+Result<void> BufferedStream::Seek(int64_t offset, StreamSeekOrigins origin) noexcept
+{
+    // 转换到绝对位置
+    int64_t base = 0;
+    switch (origin)
+    {
+        case StreamSeekOrigins::Begin:
+            base = 0;
+            break;
+        case StreamSeekOrigins::Current:
+            base = static_cast<int64_t>(m_ullBufferStart + m_uBufferOffset);
+            break;
+        case StreamSeekOrigins::End:
+            {
+                auto length = m_pUnderlayStream->GetLength();
+                if (!length)
+                    return length.GetError();
+                base = static_cast<int64_t>(*length);
+            }
+            break;
+        default:
+            assert(false);
+            return make_error_code(errc::invalid_argument);
+    }
+    auto target = base + offset;
+    if (target < 0)
+        return make_error_code(errc::invalid_argument);
+
+    // 位于缓冲区内时只移动读取位置
+    auto position = static_cast<uint64_t>(target);
+    if (position >= m_ullBufferStart && position <= m_ullBufferStart + m_uBufferLength)
+    {
+        m_uBufferOffset = static_cast<size_t>(position - m_ullBufferStart);
+        return {};
+    }
+
+    // 否则丢弃缓冲区
+    auto ret = m_pUnderlayStream->Seek(target, StreamSeekOrigins::Begin);
+    if (!ret)
+        return ret.GetError();
+    auto current = m_pUnderlayStream->GetPosition();  // 底层流可能对位置做了限定
+    m_ullBufferStart = current ? *current : position;
+    m_uBufferLength = 0;
+    m_uBufferOffset = 0;
+    return {};
+}
+
+Result<bool> BufferedStream::IsEof() const noexcept
+{
+    if (m_uBufferOffset < m_uBufferLength)
+        return false;
+    return m_pUnderlayStream->IsEof();
+}
+
+Result<void> BufferedStream::Flush() noexcept
+{
+    return m_pUnderlayStream->Flush();
+}
+
+Result<size_t> BufferedStream::Read(uint8_t* buffer, size_t length) noexcept
+{
+    size_t total = 0;
+    while (length > 0)
+    {
+        // 先消费缓冲区中的数据
+        if (m_uBufferOffset < m_uBufferLength)
+        {
+            auto count = std::min(length, m_uBufferLength - m_uBufferOffset);
+            ::memcpy(buffer, m_stBuffer.data() + m_uBufferOffset, count);
+            m_uBufferOffset += count;
+            buffer += count;
+            length -= count;
+            total += count;
+            continue;
+        }
+
+        // 缓冲区已经耗尽
+        m_ullBufferStart += m_uBufferLength;
+        m_uBufferLength = 0;
+        m_uBufferOffset = 0;
+
+        // 大块读取不经过缓冲区
+        if (length >= m_stBuffer.size())
+        {
+            auto ret = m_pUnderlayStream->Read(buffer, length);
+            if (!ret)
+            {
+                // 已经读出的部分仍然有效，错误在下次读取时返回
+                if (total > 0)
+                    break;
+                return ret.GetError();
+            }
+            m_ullBufferStart += *ret;
+            total += *ret;
+            break;
+        }
+
+        // 预读
+        auto ret = m_pUnderlayStream->Read(m_stBuffer.data(), m_stBuffer.size());
+        if (!ret)
+        {
+            if (total > 0)
+                break;
+            return ret.GetError();
+        }
+        if (*ret == 0)
+            break;
+        m_uBufferLength = *ret;
+    }
+    return total;
+}
+
+Result<void> BufferedStream::Write(const uint8_t* buffer, size_t length) noexcept
+{
+    return make_error_code(errc::not_supported);
+}
+
+Result<StreamPtr> BufferedStream::Clone() const noexcept
+{
+    try
+    {
+        return make_shared<BufferedStream>(*this);
+    }
+    catch (const system_error& ex)
+    {
+        return ex.code();
+    }
+    catch (...)  // bad_alloc
+    {
+        return make_error_code(errc::not_enough_memory);
+    }
+}
+
+Result<Span<const uint8_t>> BufferedStream::GetMemoryView() const noexcept
+{
+    return m_pUnderlayStream->GetMemoryView();
+}
+
+Result<StreamPtr> Subsystem::VFS::MakeBufferedStream(StreamPtr stream, size_t bufferSize) noexcept
+{
+    assert(stream);
+
+    // 内存中的流和块缓存流本身即可高效地处理小读取
+    if (stream->GetMemoryView() || dynamic_cast<BufferedStream*>(stream.get()) || dynamic_cast<BlockCacheStream*>(stream.get()))
+        return stream;
+
+    try
+    {
+        return make_shared<BufferedStream>(std::move(stream), bufferSize);
+    }
+    catch (...)  // bad_alloc
+    {
+        return make_error_code(errc::not_enough_memory);
+    }
+}
@@ -0,0 +1,327 @@
+/**
+ * @file
+ * @date 2022/8/28
+ * @author 9chu
+ * 此文件为 LuaSTGPlus 项目的一部分，版权与许可声明详见 COPYRIGHT.txt。
+ */
+#include <lstg/Core/Subsystem/VFS/BundleFileSystem.hpp>
+
+#include <cstring>
+#include <lstg/Core/Subsystem/VFS/BufferViewStream.hpp>
+#include <lstg/Core/Subsystem/VFS/WindowedStream.hpp>
+
+using namespace std;
+using namespace lstg;
+using namespace lstg::Subsystem::VFS;
+using namespace lstg::Subsystem::VFS::detail;
+
+namespace
+{
+    const char kBundleMagic[8] = { 'L', 'S', 'T', 'G', 'B', 'D', 'L', '\0' };
+
+    Result<void> ReadExactly(IStream* stream, uint8_t* buffer, size_t length) noexcept
+    {
+        while (length > 0)
+        {
+            auto ret = stream->Read(buffer, length);
+            if (!ret)
+                return ret.GetError();
+            if (*ret == 0)
+                return make_error_code(errc::io_error);
+            buffer += *ret;
+            length -= *ret;
+        }
+        return {};
+    }
+
+    class BundleFileSystemDirectoryIterator :
+        public IDirectoryIterator
+    {
+    public:
+        BundleFileSystemDirectoryIterator(std::vector<std::string> names)
+            : m_stNames(std::move(names))
+        {
+            if (!m_stNames.empty())
+                m_stCurrentName = Path{m_stNames[0]};
+        }
+
+    public:
+        Path GetName() const noexcept override
+        {
+            return m_stCurrentName;
+        }
+
+        Result<void> Next() noexcept override
+        {
+            try
+            {
+                if (m_uIndex + 1 >= m_stNames.size())
+                {
+                    m_uIndex = m_stNames.size();
+                    m_stCurrentName = {};
+                    return make_error_code(errc::result_out_of_range);
+                }
+                m_stCurrentName = Path{m_stNames[++m_uIndex]};
+                return {};
+            }
+            catch (...)  // bad_alloc
+            {
+                return make_error_code(errc::not_enough_memory);
+            }
+        }
+
+    private:
+        std::vector<std::string> m_stNames;
+        size_t m_uIndex = 0;
+        Path m_stCurrentName;
+    };
+}
+
+BundleFileSystem::BundleFileSystem(StreamPtr underlayStream)
+    : m_pUnderlayStream(std::move(underlayStream))
+{
+    assert(m_pUnderlayStream);
+    if (!m_pUnderlayStream->IsSeekable())
+        throw system_error(make_error_code(errc::not_supported));
+
+    m_pUnderlayStream->Seek(0, StreamSeekOrigins::Begin).ThrowIfError();
+    auto length = m_pUnderlayStream->GetLength().ThrowIfError();
+
+    // 读取文件头
+    BundleHeader header {};
+    ReadExactly(m_pUnderlayStream.get(), reinterpret_cast<uint8_t*>(&header), sizeof(header)).ThrowIfError();
+    if (::memcmp(header.Magic, kBundleMagic, sizeof(kBundleMagic)) != 0 || header.Version != kBundleVersion)
+        throw system_error(make_error_code(errc::invalid_argument));
+
+    auto fileTableSize = static_cast<uint64_t>(header.FileCount) * sizeof(BundleFileEntry);
+    if (header.IndexSize < fileTableSize || sizeof(header) + header.IndexSize > length)
+        throw system_error(make_error_code(errc::io_error));
+
+    // 文件表与路径字符串表直接整块读入，不做逐项解析
+    m_stEntries.resize(header.FileCount);
+    m_stPathTable.resize(header.IndexSize - fileTableSize);
+    ReadExactly(m_pUnderlayStream.get(), reinterpret_cast<uint8_t*>(m_stEntries.data()), fileTableSize).ThrowIfError();
+    ReadExactly(m_pUnderlayStream.get(), reinterpret_cast<uint8_t*>(m_stPathTable.data()), m_stPathTable.size()).ThrowIfError();
+
+    // 校验范围，避免损坏的资源束导致越界访问
+    for (size_t i = 0; i < m_stEntries.size(); ++i)
+    {
+        const auto& entry = m_stEntries[i];
+        if (static_cast<uint64_t>(entry.PathOffset) + entry.PathLength > m_stPathTable.size() ||
+            entry.DataOffset > length || entry.DataSize > length - entry.DataOffset)
+        {
+            throw system_error(make_error_code(errc::io_error));
+        }
+        if (i > 0 && !(GetEntryPath(m_stEntries[i - 1]) < GetEntryPath(entry)))
+            throw system_error(make_error_code(errc::invalid_argument));  // 要求严格有序
+    }
+}
+
+Result<void> BundleFileSystem::CreateDirectory(Path path) noexcept
+{
+    return make_error_code(errc::not_supported);
+}
+
+Result<void> BundleFileSystem::Remove(Path path) noexcept
+{
+    return make_error_code(errc::not_supported);
+}
+
+Result<void> BundleFileSystem::Rename(Path from, Path to) noexcept
+{
+    return make_error_code(errc::not_supported);
+}
+
+Result<FileAttribute> BundleFileSystem::GetFileAttribute(Path path) noexcept
+{
+    auto p = path.ToStringView();
+
+    auto file = LocateFile(p);
+    if (file)
+    {
+        FileAttribute ret;
+        ret.Type = FileType::RegularFile;
+        ret.LastModified = static_cast<::time_t>(file->LastModified);
+        ret.Size = file->DataSize;
+        return ret;
+    }
+
+    if (!IsDirectory(p))
+        return make_error_code(errc::no_such_file_or_directory);
+
+    FileAttribute ret;
+    ret.Type = FileType::Directory;
+    ret.LastModified = 0;
+    ret.Size = 0;
+    return ret;
+}
+
+Result<DirectoryIteratorPtr> BundleFileSystem::VisitDirectory(Path path) noexcept
+{
+    auto p = path.ToStringView();
+    if (LocateFile(p))
+        return make_error_code(errc::not_a_directory);
+    if (!IsDirectory(p))
+        return make_error_code(errc::no_such_file_or_directory);
+
+    try
+    {
+        string prefix { p };
+        if (!prefix.empty())
+            prefix.push_back(Path::kSeperator);
+
+        // 同一目录下的条目在有序文件表中是连续的，子目录名同样连续出现，因此只需和上一项比较去重
+        vector<string> names;
+        for (auto i = LowerBound(prefix); i < m_stEntries.size(); ++i)
+        {
+            auto entryPath = GetEntryPath(m_stEntries[i]);
+            if (entryPath.substr(0, prefix.size()) != prefix)
+                break;
+
+            auto name = entryPath.substr(prefix.size());
+            name = name.substr(0, name.find(Path::kSeperator));
+            if (names.empty() || names.back() != name)
+                names.emplace_back(name);
+        }
+        return make_shared<BundleFileSystemDirectoryIterator>(std::move(names));
+    }
+    catch (...)  // bad_alloc
+    {
+        return make_error_code(errc::not_enough_memory);
+    }
+}
+
+Result<StreamPtr> BundleFileSystem::OpenFile(Path path, FileAccessMode access, FileOpenFlags flags) noexcept
+{
+    if (access == FileAccessMode::ReadWrite || access == FileAccessMode::Write)
+        return make_error_code(errc::permission_denied);
+    if (flags & FileOpenFlags::Truncate)
+        return make_error_code(errc::invalid_argument);
+
+    auto p = path.ToStringView();
+    auto file = LocateFile(p);
+    if (!file)
+        return IsDirectory(p) ? make_error_code(errc::invalid_argument) : make_error_code(errc::no_such_file_or_directory);
+
+    // 复制以保证多线程使用安全
+    auto clone = m_pUnderlayStream->Clone();
+    if (!clone)
+        return clone.GetError();
+
+    auto ret = (*clone)->Seek(static_cast<int64_t>(file->DataOffset), StreamSeekOrigins::Begin);
+    if (!ret)
+        return ret.GetError();
+
+    try
+    {
+        // 资源束位于内存中（例如内存映射的文件）时，直接暴露文件数据所在的内存
+        auto view = (*clone)->GetMemoryView();
+        if (view)
+        {
+            if (file->DataOffset > view->GetSize() || file->DataSize > view->GetSize() - file->DataOffset)
+                return make_error_code(errc::io_error);
+            return make_shared<BufferViewStream<const uint8_t>>(
+                Span<const uint8_t> { view->GetData() + file->DataOffset, static_cast<size_t>(file->DataSize) }, std::move(*clone));
+        }
+        return make_shared<WindowedStream>(std::move(*clone), file->DataSize);
+    }
+    catch (...)  // bad_alloc
+    {
+        return make_error_code(errc::not_enough_memory);
+    }
+}
+
+Result<void> BundleFileSystem::EnumerateImmutableEntries(std::vector<std::string_view>& out) noexcept
+{
+    try
+    {
+        string_view last;
+        for (const auto& entry : m_stEntries)
+        {
+            // 文件夹不单独存储，为文件路径的前缀；文件表有序，只需与上一个文件比较即可去重
+            auto path = GetEntryPath(entry);
+            for (auto pos = path.find('/'); pos != string_view::npos; pos = path.find('/', pos + 1))
+            {
+                if (last.size() > pos && last.substr(0, pos + 1) == path.substr(0, pos + 1))
+                    continue;
+                out.push_back(path.substr(0, pos));
+            }
+            out.push_back(path);
+            last = path;
+        }
+        return {};
+    }
+    catch (...)  // bad_alloc
+    {
+        return make_error_code(errc::not_enough_memory);
+    }
+}
+
+const std::string& BundleFileSystem::GetUserData() const noexcept
+{
+    return m_stUserData;
+}
+
+void BundleFileSystem::SetUserData(std::string ud) noexcept
+{
+    m_stUserData = std::move(ud);
+}
+
+std::string_view BundleFileSystem::GetFilePath(size_t index) const noexcept
+{
+    assert(index < m_stEntries.size());
+    return GetEntryPath(m_stEntries[index]);
+}
+
+std::string_view BundleFileSystem::GetEntryPath(const BundleFileEntry& entry) const noexcept
+{
+    return string_view{m_stPathTable}.substr(entry.PathOffset, entry.PathLength);
+}
+
+const BundleFileEntry* BundleFileSystem::LocateFile(std::string_view path) const noexcept
+{
+    auto index = LowerBound(path);
+    if (index < m_stEntries.size() && GetEntryPath(m_stEntries[index]) == path)
+        return &m_stEntries[index];
+    return nullptr;
+}
+
+size_t BundleFileSystem::LowerBound(std::string_view path) const noexcept
+{
+    size_t first = 0;
+    size_t count = m_stEntries.size();
+    while (count > 0)
+    {
+        auto step = count / 2;
+        auto mid = first + step;
+        if (GetEntryPath(m_stEntries[mid]) < path)
+        {
+            first = mid + 1;
+            count -= step + 1;
+        }
+        else
+        {
+            count = step;
+        }
+    }
+    return first;
+}
+
+bool BundleFileSystem::IsDirectory(std::string_view path) const noexcept
+{
+    // 根目录总是存在
+    if (path.empty())
+        return true;
+
+    // 存在以 "path/" 为前缀的文件即视作目录存在
+    auto index = LowerBound(path);
+    for (; index < m_stEntries.size(); ++index)
+    {
+        auto entryPath = GetEntryPath(m_stEntries[index]);
+        if (entryPath.substr(0, path.size()) != path)
+            return false;
+        if (entryPath.size() > path.size() && entryPath[path.size()] == Path::kSeperator)
+            return true;
+    }
+    return false;
+}
@@ -65,3 +65,26 @@ Result<Subsystem::VFS::StreamPtr> Subsystem::VFS::ConvertToSeekableStream(Subsys
     }
     return ret;
 }
+
+Result<Span<const uint8_t>> Subsystem::VFS::ReadAllView(std::vector<uint8_t>& storage, IStream* stream) noexcept
+{
+    assert(stream);
+
+    auto view = stream->GetMemoryView();
+    if (view)
+    {
+        auto position = stream->GetPosition();
+        if (!position)
+            return position.GetError();
+        auto offset = static_cast<size_t>(std::min<uint64_t>(*position, view->GetSize()));
+        auto seek = stream->Seek(0, StreamSeekOrigins::End);
+        if (!seek)
+            return seek.GetError();
+        return Span<const uint8_t> { view->GetData() + offset, view->GetSize() - offset };
+    }
+
+    auto ret = ReadAll(storage, stream);
+    if (!ret)
+        return ret.GetError();
+    return Span<const uint8_t> { storage.data(), storage.size() };
+}
@@ -6,6 +6,9 @@
  */
 #include <lstg/Core/Subsystem/VFS/InflateStream.hpp>
 
+#include <deque>
+#include <mutex>
+#include <vector>
 #include <lstg/Core/Logging.hpp>
 #include "detail/ZStream.hpp"
 #include "detail/ZLibError.hpp"
@@ -16,8 +19,62 @@ using namespace std;
 using namespace lstg;
 using namespace lstg::Subsystem::VFS;
 
+namespace lstg::Subsystem::VFS::detail
+{
+    /**
+     * 解压检查点索引
+     * 参考 zlib 的 zran.c 示例，在 deflate 块边界处记录输入输出偏移、未消费的位和滑动窗口。
+     * 检查点只会追加，不会修改或删除，因此返回的指针在索引存活期间始终有效。
+     */
+    class InflateIndex
+    {
+    public:
+        struct AccessPoint
+        {
+            uint64_t UncompressedOffset = 0;
+            uint64_t CompressedOffset = 0;
+            int Bits = 0;  // CompressedOffset 之前一个字节中尚未消费的位数
+            vector<uint8_t> Window;
+        };
+
+    public:
+        bool NeedAccessPoint(uint64_t uncompressedOffset) const noexcept
+        {
+            lock_guard<mutex> guard(m_stLock);
+            auto last = m_stPoints.empty() ? 0u : m_stPoints.back().UncompressedOffset;
+            return uncompressedOffset >= last + InflateStream::kIndexSpan;
+        }
+
+        void AddAccessPoint(AccessPoint point)
+        {
+            lock_guard<mutex> guard(m_stLock);
+
+            // 多个副本可能同时解压同一段数据，只保留第一个
+            auto last = m_stPoints.empty() ? 0u : m_stPoints.back().UncompressedOffset;
+            if (point.UncompressedOffset < last + InflateStream::kIndexSpan)
+                return;
+            m_stPoints.emplace_back(std::move(point));
+        }
+
+        const AccessPoint* FindAccessPoint(uint64_t uncompressedOffset) const noexcept
+        {
+            lock_guard<mutex> guard(m_stLock);
+            auto it = upper_bound(m_stPoints.begin(), m_stPoints.end(), uncompressedOffset,
+                [](uint64_t offset, const AccessPoint& point) { return offset < point.UncompressedOffset; });
+            if (it == m_stPoints.begin())
+                return nullptr;
+            return &*(--it);
+        }
+
+    private:
+        mutable mutex m_stLock;
+        deque<AccessPoint> m_stPoints;
+    };
+}
+
 InflateStream::InflateStream(StreamPtr underlayStream, std::optional<uint64_t> uncompressedSize)
-    : m_pZStream(std::make_shared<detail::ZStream>(detail::InflateInitTag{}, true)), m_pUnderlayStream(std::move(underlayStream)),
+    : m_pZStream(std::make_shared<detail::ZStream>(detail::InflateInitTag{}, true)),
+    m_pIndex(std::make_shared<detail::InflateIndex>()), m_pUnderlayStream(std::move(underlayStream)),
     m_stUncompressedSize(uncompressedSize)
 {
     assert(m_pUnderlayStream);
@@ -26,7 +83,7 @@ InflateStream::InflateStream(StreamPtr underlayStream, std::optional<uint64_t> u
 }
 
 InflateStream::InflateStream(const InflateStream& org)
-    : m_pZStream(std::make_shared<detail::ZStream>(*org.m_pZStream)), m_bFinished(org.m_bFinished),
+    : m_pZStream(std::make_shared<detail::ZStream>(*org.m_pZStream)), m_pIndex(org.m_pIndex), m_bFinished(org.m_bFinished),
     m_stUncompressedSize(org.m_stUncompressedSize)
 {
     auto clone = org.m_pUnderlayStream->Clone();
@@ -61,7 +118,7 @@ bool InflateStream::IsWriteable() const noexcept
 
 bool InflateStream::IsSeekable() const noexcept
 {
-    return false;
+    return m_pUnderlayStream->IsSeekable();
 }
 
 Result<uint64_t> InflateStream::GetLength() const noexcept
@@ -83,7 +140,47 @@ Result<uint64_t> InflateStream::GetPosition() const noexcept
 
 Result<void> InflateStream::Seek(int64_t offset, StreamSeekOrigins origin) noexcept
 {
-    return make_error_code(errc::not_supported);
+    if (!m_pUnderlayStream->IsSeekable())
+        return make_error_code(errc::not_supported);
+
+    // 计算绝对偏移，范围限定在 [0, 解压后大小]
+    uint64_t position = (**m_pZStream)->total_out;
+    uint64_t target = 0;
+    switch (origin)
+    {
+        case StreamSeekOrigins::Begin:
+            target = static_cast<uint64_t>(std::max<int64_t>(0, offset));
+            break;
+        case StreamSeekOrigins::Current:
+            target = (offset < 0) ? (position - std::min(position, static_cast<uint64_t>(-offset))) :
+                (position + static_cast<uint64_t>(offset));
+            break;
+        case StreamSeekOrigins::End:
+            if (!m_stUncompressedSize)
+                return make_error_code(errc::not_supported);
+            target = (offset < 0) ? (*m_stUncompressedSize - std::min(*m_stUncompressedSize, static_cast<uint64_t>(-offset))) :
+                *m_stUncompressedSize;
+            break;
+        default:
+            assert(false);
+            return make_error_code(errc::invalid_argument);
+    }
+    if (m_stUncompressedSize)
+        target = std::min(target, *m_stUncompressedSize);
+    if (target == position)
+        return {};
+
+    // 向前跳转且中间没有检查点时，直接解压跳过，否则从最近的检查点开始解压
+    auto point = m_pIndex->FindAccessPoint(target);
+    if (target < position || (point && point->UncompressedOffset > position))
+    {
+        auto ret = RestoreAccessPoint(target);
+        if (!ret)
+            return ret.GetError();
+        position = (**m_pZStream)->total_out;
+        assert(position <= target);
+    }
+    return Skip(target - position);
 }
 
 Result<bool> InflateStream::IsEof() const noexcept
@@ -124,8 +221,8 @@ Result<size_t> InflateStream::Read(uint8_t* buffer, size_t length) noexcept
             z->avail_in += *count;
         }
 
-        // 进行解压操作
-        auto ret = ::inflate(z, Z_NO_FLUSH);
+        // 进行解压操作，在每个块的边界处返回以便记录检查点
+        auto ret = ::inflate(z, Z_BLOCK);
         switch (ret)
         {
             case Z_NEED_DICT:
@@ -147,6 +244,10 @@ Result<size_t> InflateStream::Read(uint8_t* buffer, size_t length) noexcept
             m_bFinished = true;
             break;
         }
+
+        // bit7: 位于块边界，bit6: 最后一个块
+        if ((z->data_type & 128) != 0 && (z->data_type & 64) == 0 && m_pIndex->NeedAccessPoint(z->total_out))
+            AddAccessPoint();
     }
     while (z->avail_out != 0);
 
@@ -179,7 +280,7 @@ Result<void> InflateStream::Reset() noexcept
     detail::ZStreamPtr reset;
     try
     {
-        reset = std::make_shared<detail::ZStream>(detail::InflateInitTag{});
+        reset = std::make_shared<detail::ZStream>(detail::InflateInitTag{}, true);
     }
     catch (...)  // bad_alloc
     {
@@ -190,7 +291,90 @@ Result<void> InflateStream::Reset() noexcept
     if (!ret)
         return ret.GetError();
 
+    m_pZStream = reset;
+    (**m_pZStream)->next_in = m_stChunk;
+    (**m_pZStream)->avail_in = 0;
+    m_bFinished = false;
+    return {};
+}
+
+Result<void> InflateStream::RestoreAccessPoint(uint64_t target) noexcept
+{
+    auto point = m_pIndex->FindAccessPoint(target);
+    if (!point)
+        return Reset();
+
+    detail::ZStreamPtr reset;
+    try
+    {
+        reset = std::make_shared<detail::ZStream>(detail::InflateInitTag{}, true);
+    }
+    catch (...)  // bad_alloc
+    {
+        return make_error_code(errc::not_enough_memory);
+    }
+
+    // 检查点可能位于字节中间，此时需要补上前一个字节中尚未消费的位
+    auto z = (**reset);
+    auto ret = m_pUnderlayStream->Seek(static_cast<int64_t>(point->CompressedOffset - (point->Bits ? 1 : 0)), StreamSeekOrigins::Begin);
+    if (!ret)
+        return ret.GetError();
+    if (point->Bits)
+    {
+        uint8_t ch = 0;
+        auto read = m_pUnderlayStream->Read(&ch, 1);
+        if (!read)
+            return read.GetError();
+        if (*read != 1)
+            return make_error_code(errc::io_error);
+        ::inflatePrime(z, point->Bits, ch >> (8 - point->Bits));
+    }
+    ::inflateSetDictionary(z, point->Window.data(), static_cast<uInt>(point->Window.size()));
+    z->next_in = m_stChunk;
+    z->avail_in = 0;
+    z->total_in = static_cast<uLong>(point->CompressedOffset);
+    z->total_out = static_cast<uLong>(point->UncompressedOffset);
+
     m_pZStream = reset;
     m_bFinished = false;
     return {};
 }
+
+void InflateStream::AddAccessPoint() noexcept
+{
+    auto z = (**m_pZStream);
+    try
+    {
+        detail::InflateIndex::AccessPoint point;
+        point.UncompressedOffset = z->total_out;
+        point.CompressedOffset = z->total_in;
+        point.Bits = z->data_type & 7;
+        point.Window.resize(32 * 1024);
+
+        uInt windowSize = 0;
+        auto ret = ::inflateGetDictionary(z, point.Window.data(), &windowSize);
+        if (ret != Z_OK)
+            return;
+        point.Window.resize(windowSize);
+        m_pIndex->AddAccessPoint(std::move(point));
+    }
+    catch (...)  // bad_alloc
+    {
+        // 检查点只用于加速 Seek，失败时忽略
+    }
+}
+
+Result<void> InflateStream::Skip(uint64_t count) noexcept
+{
+    uint8_t discard[4 * 1024];
+    while (count > 0)
+    {
+        auto read = Read(discard, static_cast<size_t>(std::min<uint64_t>(count, sizeof(discard))));
+        if (!read)
+            return read.GetError();
+        if (*read == 0)
+            break;
+        count -= *read;
+    }
+    return {};
+}
@@ -7,6 +7,8 @@
 #include <lstg/Core/Subsystem/VFS/LocalFileSystem.hpp>
 
 #include <lstg/Core/Subsystem/VFS/FileStream.hpp>
+#include <lstg/Core/Subsystem/VFS/MemoryMappedFile.hpp>
+#include "detail/LocalFileWatcher.hpp"
 
 using namespace std;
 using namespace lstg;
@@ -93,6 +95,8 @@ LocalFileSystem::LocalFileSystem(std::filesystem::path root) noexcept
 {
 }
 
+LocalFileSystem::~LocalFileSystem() = default;
+
 Result<void> LocalFileSystem::CreateDirectory(Path path) noexcept
 {
     try
@@ -226,6 +230,15 @@ Result<StreamPtr> LocalFileSystem::OpenFile(Path path, FileAccessMode access, Fi
     try
     {
         auto target = MakeLocalPath(path);
+
+        // 调用方显式要求时才映射到内存，以便上层通过 GetMemoryView 零拷贝访问
+        // 普通文件可能在运行期间被外部修改，始终使用带缓冲的文件流
+        if (access == FileAccessMode::Read && (flags & FileOpenFlags::MemoryMap) && MemoryMappedFile::IsSupported())
+        {
+            auto mapped = MemoryMappedFile::OpenStream(target);
+            if (mapped)
+                return std::move(*mapped);
+        }
         return std::make_shared<FileStream>(target, access, flags);
     }
     catch (const system_error& ex)
@@ -242,6 +255,49 @@ Result<StreamPtr> LocalFileSystem::OpenFile(Path path, FileAccessMode access, Fi
     }
 }
 
+Result<std::filesystem::path> LocalFileSystem::GetNativePath(Path path) noexcept
+{
+    try
+    {
+        return MakeLocalPath(path);
+    }
+    catch (...)  // bad_alloc
+    {
+        return make_error_code(errc::not_enough_memory);
+    }
+}
+
+Result<void> LocalFileSystem::WatchFile(Path path) noexcept
+{
+    if (!detail::LocalFileWatcher::IsSupported())
+        return make_error_code(errc::not_supported);
+
+    try
+    {
+        if (!m_pWatcher)
+            m_pWatcher = make_unique<detail::LocalFileWatcher>(m_stRoot);
+    }
+    catch (...)  // bad_alloc
+    {
+        return make_error_code(errc::not_enough_memory);
+    }
+    return m_pWatcher->Watch(path);
+}
+
+Result<void> LocalFileSystem::UnwatchFile(Path path) noexcept
+{
+    if (!m_pWatcher)
+        return {};
+    return m_pWatcher->Unwatch(path);
+}
+
+Result<void> LocalFileSystem::PollChangedFiles(std::vector<Path>& out) noexcept
+{
+    if (!m_pWatcher)
+        return {};
+    return m_pWatcher->Poll(out);
+}
+
 const std::string& LocalFileSystem::GetUserData() const noexcept
 {
     return m_stUserData;
@@ -0,0 +1,160 @@
+/**
+ * @file
+ * @date 2022/8/30
+ * @author 9chu
+ * 此文件为 LuaSTGPlus 项目的一部分，版权与许可声明详见 COPYRIGHT.txt。
+ */
+#include <lstg/Core/Subsystem/VFS/MemoryMappedFile.hpp>
+
+#include <limits>
+#include <lstg/Core/Subsystem/VFS/BufferViewStream.hpp>
+
+#if defined(LSTG_PLATFORM_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <Windows.h>
+#elif !defined(LSTG_PLATFORM_EMSCRIPTEN)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+using namespace lstg;
+using namespace lstg::Subsystem::VFS;
+
+bool MemoryMappedFile::IsSupported() noexcept
+{
+#ifdef LSTG_PLATFORM_EMSCRIPTEN
+    // Emscripten 的 mmap 实际为整体拷贝，没有收益
+    return false;
+#else
+    return true;
+#endif
+}
+
+Result<StreamPtr> MemoryMappedFile::OpenStream(const std::filesystem::path& path) noexcept
+{
+    if (!IsSupported())
+        return make_error_code(errc::not_supported);
+
+    try
+    {
+        auto file = make_shared<MemoryMappedFile>(path);
+        auto view = file->GetView();
+        return make_shared<BufferViewStream<const uint8_t>>(view, std::move(file));
+    }
+    catch (const system_error& ex)
+    {
+        return ex.code();
+    }
+    catch (...)  // bad_alloc
+    {
+        return make_error_code(errc::not_enough_memory);
+    }
+}
+
+MemoryMappedFile::MemoryMappedFile(const std::filesystem::path& path)
+{
+#if defined(LSTG_PLATFORM_WIN32)
+    auto file = ::CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr,
+        OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        throw system_error(error_code(static_cast<int>(::GetLastError()), system_category()));
+
+    LARGE_INTEGER size;
+    if (!::GetFileSizeEx(file, &size))
+    {
+        auto err = ::GetLastError();
+        ::CloseHandle(file);
+        throw system_error(error_code(static_cast<int>(err), system_category()));
+    }
+    if (static_cast<uint64_t>(size.QuadPart) > std::numeric_limits<size_t>::max())
+    {
+        ::CloseHandle(file);
+        throw system_error(make_error_code(errc::file_too_large));
+    }
+    m_pFileHandle = file;
+    m_uSize = static_cast<size_t>(size.QuadPart);
+
+    // 空文件不能创建映射
+    if (m_uSize == 0)
+        return;
+
+    auto mapping = ::CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mapping)
+    {
+        auto err = ::GetLastError();
+        ::CloseHandle(file);
+        throw system_error(error_code(static_cast<int>(err), system_category()));
+    }
+    m_pMappingHandle = mapping;
+
+    auto data = ::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!data)
+    {
+        auto err = ::GetLastError();
+        ::CloseHandle(mapping);
+        ::CloseHandle(file);
+        throw system_error(error_code(static_cast<int>(err), system_category()));
+    }
+    m_pData = static_cast<const uint8_t*>(data);
+#elif !defined(LSTG_PLATFORM_EMSCRIPTEN)
+    auto fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+        throw system_error(error_code(errno, system_category()));
+
+    struct stat st {};
+    if (::fstat(fd, &st) != 0)
+    {
+        auto err = errno;
+        ::close(fd);
+        throw system_error(error_code(err, system_category()));
+    }
+    if (!S_ISREG(st.st_mode))
+    {
+        ::close(fd);
+        throw system_error(make_error_code(errc::invalid_argument));
+    }
+    if (static_cast<uint64_t>(st.st_size) > std::numeric_limits<size_t>::max())
+    {
+        ::close(fd);
+        throw system_error(make_error_code(errc::file_too_large));
+    }
+    m_uSize = static_cast<size_t>(st.st_size);
+
+    // 空文件不能映射
+    if (m_uSize == 0)
+    {
+        ::close(fd);
+        return;
+    }
+
+    // 映射建立后即可关闭描述符
+    auto data = ::mmap(nullptr, m_uSize, PROT_READ, MAP_PRIVATE, fd, 0);
+    auto err = errno;
+    ::close(fd);
+    if (data == MAP_FAILED)
+        throw system_error(error_code(err, system_category()));
+    m_pData = static_cast<const uint8_t*>(data);
+#else
+    static_cast<void>(path);
+    throw system_error(make_error_code(errc::not_supported));
+#endif
+}
+
+MemoryMappedFile::~MemoryMappedFile()
+{
+#if defined(LSTG_PLATFORM_WIN32)
+    if (m_pData)
+        ::UnmapViewOfFile(m_pData);
+    if (m_pMappingHandle)
+        ::CloseHandle(m_pMappingHandle);
+    if (m_pFileHandle)
+        ::CloseHandle(m_pFileHandle);
+#elif !defined(LSTG_PLATFORM_EMSCRIPTEN)
+    if (m_pData)
+        ::munmap(const_cast<uint8_t*>(m_pData), m_uSize);
+#endif
+}
@@ -8,6 +8,7 @@
 
 #include <set>
 #include <algorithm>
+#include "detail/PathIndex.hpp"
 
 using namespace std;
 using namespace lstg;
@@ -162,6 +163,7 @@ namespace
 void OverlayFileSystem::PushFileSystem(FileSystemPtr fs)
 {
     m_stFileSystems.emplace_back(std::move(fs));
+    RebuildMergedIndex();
 }
 
 bool OverlayFileSystem::PopFileSystem() noexcept
@@ -169,6 +171,7 @@ bool OverlayFileSystem::PopFileSystem() noexcept
     if (m_stFileSystems.empty())
         return false;
     m_stFileSystems.pop_back();
+    RebuildMergedIndex();
     return true;
 }
 
@@ -178,6 +181,7 @@ bool OverlayFileSystem::RemoveFileSystem(const FileSystemPtr& fs) noexcept
     if (it != m_stFileSystems.end())
     {
         m_stFileSystems.erase(it);
+        RebuildMergedIndex();
         return true;
     }
     return false;
@@ -187,6 +191,7 @@ void OverlayFileSystem::RemoveFileSystemAt(size_t index) noexcept
 {
     assert(index < m_stFileSystems.size());
     m_stFileSystems.erase(m_stFileSystems.begin() + index);
+    RebuildMergedIndex();
 }
 
 size_t OverlayFileSystem::GetFileSystemCount() const noexcept
@@ -250,12 +255,21 @@ Result<void> OverlayFileSystem::Rename(Path from, Path to) noexcept
 
 Result<FileAttribute> OverlayFileSystem::GetFileAttribute(Path path) noexcept
 {
+    optional<size_t> hit;
+    auto indexed = LookupMergedIndex(path, hit);
+
     auto ec = make_error_code(errc::no_such_file_or_directory);
-    for (auto it = m_stFileSystems.rbegin(); it != m_stFileSystems.rend(); ++it)
+    for (auto i = m_stFileSystems.size(); i-- > 0;)
     {
-        auto ret = (*it)->GetFileAttribute(path);
+        // 不可变的文件系统中，只有查找表命中的一层可能包含该路径
+        if (indexed && m_stImmutableLayers[i] && hit != i)
+            continue;
+
+        auto ret = m_stFileSystems[i]->GetFileAttribute(path);
         if (ret)
             return ret;
+        if (indexed && hit == i)
+            indexed = false;  // 命中的层失败时，回退到逐层查找
         if (ret.GetError() != make_error_code(errc::not_supported) &&
             ret.GetError() != make_error_code(errc::no_such_file_or_directory))
         {
@@ -287,12 +301,21 @@ Result<DirectoryIteratorPtr> OverlayFileSystem::VisitDirectory(Path path) noexce
 
 Result<StreamPtr> OverlayFileSystem::OpenFile(Path path, FileAccessMode access, FileOpenFlags flags) noexcept
 {
+    optional<size_t> hit;
+    auto indexed = LookupMergedIndex(path, hit);
+
     auto ec = make_error_code(errc::no_such_file_or_directory);
-    for (auto it = m_stFileSystems.rbegin(); it != m_stFileSystems.rend(); ++it)
+    for (auto i = m_stFileSystems.size(); i-- > 0;)
     {
-        auto ret = (*it)->OpenFile(path, access, flags);
+        // 不可变的文件系统中，只有查找表命中的一层可能包含该路径
+        if (indexed && m_stImmutableLayers[i] && hit != i)
+            continue;
+
+        auto ret = m_stFileSystems[i]->OpenFile(path, access, flags);
         if (ret)
             return ret;
+        if (indexed && hit == i)
+            indexed = false;  // 命中的层失败时，回退到逐层查找
         if (ret.GetError() != make_error_code(errc::not_supported) &&
             ret.GetError() != make_error_code(errc::no_such_file_or_directory))
         {
@@ -302,6 +325,26 @@ Result<StreamPtr> OverlayFileSystem::OpenFile(Path path, FileAccessMode access,
     return ec;
 }
 
+Result<std::filesystem::path> OverlayFileSystem::GetNativePath(Path path) noexcept
+{
+    // 与 OpenFile 一致，由最上层包含该文件的文件系统决定，被遮盖的本地文件不能返回
+    optional<size_t> hit;
+    auto indexed = LookupMergedIndex(path, hit);
+
+    for (auto i = m_stFileSystems.size(); i-- > 0;)
+    {
+        if (indexed && m_stImmutableLayers[i] && hit != i)
+            continue;
+
+        auto ret = m_stFileSystems[i]->GetFileAttribute(path);
+        if (ret)
+            return m_stFileSystems[i]->GetNativePath(path);
+        if (indexed && hit == i)
+            indexed = false;
+    }
+    return make_error_code(errc::no_such_file_or_directory);
+}
+
 const std::string& OverlayFileSystem::GetUserData() const noexcept
 {
     return m_stUserData;
@@ -311,3 +354,50 @@ void OverlayFileSystem::SetUserData(std::string ud) noexcept
 {
     m_stUserData = std::move(ud);
 }
+
+void OverlayFileSystem::RebuildMergedIndex() noexcept
+{
+    m_bMergedIndexValid = false;
+    m_stMergedIndex.clear();
+
+    try
+    {
+        m_stImmutableLayers.assign(m_stFileSystems.size(), false);
+
+        // 自底向上加入，上层覆盖下层
+        vector<string_view> entries;
+        for (size_t i = 0; i < m_stFileSystems.size(); ++i)
+        {
+            entries.clear();
+            auto ret = m_stFileSystems[i]->EnumerateImmutableEntries(entries);
+            if (!ret)
+            {
+                if (ret.GetError() == make_error_code(errc::not_supported))
+                    continue;
+                return;
+            }
+
+            m_stImmutableLayers[i] = true;
+            for (auto e : entries)
+                m_stMergedIndex[e] = i;
+        }
+        m_bMergedIndexValid = true;
+    }
+    catch (...)  // bad_alloc
+    {
+        // 查找表只用于加速，失败时回退到逐层查找
+        m_stMergedIndex.clear();
+    }
+}
+
+bool OverlayFileSystem::LookupMergedIndex(const Path& path, std::optional<size_t>& hit) const noexcept
+{
+    hit.reset();
+    if (!m_bMergedIndexValid || !detail::IsIndexablePath(path))
+        return false;
+
+    auto it = m_stMergedIndex.find(path.ToStringView());
+    if (it != m_stMergedIndex.end())
+        hit = it->second;
+    return true;
+}
@@ -119,6 +119,38 @@ Result<StreamPtr> RootFileSystem::OpenFile(Path path, FileAccessMode access, Fil
     return fs->OpenFile(postfix, access, flags);
 }
 
+Result<std::filesystem::path> RootFileSystem::GetNativePath(Path path) noexcept
+{
+    auto [fs, postfix] = FindMountPoint(path);
+
+    if (!fs)
+        return make_error_code(errc::no_such_device);
+    return fs->GetNativePath(postfix);
+}
+
+Result<void> RootFileSystem::WatchFile(Path path) noexcept
+{
+    auto [fs, postfix] = FindMountPoint(path);
+
+    if (!fs)
+        return make_error_code(errc::no_such_device);
+    return fs->WatchFile(postfix);
+}
+
+Result<void> RootFileSystem::UnwatchFile(Path path) noexcept
+{
+    auto [fs, postfix] = FindMountPoint(path);
+
+    if (!fs)
+        return make_error_code(errc::no_such_device);
+    return fs->UnwatchFile(postfix);
+}
+
+Result<void> RootFileSystem::PollChangedFiles(std::vector<Path>& out) noexcept
+{
+    return PollChangedFiles(m_stRoot, Path {}, out);
+}
+
 std::tuple<FileSystemPtr, Path> RootFileSystem::FindMountPoint(const Path& path) const noexcept
 {
     auto* mp = &m_stRoot;
@@ -152,6 +184,35 @@ std::tuple<FileSystemPtr, Path> RootFileSystem::FindMountPoint(const Path& path)
     return make_tuple(longest->FileSystem, postfix);
 }
 
+Result<void> RootFileSystem::PollChangedFiles(const MountingPoint& mp, const Path& prefix, std::vector<Path>& out) noexcept
+{
+    try
+    {
+        // 将子文件系统返回的路径转换为根路径
+        if (mp.FileSystem)
+        {
+            auto start = out.size();
+            auto ret = mp.FileSystem->PollChangedFiles(out);
+            if (!ret)
+                return ret;
+            for (auto i = start; i < out.size(); ++i)
+                out[i] = prefix / out[i];
+        }
+
+        for (const auto& p : mp.SubNodes)
+        {
+            auto ret = PollChangedFiles(p.second, prefix / Path {p.first}, out);
+            if (!ret)
+                return ret;
+        }
+    }
+    catch (...)  // bad_alloc
+    {
+        return make_error_code(errc::not_enough_memory);
+    }
+    return {};
+}
+
 const std::string& RootFileSystem::GetUserData() const noexcept
 {
     return m_stUserData;
@@ -172,3 +172,20 @@ Result<StreamPtr> WindowedStream::Clone() const noexcept
         return make_error_code(errc::not_enough_memory);
     }
 }
+
+Result<Span<const uint8_t>> WindowedStream::GetMemoryView() const noexcept
+{
+    auto view = m_pUnderlay->GetMemoryView();
+    if (!view)
+        return view.GetError();
+
+    // 底层流的当前位置减去窗口内的偏移即为窗口起点
+    auto position = m_pUnderlay->GetPosition();
+    if (!position)
+        return position.GetError();
+    assert(*position >= m_ullPosition);
+    auto start = *position - m_ullPosition;
+    if (start > view->GetSize() || m_ullLength > view->GetSize() - start)
+        return make_error_code(errc::result_out_of_range);
+    return Span<const uint8_t> { view->GetData() + start, static_cast<size_t>(m_ullLength) };
+}
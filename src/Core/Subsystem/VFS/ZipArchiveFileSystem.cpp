@@ -9,6 +9,7 @@
 #include <queue>
 #include "detail/ZipFile.hpp"
 #include "detail/ZipFileReadError.hpp"
+#include "detail/PathIndex.hpp"
 
 using namespace std;
 using namespace lstg;
@@ -99,7 +100,10 @@ ZipArchiveFileSystem::ZipArchiveFileSystem(StreamPtr underlayStream, std::string
             auto it = dir->Files.find(filename);
             if (it != dir->Files.end())
                 throw system_error(detail::ZipFileReadError::DuplicatedFile);
-            dir->Files.emplace(filename, std::move(entry));
+            it = dir->Files.emplace(filename, std::move(entry)).first;
+
+            // 与 LocatePath 一致，同名时文件夹优先
+            AddPathIndex(MakePathIndexKey(p, p.GetSegmentCount()), &(it->second), false);
         }
     }
     catch (...)
@@ -217,6 +221,21 @@ Result<StreamPtr> ZipArchiveFileSystem::OpenFile(Path path, FileAccessMode acces
     }
 }
 
+Result<void> ZipArchiveFileSystem::EnumerateImmutableEntries(std::vector<std::string_view>& out) noexcept
+{
+    try
+    {
+        out.reserve(out.size() + m_stPathIndex.size());
+        for (const auto& it : m_stPathIndex)
+            out.push_back(it.first);
+        return {};
+    }
+    catch (...)  // bad_alloc
+    {
+        return make_error_code(errc::not_enough_memory);
+    }
+}
+
 const std::string& ZipArchiveFileSystem::GetUserData() const noexcept
 {
     return m_stUserData;
@@ -227,12 +246,31 @@ void ZipArchiveFileSystem::SetUserData(std::string ud) noexcept
     m_stUserData = std::move(ud);
 }
 
+const BlockCachePtr& ZipArchiveFileSystem::GetBlockCache() const noexcept
+{
+    return m_pZipFile->GetBlockCache();
+}
+
+void ZipArchiveFileSystem::SetBlockCache(BlockCachePtr cache) noexcept
+{
+    m_pZipFile->SetBlockCache(std::move(cache));
+}
+
 ConstZipEntry ZipArchiveFileSystem::LocatePath(const Path& path) const noexcept
 {
     // 空路径直接返回
     if (path.IsEmpty())
         return static_cast<ZipDirectoryEntry*>(nullptr);
 
+    // 规格化的路径直接查表
+    if (IsIndexablePath(path))
+    {
+        auto it = m_stPathIndex.find(path.ToStringView());
+        if (it == m_stPathIndex.end())
+            return static_cast<ZipDirectoryEntry*>(nullptr);
+        return it->second;
+    }
+
     // 访问所有的文件夹节点
     const ZipDirectoryEntry* entry = &m_stRoot;
     for (size_t i = 0; i + 1 < path.GetSegmentCount(); ++i)
@@ -306,9 +344,28 @@ ZipDirectoryEntry* ZipArchiveFileSystem::CreateTree(const Path& path)
             it = ret.first;
 
             it->second->Name = seg;
+            AddPathIndex(MakePathIndexKey(path, i + 1), it->second, true);
         }
 
         current = it->second;
     }
     return current;
 }
+
+void ZipArchiveFileSystem::AddPathIndex(std::string key, detail::ConstZipEntry entry, bool overwrite)
+{
+    // '.' 等路径规格化后为空，不参与索引
+    if (key.empty())
+        return;
+
+    auto it = m_stPathIndex.find(key);
+    if (it != m_stPathIndex.end())
+    {
+        if (overwrite)
+            it->second = entry;
+        return;
+    }
+
+    const auto& stored = m_stPathIndexKeys.emplace_back(std::move(key));
+    m_stPathIndex.emplace(stored, entry);
+}
@@ -0,0 +1,312 @@
+/**
+ * @file
+ * @date 2022/9/5
+ * @author 9chu
+ * 此文件为 LuaSTGPlus 项目的一部分，版权与许可声明详见 COPYRIGHT.txt。
+ */
+#include "IoUring.hpp"
+
+#include <cassert>
+#include <cstring>
+#include <vector>
+
+#if defined(LSTG_PLATFORM_LINUX) && __has_include(<linux/io_uring.h>)
+#define LSTG_IO_URING_ENABLED
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <linux/io_uring.h>
+#endif
+
+using namespace std;
+using namespace lstg;
+using namespace lstg::Subsystem::VFS::detail;
+
+#ifdef LSTG_IO_URING_ENABLED
+namespace
+{
+    int IoUringSetup(uint32_t entries, io_uring_params* params) noexcept
+    {
+        return static_cast<int>(::syscall(__NR_io_uring_setup, entries, params));
+    }
+
+    int IoUringEnter(int fd, uint32_t toSubmit, uint32_t minComplete, uint32_t flags) noexcept
+    {
+        return static_cast<int>(::syscall(__NR_io_uring_enter, fd, toSubmit, minComplete, flags, nullptr, 0));
+    }
+
+    int IoUringRegister(int fd, uint32_t opcode, void* arg, uint32_t count) noexcept
+    {
+        return static_cast<int>(::syscall(__NR_io_uring_register, fd, opcode, arg, count));
+    }
+
+    template <typename T>
+    T* RingPointer(void* ring, uint32_t offset) noexcept
+    {
+        return reinterpret_cast<T*>(static_cast<uint8_t*>(ring) + offset);
+    }
+}
+#endif
+
+bool IoUring::IsSupported() noexcept
+{
+#ifdef LSTG_IO_URING_ENABLED
+    return true;
+#else
+    return false;
+#endif
+}
+
+void IoUring::CloseDescriptor(int fd) noexcept
+{
+#ifdef LSTG_IO_URING_ENABLED
+    if (fd >= 0)
+        ::close(fd);
+#else
+    static_cast<void>(fd);
+#endif
+}
+
+IoUring::IoUring(uint32_t entries)
+{
+#ifdef LSTG_IO_URING_ENABLED
+    io_uring_params params {};
+    m_iHandle = IoUringSetup(entries, &params);
+    if (m_iHandle < 0)
+        throw system_error(error_code(errno, system_category()));
+
+    try
+    {
+        // 检查需要的操作是否被支持，旧内核没有 PROBE 时同样视为不支持
+        {
+            static const size_t kProbeOps = 256;
+            vector<uint8_t> storage(sizeof(io_uring_probe) + kProbeOps * sizeof(io_uring_probe_op));
+            auto probe = reinterpret_cast<io_uring_probe*>(storage.data());
+            if (IoUringRegister(m_iHandle, IORING_REGISTER_PROBE, probe, kProbeOps) < 0)
+                throw system_error(error_code(errno, system_category()));
+            for (auto op : { IORING_OP_OPENAT, IORING_OP_READ, IORING_OP_WRITE, IORING_OP_CLOSE })
+            {
+                if (op > probe->last_op || !(probe->ops[op].flags & IO_URING_OP_SUPPORTED))
+                    throw system_error(make_error_code(errc::not_supported));
+            }
+        }
+
+        // 映射队列
+        m_uSqRingSize = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+        m_uCqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        if (params.features & IORING_FEAT_SINGLE_MMAP)
+            m_uSqRingSize = m_uCqRingSize = std::max(m_uSqRingSize, m_uCqRingSize);
+
+        m_pSqRing = ::mmap(nullptr, m_uSqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_iHandle, IORING_OFF_SQ_RING);
+        if (m_pSqRing == MAP_FAILED)
+        {
+            m_pSqRing = nullptr;
+            throw system_error(error_code(errno, system_category()));
+        }
+        if (params.features & IORING_FEAT_SINGLE_MMAP)
+        {
+            m_pCqRing = m_pSqRing;
+        }
+        else
+        {
+            m_pCqRing = ::mmap(nullptr, m_uCqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_iHandle,
+                IORING_OFF_CQ_RING);
+            if (m_pCqRing == MAP_FAILED)
+            {
+                m_pCqRing = nullptr;
+                throw system_error(error_code(errno, system_category()));
+            }
+        }
+
+        m_uSqesSize = params.sq_entries * sizeof(io_uring_sqe);
+        m_pSqes = ::mmap(nullptr, m_uSqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_iHandle, IORING_OFF_SQES);
+        if (m_pSqes == MAP_FAILED)
+        {
+            m_pSqes = nullptr;
+            throw system_error(error_code(errno, system_category()));
+        }
+    }
+    catch (...)
+    {
+        Destroy();
+        throw;
+    }
+
+    m_pSqHead = RingPointer<uint32_t>(m_pSqRing, params.sq_off.head);
+    m_pSqTail = RingPointer<uint32_t>(m_pSqRing, params.sq_off.tail);
+    m_pSqArray = RingPointer<uint32_t>(m_pSqRing, params.sq_off.array);
+    m_uSqMask = *RingPointer<uint32_t>(m_pSqRing, params.sq_off.ring_mask);
+    m_uSqEntries = *RingPointer<uint32_t>(m_pSqRing, params.sq_off.ring_entries);
+    m_uSqLocalTail = *m_pSqTail;
+
+    m_pCqHead = RingPointer<uint32_t>(m_pCqRing, params.cq_off.head);
+    m_pCqTail = RingPointer<uint32_t>(m_pCqRing, params.cq_off.tail);
+    m_pCqes = RingPointer<void>(m_pCqRing, params.cq_off.cqes);
+    m_uCqMask = *RingPointer<uint32_t>(m_pCqRing, params.cq_off.ring_mask);
+#else
+    static_cast<void>(entries);
+    throw system_error(make_error_code(errc::not_supported));
+#endif
+}
+
+IoUring::~IoUring()
+{
+    Destroy();
+}
+
+void IoUring::Destroy() noexcept
+{
+#ifdef LSTG_IO_URING_ENABLED
+    if (m_pSqes)
+        ::munmap(m_pSqes, m_uSqesSize);
+    if (m_pCqRing && m_pCqRing != m_pSqRing)
+        ::munmap(m_pCqRing, m_uCqRingSize);
+    if (m_pSqRing)
+        ::munmap(m_pSqRing, m_uSqRingSize);
+    if (m_iHandle >= 0)
+        ::close(m_iHandle);
+    m_pSqes = m_pCqRing = m_pSqRing = nullptr;
+    m_iHandle = -1;
+#endif
+}
+
+bool IoUring::IsFull() const noexcept
+{
+#ifdef LSTG_IO_URING_ENABLED
+    auto head = __atomic_load_n(m_pSqHead, __ATOMIC_ACQUIRE);
+    return m_uSqLocalTail - head >= m_uSqEntries;
+#else
+    return true;
+#endif
+}
+
+bool IoUring::PrepareOpen(uint64_t userData, const char* path, bool write) noexcept
+{
+#ifdef LSTG_IO_URING_ENABLED
+    auto sqe = static_cast<io_uring_sqe*>(AcquireSubmission(IORING_OP_OPENAT, userData));
+    if (!sqe)
+        return false;
+    sqe->fd = AT_FDCWD;
+    sqe->addr = reinterpret_cast<uintptr_t>(path);
+    sqe->len = write ? 0644 : 0;
+    sqe->open_flags = static_cast<uint32_t>(write ? (O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC) : (O_RDONLY | O_CLOEXEC));
+    return true;
+#else
+    return false;
+#endif
+}
+
+bool IoUring::PrepareRead(uint64_t userData, int fd, uint8_t* buffer, uint32_t length, uint64_t offset) noexcept
+{
+#ifdef LSTG_IO_URING_ENABLED
+    auto sqe = static_cast<io_uring_sqe*>(AcquireSubmission(IORING_OP_READ, userData));
+    if (!sqe)
+        return false;
+    sqe->fd = fd;
+    sqe->addr = reinterpret_cast<uintptr_t>(buffer);
+    sqe->len = length;
+    sqe->off = offset;
+    return true;
+#else
+    return false;
+#endif
+}
+
+bool IoUring::PrepareWrite(uint64_t userData, int fd, const uint8_t* buffer, uint32_t length, uint64_t offset) noexcept
+{
+#ifdef LSTG_IO_URING_ENABLED
+    auto sqe = static_cast<io_uring_sqe*>(AcquireSubmission(IORING_OP_WRITE, userData));
+    if (!sqe)
+        return false;
+    sqe->fd = fd;
+    sqe->addr = reinterpret_cast<uintptr_t>(buffer);
+    sqe->len = length;
+    sqe->off = offset;
+    return true;
+#else
+    return false;
+#endif
+}
+
+bool IoUring::PrepareClose(uint64_t userData, int fd) noexcept
+{
+#ifdef LSTG_IO_URING_ENABLED
+    auto sqe = static_cast<io_uring_sqe*>(AcquireSubmission(IORING_OP_CLOSE, userData));
+    if (!sqe)
+        return false;
+    sqe->fd = fd;
+    return true;
+#else
+    return false;
+#endif
+}
+
+Result<void> IoUring::Submit(uint32_t waitCount) noexcept
+{
+#ifdef LSTG_IO_URING_ENABLED
+    if (m_uPendingSubmit == 0 && waitCount == 0)
+        return {};
+
+    __atomic_store_n(m_pSqTail, m_uSqLocalTail, __ATOMIC_RELEASE);
+    while (true)
+    {
+        auto ret = IoUringEnter(m_iHandle, m_uPendingSubmit, waitCount, waitCount > 0 ? IORING_ENTER_GETEVENTS : 0);
+        if (ret < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            return error_code(errno, system_category());
+        }
+        assert(static_cast<uint32_t>(ret) <= m_uPendingSubmit);
+        m_uPendingSubmit -= static_cast<uint32_t>(ret);
+        return {};
+    }
+#else
+    static_cast<void>(waitCount);
+    return make_error_code(errc::not_supported);
+#endif
+}
+
+void* IoUring::AcquireSubmission(uint8_t opcode, uint64_t userData) noexcept
+{
+#ifdef LSTG_IO_URING_ENABLED
+    if (IsFull())
+        return nullptr;
+
+    auto index = m_uSqLocalTail & m_uSqMask;
+    auto sqe = static_cast<io_uring_sqe*>(m_pSqes) + index;
+    ::memset(sqe, 0, sizeof(io_uring_sqe));
+    sqe->opcode = opcode;
+    sqe->user_data = userData;
+    m_pSqArray[index] = index;
+    ++m_uSqLocalTail;
+    ++m_uPendingSubmit;
+    return sqe;
+#else
+    static_cast<void>(opcode);
+    static_cast<void>(userData);
+    return nullptr;
+#endif
+}
+
+bool IoUring::PeekCompletion(uint64_t& userData, int32_t& result) noexcept
+{
+#ifdef LSTG_IO_URING_ENABLED
+    auto head = *m_pCqHead;
+    auto tail = __atomic_load_n(m_pCqTail, __ATOMIC_ACQUIRE);
+    if (head == tail)
+        return false;
+
+    auto cqe = static_cast<const io_uring_cqe*>(m_pCqes) + (head & m_uCqMask);
+    userData = cqe->user_data;
+    result = cqe->res;
+    __atomic_store_n(m_pCqHead, head + 1, __ATOMIC_RELEASE);
+    return true;
+#else
+    static_cast<void>(userData);
+    static_cast<void>(result);
+    return false;
+#endif
+}
@@ -0,0 +1,148 @@
+/**
+ * @file
+ * @date 2022/9/5
+ * @author 9chu
+ * 此文件为 LuaSTGPlus 项目的一部分，版权与许可声明详见 COPYRIGHT.txt。
+ */
+#pragma once
+#include <cstdint>
+#include <lstg/Core/Result.hpp>
+
+namespace lstg::Subsystem::VFS::detail
+{
+    /**
+     * io_uring 提交队列
+     * 直接通过系统调用使用 io_uring，不依赖 liburing。仅在 Linux 下可用，且内核需要支持 OPENAT/READ/WRITE/CLOSE 操作（5.6+）。
+     * 对象只能在单一线程上使用。
+     */
+    class IoUring
+    {
+    public:
+        /**
+         * 当前平台是否支持
+         * 运行时仍可能因为内核版本或安全策略而创建失败。
+         */
+        static bool IsSupported() noexcept;
+
+        /**
+         * 同步关闭文件描述符
+         * 用于在无法继续提交请求时（例如析构）回收已经打开的文件。
+         * @param fd 文件描述符
+         */
+        static void CloseDescriptor(int fd) noexcept;
+
+    public:
+        /**
+         * 创建 io_uring 实例
+         * 失败时抛出 system_error。
+         * @param entries 提交队列大小
+         */
+        IoUring(uint32_t entries);
+        IoUring(const IoUring&) = delete;
+        IoUring(IoUring&&) = delete;
+        ~IoUring();
+
+    public:
+        /**
+         * 提交队列是否已满
+         */
+        [[nodiscard]] bool IsFull() const noexcept;
+
+        /**
+         * 准备打开文件
+         * 完成时的结果为文件描述符。
+         * @param userData 用户数据，在完成时返回
+         * @param path 路径，需要保证在完成前有效
+         * @param write 为 false 时只读打开，否则以截断方式打开用于写入，文件不存在时创建
+         * @return 队列已满时返回 false
+         */
+        bool PrepareOpen(uint64_t userData, const char* path, bool write) noexcept;
+
+        /**
+         * 准备读取
+         * @param userData 用户数据
+         * @param fd 文件描述符
+         * @param buffer 缓冲区，需要保证在完成前有效
+         * @param length 长度
+         * @param offset 文件偏移
+         * @return 队列已满时返回 false
+         */
+        bool PrepareRead(uint64_t userData, int fd, uint8_t* buffer, uint32_t length, uint64_t offset) noexcept;
+
+        /**
+         * 准备写入
+         * @param userData 用户数据
+         * @param fd 文件描述符
+         * @param buffer 缓冲区，需要保证在完成前有效
+         * @param length 长度
+         * @param offset 文件偏移
+         * @return 队列已满时返回 false
+         */
+        bool PrepareWrite(uint64_t userData, int fd, const uint8_t* buffer, uint32_t length, uint64_t offset) noexcept;
+
+        /**
+         * 准备关闭文件
+         * @param userData 用户数据
+         * @param fd 文件描述符
+         * @return 队列已满时返回 false
+         */
+        bool PrepareClose(uint64_t userData, int fd) noexcept;
+
+        /**
+         * 提交所有准备好的请求
+         * @param waitCount 等待至少 waitCount 个请求完成
+         * @return 错误码
+         */
+        Result<void> Submit(uint32_t waitCount = 0) noexcept;
+
+        /**
+         * 取出已完成的请求
+         * @tparam TCallback 回调类型，签名为 void(uint64_t userData, int32_t result)，result 为负数时表示 -errno
+         * @param callback 回调
+         * @return 取出的数量
+         */
+        template <typename TCallback>
+        size_t Poll(TCallback&& callback) noexcept
+        {
+            size_t count = 0;
+            uint64_t userData = 0;
+            int32_t result = 0;
+            while (PeekCompletion(userData, result))
+            {
+                callback(userData, result);
+                ++count;
+            }
+            return count;
+        }
+
+    private:
+        void Destroy() noexcept;
+        void* AcquireSubmission(uint8_t opcode, uint64_t userData) noexcept;
+        bool PeekCompletion(uint64_t& userData, int32_t& result) noexcept;
+
+    private:
+        int m_iHandle = -1;
+        uint32_t m_uPendingSubmit = 0;
+
+        void* m_pSqRing = nullptr;
+        size_t m_uSqRingSize = 0;
+        void* m_pCqRing = nullptr;
+        size_t m_uCqRingSize = 0;
+        void* m_pSqes = nullptr;
+        size_t m_uSqesSize = 0;
+
+        // 提交队列
+        uint32_t* m_pSqHead = nullptr;
+        uint32_t* m_pSqTail = nullptr;
+        uint32_t* m_pSqArray = nullptr;
+        uint32_t m_uSqMask = 0;
+        uint32_t m_uSqEntries = 0;
+        uint32_t m_uSqLocalTail = 0;
+
+        // 完成队列
+        uint32_t* m_pCqHead = nullptr;
+        uint32_t* m_pCqTail = nullptr;
+        void* m_pCqes = nullptr;
+        uint32_t m_uCqMask = 0;
+    };
+}
@@ -0,0 +1,241 @@
+/**
+ * @file
+ * @date 2022/8/23
+ * @author 9chu
+ * 此文件为 LuaSTGPlus 项目的一部分，版权与许可声明详见 COPYRIGHT.txt。
+ */
+#include "LocalFileWatcher.hpp"
+
+#include <cassert>
+#include <lstg/Core/Logging.hpp>
+
+#if defined(LSTG_PLATFORM_LINUX) || defined(LSTG_PLATFORM_ANDROID)
+#define LSTG_INOTIFY_ENABLED
+#include <cerrno>
+#include <unistd.h>
+#include <sys/inotify.h>
+#endif
+
+using namespace std;
+using namespace lstg;
+using namespace lstg::Subsystem::VFS::detail;
+
+LSTG_DEF_LOG_CATEGORY(LocalFileWatcher);
+
+#ifdef LSTG_INOTIFY_ENABLED
+static const uint32_t kWatchEventMask = IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE | IN_DELETE | IN_ATTRIB;
+#endif
+
+bool LocalFileWatcher::IsSupported() noexcept
+{
+#ifdef LSTG_INOTIFY_ENABLED
+    return true;
+#else
+    return false;
+#endif
+}
+
+LocalFileWatcher::LocalFileWatcher(std::filesystem::path root) noexcept
+    : m_stRoot(std::move(root))
+{
+}
+
+LocalFileWatcher::~LocalFileWatcher()
+{
+#ifdef LSTG_INOTIFY_ENABLED
+    if (m_iHandle >= 0)
+        ::close(m_iHandle);
+#endif
+}
+
+Result<void> LocalFileWatcher::Watch(const Path& path) noexcept
+{
+#ifdef LSTG_INOTIFY_ENABLED
+    try
+    {
+        auto file = path.ToString();
+        if (m_stWatchedFiles.find(file) != m_stWatchedFiles.end())
+            return {};
+
+        // 延迟创建 inotify 实例
+        if (m_iHandle < 0)
+        {
+            m_iHandle = ::inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+            if (m_iHandle < 0)
+                return error_code(errno, system_category());
+        }
+
+        // 监视所在目录
+        auto slash = file.rfind(Path::kSeperator);
+        auto directory = (slash == string::npos) ? string {} : file.substr(0, slash);
+        auto it = m_stWatchedDirectories.find(directory);
+        if (it == m_stWatchedDirectories.end())
+        {
+            auto localPath = directory.empty() ? m_stRoot : (m_stRoot / filesystem::u8path(directory));
+            auto wd = ::inotify_add_watch(m_iHandle, localPath.c_str(), kWatchEventMask);
+            if (wd < 0)
+                return error_code(errno, system_category());
+
+            try
+            {
+                m_stWatchDescriptors[wd] = directory;
+                it = m_stWatchedDirectories.emplace(std::move(directory), WatchedDirectory { wd, 0 }).first;
+            }
+            catch (...)  // bad_alloc
+            {
+                m_stWatchDescriptors.erase(wd);
+                ::inotify_rm_watch(m_iHandle, wd);
+                throw;
+            }
+        }
+
+        m_stWatchedFiles.emplace(std::move(file));
+        ++it->second.FileCount;
+        return {};
+    }
+    catch (...)  // bad_alloc
+    {
+        return make_error_code(errc::not_enough_memory);
+    }
+#else
+    static_cast<void>(path);
+    return make_error_code(errc::not_supported);
+#endif
+}
+
+Result<void> LocalFileWatcher::Unwatch(const Path& path) noexcept
+{
+#ifdef LSTG_INOTIFY_ENABLED
+    try
+    {
+        auto file = path.ToString();
+        auto it = m_stWatchedFiles.find(file);
+        if (it == m_stWatchedFiles.end())
+            return {};
+        m_stWatchedFiles.erase(it);
+
+        auto slash = file.rfind(Path::kSeperator);
+        auto directory = (slash == string::npos) ? string {} : file.substr(0, slash);
+        auto jt = m_stWatchedDirectories.find(directory);
+        if (jt == m_stWatchedDirectories.end())
+            return {};  // 目录的监视已经失效
+
+        assert(jt->second.FileCount > 0);
+        if (--jt->second.FileCount == 0)
+        {
+            // 随后产生的 IN_IGNORED 事件找不到描述符，会被直接跳过
+            auto wd = jt->second.Descriptor;
+            m_stWatchDescriptors.erase(wd);
+            m_stWatchedDirectories.erase(jt);
+            if (::inotify_rm_watch(m_iHandle, wd) < 0)
+                return error_code(errno, system_category());
+        }
+        return {};
+    }
+    catch (...)  // bad_alloc
+    {
+        return make_error_code(errc::not_enough_memory);
+    }
+#else
+    static_cast<void>(path);
+    return {};
+#endif
+}
+
+Result<void> LocalFileWatcher::Poll(std::vector<Path>& out) noexcept
+{
+#ifdef LSTG_INOTIFY_ENABLED
+    if (m_iHandle < 0)
+        return {};
+
+    try
+    {
+        unordered_set<string> changed;
+        bool overflow = false;
+
+        alignas(struct inotify_event) char buffer[4096];
+        while (true)
+        {
+            auto sz = ::read(m_iHandle, buffer, sizeof(buffer));
+            if (sz < 0)
+            {
+                if (errno == EAGAIN || errno == EWOULDBLOCK)
+                    break;
+                if (errno == EINTR)
+                    continue;
+                return error_code(errno, system_category());
+            }
+            if (sz == 0)
+                break;
+
+            for (ssize_t offset = 0; offset < sz; )
+            {
+                const auto* ev = reinterpret_cast<const struct inotify_event*>(buffer + offset);
+                offset += static_cast<ssize_t>(sizeof(struct inotify_event) + ev->len);
+
+                // 事件队列溢出，保守地认为所有文件都发生了变化
+                if ((ev->mask & IN_Q_OVERFLOW) != 0)
+                {
+                    LSTG_LOG_WARN_CAT(LocalFileWatcher, "inotify event queue overflow");
+                    overflow = true;
+                    continue;
+                }
+
+                auto it = m_stWatchDescriptors.find(ev->wd);
+                if (it == m_stWatchDescriptors.end())
+                    continue;
+
+                // 目录被删除，监视自动失效
+                // 此时将目录下的文件都视作发生变化，并移出监视列表，以便调用方重新监视
+                if ((ev->mask & IN_IGNORED) != 0)
+                {
+                    const auto& directory = it->second;
+                    auto jt = m_stWatchedFiles.begin();
+                    while (jt != m_stWatchedFiles.end())
+                    {
+                        auto slash = jt->rfind(Path::kSeperator);
+                        if ((slash == string::npos && directory.empty()) ||
+                            (slash != string::npos && string_view{*jt}.substr(0, slash) == directory))
+                        {
+                            changed.emplace(*jt);
+                            jt = m_stWatchedFiles.erase(jt);
+                        }
+                        else
+                        {
+                            ++jt;
+                        }
+                    }
+                    m_stWatchedDirectories.erase(directory);
+                    m_stWatchDescriptors.erase(it);
+                    continue;
+                }
+
+                if (ev->len == 0)
+                    continue;
+                string file = it->second.empty() ? string { ev->name } : (it->second + Path::kSeperator + ev->name);
+                if (m_stWatchedFiles.find(file) != m_stWatchedFiles.end())
+                    changed.emplace(std::move(file));
+            }
+        }
+
+        if (overflow)
+        {
+            for (const auto& file : m_stWatchedFiles)
+                out.emplace_back(file);
+        }
+        else
+        {
+            for (const auto& file : changed)
+                out.emplace_back(file);
+        }
+        return {};
+    }
+    catch (...)  // bad_alloc
+    {
+        return make_error_code(errc::not_enough_memory);
+    }
+#else
+    static_cast<void>(out);
+    return {};
+#endif
+}
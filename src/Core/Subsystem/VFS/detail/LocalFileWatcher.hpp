@@ -0,0 +1,72 @@
+/**
+ * @file
+ * @date 2022/8/23
+ * @author 9chu
+ * 此文件为 LuaSTGPlus 项目的一部分，版权与许可声明详见 COPYRIGHT.txt。
+ */
+#pragma once
+#include <filesystem>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <lstg/Core/Subsystem/VFS/Path.hpp>
+#include <lstg/Core/Result.hpp>
+
+namespace lstg::Subsystem::VFS::detail
+{
+    /**
+     * 本地文件变化监视器
+     * Linux 下使用 inotify 实现，其他平台不支持。
+     * 由于编辑器常常以“写临时文件再重命名”的方式保存，这里监视的是文件所在目录，再按文件名过滤。
+     */
+    class LocalFileWatcher
+    {
+    public:
+        /**
+         * 当前平台是否支持
+         */
+        static bool IsSupported() noexcept;
+
+    public:
+        LocalFileWatcher(std::filesystem::path root) noexcept;
+        LocalFileWatcher(const LocalFileWatcher&) = delete;
+        LocalFileWatcher(LocalFileWatcher&&) noexcept = delete;
+        ~LocalFileWatcher();
+
+    public:
+        /**
+         * 监视文件
+         * @param path 相对于根目录的路径
+         * @return 错误码
+         */
+        Result<void> Watch(const Path& path) noexcept;
+
+        /**
+         * 取消监视文件
+         * 目录下不再有被监视的文件时移除目录的监视。
+         * @param path 相对于根目录的路径
+         * @return 错误码
+         */
+        Result<void> Unwatch(const Path& path) noexcept;
+
+        /**
+         * 取出发生变化的文件
+         * @param out 输出
+         * @return 错误码
+         */
+        Result<void> Poll(std::vector<Path>& out) noexcept;
+
+    private:
+        struct WatchedDirectory
+        {
+            int Descriptor = -1;
+            size_t FileCount = 0;  // 目录下被监视的文件数
+        };
+
+        std::filesystem::path m_stRoot;
+        int m_iHandle = -1;
+        std::unordered_map<int, std::string> m_stWatchDescriptors;  // wd -> 相对目录
+        std::unordered_map<std::string, WatchedDirectory> m_stWatchedDirectories;  // 相对目录 -> wd
+        std::unordered_set<std::string> m_stWatchedFiles;
+    };
+}
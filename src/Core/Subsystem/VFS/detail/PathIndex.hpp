@@ -0,0 +1,52 @@
+/**
+ * @file
+ * @date 2022/9/1
+ * @author 9chu
+ * 此文件为 LuaSTGPlus 项目的一部分，版权与许可声明详见 COPYRIGHT.txt。
+ */
+#pragma once
+#include <string>
+#include <lstg/Core/Subsystem/VFS/Path.hpp>
+
+namespace lstg::Subsystem::VFS::detail
+{
+    /**
+     * 检查路径能否直接作为路径索引的键
+     * 路径索引以规格化的相对路径（不以 '/' 开头，不含 '.' 和 '..'）作为键，其他形式的路径需要回退到逐级查找。
+     * @param path 路径
+     * @return 是否可以直接查表
+     */
+    inline bool IsIndexablePath(const Path& path) noexcept
+    {
+        if (path.IsEmpty() || path.IsAbsolute())
+            return false;
+        for (size_t i = 0; i < path.GetSegmentCount(); ++i)
+        {
+            auto seg = path[i];
+            if (seg == "." || seg == "..")
+                return false;
+        }
+        return true;
+    }
+
+    /**
+     * 构造路径索引的键
+     * @param path 路径
+     * @param count 使用前 count 个路径元素，跳过 '.'
+     * @return 键
+     */
+    inline std::string MakePathIndexKey(const Path& path, size_t count)
+    {
+        std::string ret;
+        for (size_t i = 0; i < count && i < path.GetSegmentCount(); ++i)
+        {
+            auto seg = path[i];
+            if (seg == ".")
+                continue;
+            if (!ret.empty())
+                ret.push_back('/');
+            ret.append(seg);
+        }
+        return ret;
+    }
+}
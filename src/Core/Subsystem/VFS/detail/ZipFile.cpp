@@ -9,6 +9,7 @@
 #include <lstg/Core/Subsystem/VFS/BufferViewStream.hpp>
 #include <lstg/Core/Subsystem/VFS/WindowedStream.hpp>
 #include <lstg/Core/Subsystem/VFS/InflateStream.hpp>
+#include <lstg/Core/Subsystem/VFS/BlockCacheStream.hpp>
 #include "ZipPkDecryptStream.hpp"
 
 #include <limits>
@@ -23,12 +24,17 @@ using namespace std;
 using namespace lstg;
 using namespace lstg::Subsystem::VFS::detail;
 
+using lstg::Subsystem::VFS::BlockCache;
+using lstg::Subsystem::VFS::BlockCachePtr;
+using lstg::Subsystem::VFS::BlockCacheStream;
 using lstg::Subsystem::VFS::IStream;
 using lstg::Subsystem::VFS::StreamPtr;
 using lstg::Subsystem::VFS::StreamSeekOrigins;
 
 namespace
 {
+    static const uint64_t kMaxCachedEntryRatio = 4;  // 条目超过缓存容量的 1/4 时不缓存
+
     Result<bool> ReverseSearchPattern(IStream* stream, const uint8_t* pattern, size_t len, size_t maxSearch) noexcept
     {
         static const unsigned kSearchBufferSize = 64;
@@ -149,12 +155,25 @@ namespace
 }
 
 ZipFile::ZipFile(StreamPtr stream)
-    : m_pUnderlayStream(std::move(stream))
+    : m_pUnderlayStream(std::move(stream)), m_ullArchiveId(BlockCache::AllocArchiveId())
 {
     auto ret = LocateCentralDirectory();
     ret.ThrowIfError();
 }
 
+ZipFile::~ZipFile()
+{
+    if (m_pBlockCache)
+        m_pBlockCache->Purge(m_ullArchiveId);
+}
+
+void ZipFile::SetBlockCache(BlockCachePtr cache) noexcept
+{
+    if (m_pBlockCache && m_pBlockCache != cache)
+        m_pBlockCache->Purge(m_ullArchiveId);
+    m_pBlockCache = std::move(cache);
+}
+
 Result<void> ZipFile::ReadFileEntries(ZipFileEntryContainer& out) noexcept
 {
     out.clear();
@@ -286,9 +305,27 @@ Result<StreamPtr> ZipFile::OpenEntry(const ZipFileEntry& entry, std::string_view
     if (!ret)
         return ret.GetError();
 
+    // 底层流位于内存中（例如内存映射的文件）时，直接暴露数据所在的内存，未压缩的条目可以零拷贝读取
+    Span<const uint8_t> memoryView;
+    if (auto view = stream->GetMemoryView())
+    {
+        auto position = stream->GetPosition();
+        if (!position)
+            return position.GetError();
+        if (*position > view->GetSize() || entry.CompressedSize > view->GetSize() - *position)
+            return make_error_code(errc::io_error);
+        memoryView = { view->GetData() + *position, static_cast<size_t>(entry.CompressedSize) };
+    }
+
     try
     {
         // 封装范围
+        if (memoryView.GetData())
+        {
+            auto viewStream = make_shared<BufferViewStream<const uint8_t>>(memoryView, std::move(stream));
+            stream = static_pointer_cast<IStream>(std::move(viewStream));
+        }
+        else
         {
             auto windowedStream = make_shared<WindowedStream>(std::move(stream), entry.CompressedSize);
             stream = static_pointer_cast<IStream>(std::move(windowedStream));
@@ -316,6 +353,15 @@ Result<StreamPtr> ZipFile::OpenEntry(const ZipFileEntry& entry, std::string_view
         {
             auto decompressStream = make_shared<InflateStream>(std::move(stream), entry.UncompressedSize);
             stream = static_pointer_cast<IStream>(std::move(decompressStream));
+
+            // 解压的数据按块缓存，重复打开同一文件时直接从内存读取
+            // 过大的条目（例如 BGM）会把缓存整体冲刷掉，不进行缓存
+            if (m_pBlockCache && entry.UncompressedSize <= m_pBlockCache->GetCapacity() / kMaxCachedEntryRatio)
+            {
+                auto cacheStream = make_shared<BlockCacheStream>(std::move(stream), m_pBlockCache, m_ullArchiveId,
+                    entry.LocalFileHeaderOffset, entry.UncompressedSize);
+                stream = static_pointer_cast<IStream>(std::move(cacheStream));
+            }
         }
 
         return stream;
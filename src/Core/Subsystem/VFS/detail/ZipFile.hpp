@@ -10,6 +10,7 @@
 #include <vector>
 #include <optional>
 #include <lstg/Core/Flag.hpp>
+#include <lstg/Core/Subsystem/VFS/BlockCache.hpp>
 #include "ZipStructs.hpp"
 
 namespace lstg::Subsystem::VFS::detail
@@ -73,8 +74,21 @@ namespace lstg::Subsystem::VFS::detail
 
         ZipFile(const ZipFile&) = delete;
         ZipFile(ZipFile&&) noexcept = default;
+        ~ZipFile();
 
     public:
+        /**
+         * 获取块缓存
+         */
+        [[nodiscard]] const BlockCachePtr& GetBlockCache() const noexcept { return m_pBlockCache; }
+
+        /**
+         * 设置块缓存
+         * 设置后压缩的条目解压得到的数据将按块缓存，替换时会清除旧缓存中本档案的数据。
+         * @param cache 块缓存，为 nullptr 时不缓存
+         */
+        void SetBlockCache(BlockCachePtr cache) noexcept;
+
         /**
          * 读取所有条目
          * @param out 输出
@@ -95,6 +109,8 @@ namespace lstg::Subsystem::VFS::detail
 
     private:
         StreamPtr m_pUnderlayStream;
+        uint64_t m_ullArchiveId = 0;
+        BlockCachePtr m_pBlockCache;
 
         bool m_bIsZip64 = false;
         uint64_t m_uEntryCount = 0;
@@ -6,6 +6,8 @@
  */
 #include <lstg/Core/Subsystem/VirtualFileSystem.hpp>
 
+#include <lstg/Core/Subsystem/ProfileSystem.hpp>
+
 using namespace std;
 using namespace lstg;
 using namespace lstg::Subsystem;
@@ -26,6 +28,7 @@ namespace
 }
 
 VirtualFileSystem::VirtualFileSystem(SubsystemContainer& container)
+    : m_pBlockCache(make_shared<VFS::BlockCache>()), m_stAsyncIOService(m_stRootFileSystem)
 {
     static_cast<void>(container);
 }
@@ -90,6 +93,18 @@ Result<size_t> VirtualFileSystem::ReadFile(std::vector<uint8_t>& out, std::strin
     if (!stream)
         return stream.GetError();
 
+    // 内存映射的文件整块复制
+    if ((*stream)->GetMemoryView())
+    {
+        auto ret = VFS::ReadAll(out, stream->get());
+        if (!ret)
+        {
+            out.clear();
+            return ret.GetError();
+        }
+        return out.size();
+    }
+
     // 发起读操作
     static const unsigned kExpandSize = 16 * 1024;  // 16k
 
@@ -124,6 +139,44 @@ Result<size_t> VirtualFileSystem::ReadFile(std::vector<uint8_t>& out, std::strin
     return readSize;
 }
 
+Result<void> VirtualFileSystem::ReadFileAsync(std::string_view path, uint64_t offset, size_t length,
+    VFS::AsyncReadCallback callback) noexcept
+{
+    auto npath = NormalizePath(path);
+    if (!npath)
+        return npath.GetError();
+    return m_stAsyncIOService.Read(std::move(*npath), offset, length, std::move(callback));
+}
+
+Result<void> VirtualFileSystem::WriteFileAsync(std::string_view path, std::vector<uint8_t> data, VFS::AsyncWriteCallback callback) noexcept
+{
+    auto npath = NormalizePath(path);
+    if (!npath)
+        return npath.GetError();
+    return m_stAsyncIOService.Write(std::move(*npath), std::move(data), std::move(callback));
+}
+
+Result<void> VirtualFileSystem::WatchFile(std::string_view path) noexcept
+{
+    auto npath = NormalizePath(path);
+    if (!npath)
+        return npath.GetError();
+    return m_stRootFileSystem.WatchFile(*npath);
+}
+
+Result<void> VirtualFileSystem::UnwatchFile(std::string_view path) noexcept
+{
+    auto npath = NormalizePath(path);
+    if (!npath)
+        return npath.GetError();
+    return m_stRootFileSystem.UnwatchFile(*npath);
+}
+
+Result<void> VirtualFileSystem::PollChangedFiles(std::vector<VFS::Path>& out) noexcept
+{
+    return m_stRootFileSystem.PollChangedFiles(out);
+}
+
 Result<void> VirtualFileSystem::Mount(std::string_view path, VFS::FileSystemPtr fs) noexcept
 {
     auto npath = NormalizePath(path);
@@ -147,3 +200,19 @@ Result<bool> VirtualFileSystem::Unmount(std::string_view path) noexcept
         return npath.GetError();
     return m_stRootFileSystem.Unmount(*npath);
 }
+
+void VirtualFileSystem::OnUpdate(double elapsedTime) noexcept
+{
+    static_cast<void>(elapsedTime);
+
+    m_stAsyncIOService.Update();
+
+#ifdef LSTG_DEVELOPMENT
+    auto statistics = m_pBlockCache->GetStatistics();
+    auto lookups = statistics.Hits + statistics.Misses;
+    auto hitRate = lookups == 0 ? 0. : static_cast<double>(statistics.Hits) * 100. / static_cast<double>(lookups);
+    ProfileSystem::GetInstance().SetPerformanceCounter(PerformanceCounterTypes::PerFrame, "VirtualFileSystem_BlockCacheHitRate", hitRate);
+    ProfileSystem::GetInstance().SetPerformanceCounter(PerformanceCounterTypes::PerFrame, "VirtualFileSystem_BlockCacheUsage",
+        static_cast<double>(statistics.UsedBytes / 1024));
+#endif
+}
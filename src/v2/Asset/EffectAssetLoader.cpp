@@ -123,4 +123,9 @@ void EffectAssetLoader::PrepareToReload() noexcept
     // 开始重新加载
     SetState(AssetLoadingStates::Pending);
 }
+
+std::string_view EffectAssetLoader::GetWatchedPath() const noexcept
+{
+    return static_pointer_cast<EffectAsset>(GetAsset())->GetPath();
+}
 #endif
@@ -37,13 +37,25 @@ Result<Subsystem::Asset::CreateAssetResult> HgeFontAssetFactory::CreateAsset(Sub
     Subsystem::Asset::IAssetDependencyResolver* resolver) noexcept
 {
     auto path = JsonHelper::ReadValue<string>(arguments, "/path");
-    auto mipmaps = JsonHelper::ReadValue<bool>(arguments, "/mipmaps", true);
     if (!path)
         return make_error_code(Subsystem::Asset::AssetError::MissingRequiredArgument);
 
+    HgeFontAssetArguments args;
+    args.Path = *path;
+    args.Mipmaps = JsonHelper::ReadValue<bool>(arguments, "/mipmaps", true);
+    return CreateAsset(assetSystem, std::move(pool), name, args, resolver);
+}
+
+Result<Subsystem::Asset::CreateAssetResult> HgeFontAssetFactory::CreateAsset(Subsystem::AssetSystem& assetSystem,
+    Subsystem::Asset::AssetPoolPtr pool, std::string_view name, const HgeFontAssetArguments& arguments,
+    Subsystem::Asset::IAssetDependencyResolver* resolver) noexcept
+{
+    if (arguments.Path.empty())
+        return make_error_code(Subsystem::Asset::AssetError::MissingRequiredArgument);
+
     try
     {
-        auto asset = make_shared<HgeFontAsset>(std::string{name}, std::move(*path), mipmaps);
+        auto asset = make_shared<HgeFontAsset>(std::string{name}, std::string{arguments.Path}, arguments.Mipmaps);
         auto loader = make_shared<HgeFontAssetLoader>(asset, m_pHGEFontFactory);
         return Subsystem::Asset::CreateAssetResult { static_pointer_cast<Subsystem::Asset::Asset>(asset),
             static_pointer_cast<Subsystem::Asset::AssetLoader>(loader) };
@@ -9,6 +9,7 @@
 #include <lstg/Core/Logging.hpp>
 #include <lstg/Core/Subsystem/VFS/Path.hpp>
 #include <lstg/Core/Subsystem/AssetSystem.hpp>
+#include <lstg/Core/Subsystem/Asset/BasicTexture2DAssetFactory.hpp>
 #include <lstg/Core/Subsystem/Asset/AssetError.hpp>
 #include <lstg/v2/Asset/HgeFontAsset.hpp>
 #include "../../Core/Subsystem/Render/Font/HgeFontFace.hpp"
@@ -107,10 +108,10 @@ void HgeFontAssetLoader::Update() noexcept
                 texPath = texPath.GetParent() / VFS::Path(m_stTextureFilename);
 
                 // 创建纹理资产
-                auto texAsset = AssetSystem::GetInstance().CreateAsset<BasicTexture2DAsset>(pool, {}, {
-                    {"path", texPath.ToStringView()},
-                    {"mipmap", asset->IsGenerateMipmaps()},
-                });
+                BasicTexture2DAssetArguments texArgs;
+                texArgs.Path = texPath.ToStringView();
+                texArgs.Mipmaps = asset->IsGenerateMipmaps();
+                auto texAsset = AssetSystem::GetInstance().CreateAsset<BasicTexture2DAssetFactory>(pool, {}, texArgs);
                 if (!texAsset)
                 {
                     LSTG_LOG_ERROR_CAT(HgeFontAssetLoader, "Load font texture from \"{}\" fail: {}", texPath.ToStringView(),
@@ -171,6 +172,13 @@ void HgeFontAssetLoader::Update() noexcept
     }
 }
 
+void HgeFontAssetLoader::GetDependencies(std::vector<AssetPtr>& out) const
+{
+    // 只有在解析完字体文件后才能确定依赖的纹理
+    if (m_bWaitForTextureLoaded && m_pLoadedTexture)
+        out.emplace_back(m_pLoadedTexture);
+}
+
 #if LSTG_ASSET_HOT_RELOAD
 bool HgeFontAssetLoader::SupportHotReload() const noexcept
 {
@@ -39,39 +39,53 @@ Result<Subsystem::Asset::CreateAssetResult> HgeParticleAssetFactory::CreateAsset
     auto spriteName = JsonHelper::ReadValue<string>(arguments, "/sprite");
     if (!path || !spriteName)
         return make_error_code(Subsystem::Asset::AssetError::MissingRequiredArgument);
-    auto colliderHalfSizeX = JsonHelper::ReadValue<double>(arguments, "/colliderHalfSizeX", 0);
-    auto colliderHalfSizeY = JsonHelper::ReadValue<double>(arguments, "/colliderHalfSizeY", 0);
-    auto colliderIsRect = JsonHelper::ReadValue<bool>(arguments, "/colliderIsRect", false);
+
+    HgeParticleAssetArguments args;
+    args.Path = *path;
+    args.Sprite = *spriteName;
+    args.ColliderHalfSizeX = JsonHelper::ReadValue<double>(arguments, "/colliderHalfSizeX", 0);
+    args.ColliderHalfSizeY = JsonHelper::ReadValue<double>(arguments, "/colliderHalfSizeY", 0);
+    args.ColliderIsRect = JsonHelper::ReadValue<bool>(arguments, "/colliderIsRect", false);
     auto emitDirectionOverrideInt = JsonHelper::ReadValue<int32_t>(arguments, "/emitDirectionOverride", -1);
-    optional<Subsystem::Render::Drawing2D::ParticleEmitDirection> emitDirectionOverride;
     switch (emitDirectionOverrideInt)
     {
         case static_cast<int32_t>(Subsystem::Render::Drawing2D::ParticleEmitDirection::Fixed):
-            emitDirectionOverride = Subsystem::Render::Drawing2D::ParticleEmitDirection::Fixed;
+            args.EmitDirectionOverride = Subsystem::Render::Drawing2D::ParticleEmitDirection::Fixed;
             break;
         case static_cast<int32_t>(Subsystem::Render::Drawing2D::ParticleEmitDirection::RelativeToSpeed):
-            emitDirectionOverride = Subsystem::Render::Drawing2D::ParticleEmitDirection::RelativeToSpeed;
+            args.EmitDirectionOverride = Subsystem::Render::Drawing2D::ParticleEmitDirection::RelativeToSpeed;
             break;
         case static_cast<int32_t>(Subsystem::Render::Drawing2D::ParticleEmitDirection::OppositeToEmitter):
-            emitDirectionOverride = Subsystem::Render::Drawing2D::ParticleEmitDirection::OppositeToEmitter;
+            args.EmitDirectionOverride = Subsystem::Render::Drawing2D::ParticleEmitDirection::OppositeToEmitter;
             break;
         default:
             break;
     }
+    return CreateAsset(assetSystem, std::move(pool), name, args, resolver);
+}
+
+Result<Subsystem::Asset::CreateAssetResult> HgeParticleAssetFactory::CreateAsset(Subsystem::AssetSystem& assetSystem,
+    Subsystem::Asset::AssetPoolPtr pool, std::string_view name, const HgeParticleAssetArguments& arguments,
+    Subsystem::Asset::IAssetDependencyResolver* resolver) noexcept
+{
+    auto colliderHalfSizeX = arguments.ColliderHalfSizeX;
+    auto colliderHalfSizeY = arguments.ColliderHalfSizeY;
+    if (arguments.Path.empty())
+        return make_error_code(Subsystem::Asset::AssetError::MissingRequiredArgument);
 
     try
     {
         // 找到依赖的精灵
-        auto sprite = static_pointer_cast<SpriteAsset>(resolver->OnResolveAsset(*spriteName));
+        auto sprite = static_pointer_cast<SpriteAsset>(resolver->OnResolveAsset(arguments.Sprite));
         if (!sprite)
         {
-            LSTG_LOG_ERROR_CAT(HgeParticleAssetFactory, "Sprite \"{}\" not found", *spriteName);
+            LSTG_LOG_ERROR_CAT(HgeParticleAssetFactory, "Sprite \"{}\" not found", arguments.Sprite);
             return make_error_code(Subsystem::Asset::AssetError::DependentAssetNotFound);
         }
 
         // 创建 Collider
         ColliderShape collider;
-        if (colliderIsRect)
+        if (arguments.ColliderIsRect)
         {
             Math::Collider2D::OBBShape<double> obbShape;
             obbShape.HalfSize = Vec2(colliderHalfSizeX, colliderHalfSizeY);
@@ -91,8 +105,8 @@ Result<Subsystem::Asset::CreateAssetResult> HgeParticleAssetFactory::CreateAsset
             collider = ellipseShape;
         }
 
-        auto asset = make_shared<HgeParticleAsset>(string{name}, std::move(*path), std::move(sprite), collider);
-        auto loader = make_shared<HgeParticleAssetLoader>(asset, emitDirectionOverride);
+        auto asset = make_shared<HgeParticleAsset>(string{name}, string{arguments.Path}, std::move(sprite), collider);
+        auto loader = make_shared<HgeParticleAssetLoader>(asset, arguments.EmitDirectionOverride);
         return Subsystem::Asset::CreateAssetResult {
             static_pointer_cast<Subsystem::Asset::Asset>(asset),
             static_pointer_cast<Subsystem::Asset::AssetLoader>(loader)
@@ -97,6 +97,10 @@ Result<void> HgeParticleAssetLoader::PostLoad() noexcept
 
 void HgeParticleAssetLoader::Update() noexcept
 {
+    // 仅在等待依赖时处理，避免打断后续的加载流程
+    if (GetState() != AssetLoadingStates::DependencyLoading)
+        return;
+
     auto asset = static_pointer_cast<HgeParticleAsset>(GetAsset());
 
     // 检查依赖的资源是否加载完毕
@@ -116,6 +120,12 @@ void HgeParticleAssetLoader::Update() noexcept
     }
 }
 
+void HgeParticleAssetLoader::GetDependencies(std::vector<Subsystem::Asset::AssetPtr>& out) const
+{
+    auto asset = static_pointer_cast<HgeParticleAsset>(GetAsset());
+    out.emplace_back(asset->GetSpriteAsset());
+}
+
 #if LSTG_ASSET_HOT_RELOAD
 bool HgeParticleAssetLoader::SupportHotReload() const noexcept
 {
@@ -34,12 +34,24 @@ Result<Subsystem::Asset::CreateAssetResult> MusicAssetFactory::CreateAsset(Subsy
     auto path = JsonHelper::ReadValue<string>(arguments, "/path");
     if (!path)
         return make_error_code(Subsystem::Asset::AssetError::MissingRequiredArgument);
-    auto loopBegin = JsonHelper::ReadValue<uint32_t>(arguments, "/loopBeginMs", 0);
-    auto loopEnd = JsonHelper::ReadValue<uint32_t>(arguments, "/loopEndMs", std::numeric_limits<uint32_t>::max());
+
+    MusicAssetArguments args;
+    args.Path = *path;
+    args.LoopBeginMs = JsonHelper::ReadValue<uint32_t>(arguments, "/loopBeginMs", 0);
+    args.LoopEndMs = JsonHelper::ReadValue<uint32_t>(arguments, "/loopEndMs", std::numeric_limits<uint32_t>::max());
+    return CreateAsset(assetSystem, std::move(pool), name, args, resolver);
+}
+
+Result<Subsystem::Asset::CreateAssetResult> MusicAssetFactory::CreateAsset(Subsystem::AssetSystem& assetSystem,
+    Subsystem::Asset::AssetPoolPtr pool, std::string_view name, const MusicAssetArguments& arguments,
+    Subsystem::Asset::IAssetDependencyResolver* resolver) noexcept
+{
+    if (arguments.Path.empty())
+        return make_error_code(Subsystem::Asset::AssetError::MissingRequiredArgument);
 
     try
     {
-        auto asset = make_shared<MusicAsset>(std::string{name}, std::move(*path), MusicLoopRange { loopBegin, loopEnd });
+        auto asset = make_shared<MusicAsset>(std::string{name}, std::string{arguments.Path}, MusicLoopRange { arguments.LoopBeginMs, arguments.LoopEndMs });
         auto loader = make_shared<MusicAssetLoader>(asset);
         return Subsystem::Asset::CreateAssetResult { static_pointer_cast<Subsystem::Asset::Asset>(asset),
             static_pointer_cast<Subsystem::Asset::AssetLoader>(loader) };
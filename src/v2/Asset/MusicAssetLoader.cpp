@@ -118,4 +118,9 @@ void MusicAssetLoader::PrepareToReload() noexcept
     // 开始重新加载
     SetState(AssetLoadingStates::Pending);
 }
+
+std::string_view MusicAssetLoader::GetWatchedPath() const noexcept
+{
+    return static_pointer_cast<MusicAsset>(GetAsset())->GetPath();
+}
 #endif
@@ -35,9 +35,21 @@ Result<Subsystem::Asset::CreateAssetResult> SoundAssetFactory::CreateAsset(Subsy
     if (!path)
         return make_error_code(Subsystem::Asset::AssetError::MissingRequiredArgument);
 
+    SoundAssetArguments args;
+    args.Path = *path;
+    return CreateAsset(assetSystem, std::move(pool), name, args, resolver);
+}
+
+Result<Subsystem::Asset::CreateAssetResult> SoundAssetFactory::CreateAsset(Subsystem::AssetSystem& assetSystem,
+    Subsystem::Asset::AssetPoolPtr pool, std::string_view name, const SoundAssetArguments& arguments,
+    Subsystem::Asset::IAssetDependencyResolver* resolver) noexcept
+{
+    if (arguments.Path.empty())
+        return make_error_code(Subsystem::Asset::AssetError::MissingRequiredArgument);
+
     try
     {
-        auto asset = make_shared<SoundAsset>(std::string{name}, std::move(*path));
+        auto asset = make_shared<SoundAsset>(std::string{name}, std::string{arguments.Path});
         auto loader = make_shared<SoundAssetLoader>(asset);
         return Subsystem::Asset::CreateAssetResult { static_pointer_cast<Subsystem::Asset::Asset>(asset),
             static_pointer_cast<Subsystem::Asset::AssetLoader>(loader) };
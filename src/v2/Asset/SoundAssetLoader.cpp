@@ -124,4 +124,9 @@ void SoundAssetLoader::PrepareToReload() noexcept
     // 开始重新加载
     SetState(AssetLoadingStates::Pending);
 }
+
+std::string_view SoundAssetLoader::GetWatchedPath() const noexcept
+{
+    return static_pointer_cast<SoundAsset>(GetAsset())->GetPath();
+}
 #endif
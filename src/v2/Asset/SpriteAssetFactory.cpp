@@ -44,24 +44,40 @@ Result<Subsystem::Asset::CreateAssetResult> SpriteAssetFactory::CreateAsset(Subs
     auto frameH = JsonHelper::ReadValue<float>(arguments, "/height");
     if (!frameX || !frameY || !frameW || !frameH)
         return make_error_code(Subsystem::Asset::AssetError::MissingRequiredArgument);
-    auto colliderHalfSizeX = JsonHelper::ReadValue<double>(arguments, "/colliderHalfSizeX", 0);
-    auto colliderHalfSizeY = JsonHelper::ReadValue<double>(arguments, "/colliderHalfSizeY", 0);
-    auto colliderIsRect = JsonHelper::ReadValue<bool>(arguments, "/colliderIsRect", false);
+
+    SpriteAssetArguments args;
+    args.Texture = *textureName;
+    args.Left = *frameX;
+    args.Top = *frameY;
+    args.Width = *frameW;
+    args.Height = *frameH;
+    args.ColliderHalfSizeX = JsonHelper::ReadValue<double>(arguments, "/colliderHalfSizeX", 0);
+    args.ColliderHalfSizeY = JsonHelper::ReadValue<double>(arguments, "/colliderHalfSizeY", 0);
+    args.ColliderIsRect = JsonHelper::ReadValue<bool>(arguments, "/colliderIsRect", false);
+    return CreateAsset(assetSystem, std::move(pool), name, args, resolver);
+}
+
+Result<Subsystem::Asset::CreateAssetResult> SpriteAssetFactory::CreateAsset(Subsystem::AssetSystem& assetSystem,
+    Subsystem::Asset::AssetPoolPtr pool, std::string_view name, const SpriteAssetArguments& arguments,
+    Subsystem::Asset::IAssetDependencyResolver* resolver) noexcept
+{
+    auto colliderHalfSizeX = arguments.ColliderHalfSizeX;
+    auto colliderHalfSizeY = arguments.ColliderHalfSizeY;
 
     try
     {
         // 找到依赖的纹理
         assert(resolver);
-        auto texture = static_pointer_cast<TextureAsset>(resolver->OnResolveAsset(*textureName));
+        auto texture = static_pointer_cast<TextureAsset>(resolver->OnResolveAsset(arguments.Texture));
         if (!texture)
         {
-            LSTG_LOG_ERROR_CAT(SpriteAssetFactory, "Texture \"{}\" not found", *textureName);
+            LSTG_LOG_ERROR_CAT(SpriteAssetFactory, "Texture \"{}\" not found", arguments.Texture);
             return make_error_code(Subsystem::Asset::AssetError::DependentAssetNotFound);
         }
 
         // 创建 Collider
         ColliderShape collider;
-        if (colliderIsRect)
+        if (arguments.ColliderIsRect)
         {
             Math::Collider2D::OBBShape<double> obbShape;
             obbShape.HalfSize = Vec2(colliderHalfSizeX, colliderHalfSizeY);
@@ -82,7 +98,7 @@ Result<Subsystem::Asset::CreateAssetResult> SpriteAssetFactory::CreateAsset(Subs
         }
 
         auto asset = make_shared<SpriteAsset>(string{name}, std::move(texture),
-            Math::ImageRectangleFloat(*frameX, *frameY, *frameW, *frameH), collider);
+            Math::ImageRectangleFloat(arguments.Left, arguments.Top, arguments.Width, arguments.Height), collider);
         auto loader = make_shared<SpriteAssetLoader>(asset);
         return Subsystem::Asset::CreateAssetResult {
             static_pointer_cast<Subsystem::Asset::Asset>(asset),
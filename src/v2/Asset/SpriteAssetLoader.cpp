@@ -62,6 +62,12 @@ void SpriteAssetLoader::Update() noexcept
     }
 }
 
+void SpriteAssetLoader::GetDependencies(std::vector<Subsystem::Asset::AssetPtr>& out) const
+{
+    auto asset = static_pointer_cast<SpriteAsset>(GetAsset());
+    out.emplace_back(asset->GetTextureAsset());
+}
+
 #if LSTG_ASSET_HOT_RELOAD
 bool SpriteAssetLoader::SupportHotReload() const noexcept
 {
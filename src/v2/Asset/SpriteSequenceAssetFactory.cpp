@@ -48,34 +48,55 @@ Result<Subsystem::Asset::CreateAssetResult> SpriteSequenceAssetFactory::CreateAs
 
     if (!sequencesX || !sequencesY || !frameW || !frameH || !row || !column || !interval)
         return make_error_code(Subsystem::Asset::AssetError::MissingRequiredArgument);
-    auto colliderHalfSizeX = JsonHelper::ReadValue<double>(arguments, "/colliderHalfSizeX", 0);
-    auto colliderHalfSizeY = JsonHelper::ReadValue<double>(arguments, "/colliderHalfSizeY", 0);
-    auto colliderIsRect = JsonHelper::ReadValue<bool>(arguments, "/colliderIsRect", false);
+
+    SpriteSequenceAssetArguments args;
+    args.Texture = *textureName;
+    args.Left = *sequencesX;
+    args.Top = *sequencesY;
+    args.FrameWidth = *frameW;
+    args.FrameHeight = *frameH;
+    args.Row = *row;
+    args.Column = *column;
+    args.Interval = *interval;
+    args.ColliderHalfSizeX = JsonHelper::ReadValue<double>(arguments, "/colliderHalfSizeX", 0);
+    args.ColliderHalfSizeY = JsonHelper::ReadValue<double>(arguments, "/colliderHalfSizeY", 0);
+    args.ColliderIsRect = JsonHelper::ReadValue<bool>(arguments, "/colliderIsRect", false);
+    return CreateAsset(assetSystem, std::move(pool), name, args, resolver);
+}
+
+Result<Subsystem::Asset::CreateAssetResult> SpriteSequenceAssetFactory::CreateAsset(Subsystem::AssetSystem& assetSystem,
+    Subsystem::Asset::AssetPoolPtr pool, std::string_view name, const SpriteSequenceAssetArguments& arguments,
+    Subsystem::Asset::IAssetDependencyResolver* resolver) noexcept
+{
+    auto colliderHalfSizeX = arguments.ColliderHalfSizeX;
+    auto colliderHalfSizeY = arguments.ColliderHalfSizeY;
+    if (arguments.Row <= 0 || arguments.Column <= 0)
+        return make_error_code(std::errc::invalid_argument);
 
     try
     {
         // 找到依赖的纹理
         assert(resolver);
-        auto texture = static_pointer_cast<TextureAsset>(resolver->OnResolveAsset(*textureName));
+        auto texture = static_pointer_cast<TextureAsset>(resolver->OnResolveAsset(arguments.Texture));
         if (!texture)
         {
-            LSTG_LOG_ERROR_CAT(SpriteSequenceAssetFactory, "Texture \"{}\" not found", *textureName);
+            LSTG_LOG_ERROR_CAT(SpriteSequenceAssetFactory, "Texture \"{}\" not found", arguments.Texture);
             return make_error_code(Subsystem::Asset::AssetError::DependentAssetNotFound);
         }
 
         // 拆分构造 Frames
         std::vector<Subsystem::Render::Drawing2D::Sprite> frames;
-        frames.reserve(*row * *column);
-        for (int j = 0; j < *row; ++j)  // 行
+        frames.reserve(arguments.Row * arguments.Column);
+        for (int j = 0; j < arguments.Row; ++j)  // 行
         {
-            for (int i = 0; i < *column; ++i)  // 列
+            for (int i = 0; i < arguments.Column; ++i)  // 列
             {
                 Subsystem::Render::Drawing2D::Sprite sprite;
                 sprite.SetFrame({
-                    *sequencesX + *frameW * i,  // left
-                    *sequencesY + *frameH * j,  // top
-                    *frameW,  // width
-                    *frameH  // height
+                    arguments.Left + arguments.FrameWidth * i,  // left
+                    arguments.Top + arguments.FrameHeight * j,  // top
+                    arguments.FrameWidth,  // width
+                    arguments.FrameHeight  // height
                 });
                 frames.push_back(sprite);
             }
@@ -85,7 +106,7 @@ Result<Subsystem::Asset::CreateAssetResult> SpriteSequenceAssetFactory::CreateAs
 
         // 创建 Collider
         ColliderShape collider;
-        if (colliderIsRect)
+        if (arguments.ColliderIsRect)
         {
             Math::Collider2D::OBBShape<double> obbShape;
             obbShape.HalfSize = Vec2(colliderHalfSizeX, colliderHalfSizeY);
@@ -105,7 +126,7 @@ Result<Subsystem::Asset::CreateAssetResult> SpriteSequenceAssetFactory::CreateAs
             collider = ellipseShape;
         }
 
-        auto asset = make_shared<SpriteSequenceAsset>(string{name}, std::move(texture), std::move(frames), *interval, collider);
+        auto asset = make_shared<SpriteSequenceAsset>(string{name}, std::move(texture), std::move(frames), arguments.Interval, collider);
         auto loader = make_shared<SpriteSequenceAssetLoader>(asset);
         return Subsystem::Asset::CreateAssetResult {
             static_pointer_cast<Subsystem::Asset::Asset>(asset),
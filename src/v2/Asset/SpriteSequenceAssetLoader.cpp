@@ -62,6 +62,12 @@ void SpriteSequenceAssetLoader::Update() noexcept
     }
 }
 
+void SpriteSequenceAssetLoader::GetDependencies(std::vector<Subsystem::Asset::AssetPtr>& out) const
+{
+    auto asset = static_pointer_cast<SpriteSequenceAsset>(GetAsset());
+    out.emplace_back(asset->GetTextureAsset());
+}
+
 #if LSTG_ASSET_HOT_RELOAD
 bool SpriteSequenceAssetLoader::SupportHotReload() const noexcept
 {
@@ -10,6 +10,8 @@
 #include <lstg/Core/Logging.hpp>
 #include <lstg/Core/Text/JsonHelper.hpp>
 #include <lstg/Core/Subsystem/AssetSystem.hpp>
+#include <lstg/Core/Subsystem/Asset/AssetError.hpp>
+#include <lstg/Core/Subsystem/Asset/BasicTexture2DAssetFactory.hpp>
 #include <lstg/v2/Asset/TextureAsset.hpp>
 #include <lstg/v2/Asset/TextureAssetLoader.hpp>
 
@@ -35,12 +37,31 @@ Result<Subsystem::Asset::CreateAssetResult> TextureAssetFactory::CreateAsset(Sub
     Subsystem::Asset::AssetPoolPtr pool, std::string_view name, const nlohmann::json& arguments,
     Subsystem::Asset::IAssetDependencyResolver* resolver) noexcept
 {
-    auto isRenderTarget = JsonHelper::ReadValue<bool>(arguments, "/rt", false);
-    auto pixelPerUnit = JsonHelper::ReadValue<float>(arguments, "/ppu", 1.f);
+    TextureAssetArguments args;
+    args.RenderTarget = JsonHelper::ReadValue<bool>(arguments, "/rt", false);
+    args.Mipmaps = JsonHelper::ReadValue<bool>(arguments, "/mipmaps", true);
+    args.PixelPerUnit = JsonHelper::ReadValue<float>(arguments, "/ppu", 1.f);
+
+    optional<string> path;
+    if (!args.RenderTarget)
+    {
+        path = JsonHelper::ReadValue<string>(arguments, "/path");
+        if (!path)
+            return make_error_code(Subsystem::Asset::AssetError::MissingRequiredArgument);
+        args.Path = *path;
+    }
+    return CreateAsset(assetSystem, std::move(pool), name, args, resolver);
+}
+
+Result<Subsystem::Asset::CreateAssetResult> TextureAssetFactory::CreateAsset(Subsystem::AssetSystem& assetSystem,
+    Subsystem::Asset::AssetPoolPtr pool, std::string_view name, const TextureAssetArguments& arguments,
+    Subsystem::Asset::IAssetDependencyResolver* resolver) noexcept
+{
+    auto pixelPerUnit = arguments.PixelPerUnit;
 
     try
     {
-        if (isRenderTarget)
+        if (arguments.RenderTarget)
         {
             auto& renderSystem = assetSystem.GetRenderSystem();
 
@@ -65,7 +86,10 @@ Result<Subsystem::Asset::CreateAssetResult> TextureAssetFactory::CreateAsset(Sub
         }
         else
         {
-            auto basicTexture = assetSystem.CreateAsset<Subsystem::Asset::BasicTexture2DAsset>(pool, {}, arguments);
+            Subsystem::Asset::BasicTexture2DAssetArguments basicTextureArgs;
+            basicTextureArgs.Path = arguments.Path;
+            basicTextureArgs.Mipmaps = arguments.Mipmaps;
+            auto basicTexture = assetSystem.CreateAsset<Subsystem::Asset::BasicTexture2DAssetFactory>(pool, {}, basicTextureArgs);
             auto asset = make_shared<TextureAsset>(string{name}, std::move(basicTexture.ThrowIfError()), pixelPerUnit);
             auto loader = make_shared<TextureAssetLoader>(asset);
             return Subsystem::Asset::CreateAssetResult {
@@ -132,13 +156,14 @@ Result<Subsystem::Render::Camera::OutputViews> TextureAssetFactory::CreateViews(
     auto& renderSystem = Subsystem::AssetSystem::GetInstance().GetRenderSystem();
 
     // 创建 RT
-    auto rt = renderSystem.CreateRenderTarget(width, height);
+    // 通过 RT 池分配，使得脚本反复创建、销毁同样大小的 RT 时可以直接复用显存
+    auto rt = renderSystem.AcquireRenderTarget(width, height);
     if (!rt)
     {
         LSTG_LOG_ERROR_CAT(TextureAssetFactory, "Create render target {}x{} fail: {}", width, height, rt.GetError());
         return rt.GetError();
     }
-    auto ds = renderSystem.CreateDepthStencil(width, height);
+    auto ds = renderSystem.AcquireDepthStencil(width, height);
     if (!ds)
     {
         LSTG_LOG_ERROR_CAT(TextureAssetFactory, "Create depth stencil buffer {}x{} fail: {}", width, height, rt.GetError());
@@ -74,6 +74,13 @@ void TextureAssetLoader::Update() noexcept
     }
 }
 
+void TextureAssetLoader::GetDependencies(std::vector<Subsystem::Asset::AssetPtr>& out) const
+{
+    auto asset = static_pointer_cast<TextureAsset>(GetAsset());
+    if (!asset->IsRenderTarget())
+        out.emplace_back(asset->GetBasicTextureAsset());
+}
+
 #if LSTG_ASSET_HOT_RELOAD
 bool TextureAssetLoader::SupportHotReload() const noexcept
 {
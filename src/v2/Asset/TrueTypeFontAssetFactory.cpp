@@ -41,9 +41,22 @@ Result<Subsystem::Asset::CreateAssetResult> TrueTypeFontAssetFactory::CreateAsse
     if (!path || !fontSize)
         return make_error_code(Subsystem::Asset::AssetError::MissingRequiredArgument);
 
+    TrueTypeFontAssetArguments args;
+    args.Path = *path;
+    args.Size = *fontSize;
+    return CreateAsset(assetSystem, std::move(pool), name, args, resolver);
+}
+
+Result<Subsystem::Asset::CreateAssetResult> TrueTypeFontAssetFactory::CreateAsset(Subsystem::AssetSystem& assetSystem,
+    Subsystem::Asset::AssetPoolPtr pool, std::string_view name, const TrueTypeFontAssetArguments& arguments,
+    Subsystem::Asset::IAssetDependencyResolver* resolver) noexcept
+{
+    if (arguments.Path.empty())
+        return make_error_code(Subsystem::Asset::AssetError::MissingRequiredArgument);
+
     try
     {
-        auto asset = make_shared<TrueTypeFontAsset>(std::string{name}, std::move(*path), *fontSize);
+        auto asset = make_shared<TrueTypeFontAsset>(std::string{name}, std::string{arguments.Path}, arguments.Size);
         auto loader = make_shared<TrueTypeFontAssetLoader>(asset, m_pTTFFontFactory);
         return Subsystem::Asset::CreateAssetResult { static_pointer_cast<Subsystem::Asset::Asset>(asset),
             static_pointer_cast<Subsystem::Asset::AssetLoader>(loader) };
@@ -139,4 +139,9 @@ void TrueTypeFontAssetLoader::PrepareToReload() noexcept
     // 转到 Pending 状态，准备重新加载
     SetState(AssetLoadingStates::Pending);
 }
+
+std::string_view TrueTypeFontAssetLoader::GetWatchedPath() const noexcept
+{
+    return static_pointer_cast<TrueTypeFontAsset>(GetAsset())->GetPath();
+}
 #endif
@@ -0,0 +1,263 @@
+/**
+ * @file
+ * @author 9chu
+ * @date 2022/8/28
+ * 此文件为 LuaSTGPlus 项目的一部分，版权与许可声明详见 COPYRIGHT.txt。
+ */
+#include <lstg/v2/AssetBundle.hpp>
+
+#include <cstring>
+#include <algorithm>
+#include <lstg/Core/Logging.hpp>
+#include <lstg/v2/Asset/TextureAssetFactory.hpp>
+#include <lstg/v2/Asset/SpriteAssetFactory.hpp>
+#include <lstg/v2/Asset/SpriteSequenceAssetFactory.hpp>
+#include <lstg/v2/Asset/TrueTypeFontAssetFactory.hpp>
+#include <lstg/v2/Asset/HgeFontAssetFactory.hpp>
+#include <lstg/v2/Asset/HgeParticleAssetFactory.hpp>
+#include <lstg/v2/Asset/EffectAssetFactory.hpp>
+#include <lstg/v2/Asset/SoundAssetFactory.hpp>
+#include <lstg/v2/Asset/MusicAssetFactory.hpp>
+
+using namespace std;
+using namespace lstg;
+using namespace lstg::v2;
+using namespace lstg::v2::detail;
+
+LSTG_DEF_LOG_CATEGORY(AssetBundle);
+
+namespace
+{
+    const char kManifestMagic[4] = { 'L', 'S', 'A', 'M' };
+    const uint32_t kManifestVersion = 1;
+    const uint32_t kNoString = 0xFFFFFFFFu;
+
+    class ManifestStringTable
+    {
+    public:
+        ManifestStringTable(const char* data, size_t size) noexcept
+            : m_pData(data), m_uSize(size) {}
+
+    public:
+        bool Get(string_view& out, uint32_t offset) const noexcept
+        {
+            if (offset == kNoString)
+            {
+                out = {};
+                return true;
+            }
+            if (offset >= m_uSize)
+                return false;
+            auto end = static_cast<const char*>(::memchr(m_pData + offset, '\0', m_uSize - offset));
+            if (!end)
+                return false;
+            out = { m_pData + offset, static_cast<size_t>(end - (m_pData + offset)) };
+            return true;
+        }
+
+    private:
+        const char* m_pData = nullptr;
+        size_t m_uSize = 0;
+    };
+
+    Result<void> CreateAssetFromRecord(Subsystem::AssetSystem& assetSystem, const Subsystem::Asset::AssetPoolPtr& pool,
+        const AssetBundleRecord& record, const string& fullName, string_view path, string_view reference) noexcept
+    {
+        switch (static_cast<AssetTypes>(record.Type))
+        {
+            case AssetTypes::Texture:
+                {
+                    Asset::TextureAssetArguments args;
+                    args.Path = path;
+                    args.Mipmaps = (record.Flags & AssetBundleRecordFlags::Mipmaps) != 0;
+                    auto r = assetSystem.CreateAsset<Asset::TextureAssetFactory>(pool, fullName, args);
+                    if (!r)
+                        return r.GetError();
+                }
+                break;
+            case AssetTypes::Image:
+                {
+                    string textureFullName;
+                    auto r0 = MakeFullAssetName(textureFullName, AssetTypes::Texture, reference);
+                    if (!r0)
+                        return r0.GetError();
+
+                    Asset::SpriteAssetArguments args;
+                    args.Texture = textureFullName;
+                    args.Left = record.Rect[0];
+                    args.Top = record.Rect[1];
+                    args.Width = record.Rect[2];
+                    args.Height = record.Rect[3];
+                    args.ColliderHalfSizeX = record.Collider[0];
+                    args.ColliderHalfSizeY = record.Collider[1];
+                    args.ColliderIsRect = (record.Flags & AssetBundleRecordFlags::ColliderIsRect) != 0;
+                    auto r = assetSystem.CreateAsset<Asset::SpriteAssetFactory>(pool, fullName, args);
+                    if (!r)
+                        return r.GetError();
+                }
+                break;
+            case AssetTypes::Animation:
+                {
+                    string textureFullName;
+                    auto r0 = MakeFullAssetName(textureFullName, AssetTypes::Texture, reference);
+                    if (!r0)
+                        return r0.GetError();
+
+                    Asset::SpriteSequenceAssetArguments args;
+                    args.Texture = textureFullName;
+                    args.Left = record.Rect[0];
+                    args.Top = record.Rect[1];
+                    args.FrameWidth = record.Rect[2];
+                    args.FrameHeight = record.Rect[3];
+                    args.Row = record.Params[0];
+                    args.Column = record.Params[1];
+                    args.Interval = record.Params[2];
+                    args.ColliderHalfSizeX = record.Collider[0];
+                    args.ColliderHalfSizeY = record.Collider[1];
+                    args.ColliderIsRect = (record.Flags & AssetBundleRecordFlags::ColliderIsRect) != 0;
+                    auto r = assetSystem.CreateAsset<Asset::SpriteSequenceAssetFactory>(pool, fullName, args);
+                    if (!r)
+                        return r.GetError();
+                }
+                break;
+            case AssetTypes::Music:
+                {
+                    Asset::MusicAssetArguments args;
+                    args.Path = path;
+                    args.LoopBeginMs = static_cast<uint32_t>(record.Params[0]);
+                    args.LoopEndMs = static_cast<uint32_t>(record.Params[1]);
+                    auto r = assetSystem.CreateAsset<Asset::MusicAssetFactory>(pool, fullName, args);
+                    if (!r)
+                        return r.GetError();
+                }
+                break;
+            case AssetTypes::Sound:
+                {
+                    Asset::SoundAssetArguments args;
+                    args.Path = path;
+                    auto r = assetSystem.CreateAsset<Asset::SoundAssetFactory>(pool, fullName, args);
+                    if (!r)
+                        return r.GetError();
+                }
+                break;
+            case AssetTypes::Particle:
+                {
+                    string spriteFullName;
+                    auto r0 = MakeFullAssetName(spriteFullName, AssetTypes::Image, reference);
+                    if (!r0)
+                        return r0.GetError();
+
+                    Asset::HgeParticleAssetArguments args;
+                    args.Path = path;
+                    args.Sprite = spriteFullName;
+                    args.ColliderHalfSizeX = record.Collider[0];
+                    args.ColliderHalfSizeY = record.Collider[1];
+                    args.ColliderIsRect = (record.Flags & AssetBundleRecordFlags::ColliderIsRect) != 0;
+                    args.EmitDirectionOverride = Subsystem::Render::Drawing2D::ParticleEmitDirection::OppositeToEmitter;  // 同 LoadPS
+                    auto r = assetSystem.CreateAsset<Asset::HgeParticleAssetFactory>(pool, fullName, args);
+                    if (!r)
+                        return r.GetError();
+                }
+                break;
+            case AssetTypes::TexturedFont:
+                {
+                    Asset::HgeFontAssetArguments args;
+                    args.Path = path;
+                    args.Mipmaps = (record.Flags & AssetBundleRecordFlags::Mipmaps) != 0;
+                    auto r = assetSystem.CreateAsset<Asset::HgeFontAssetFactory>(pool, fullName, args);
+                    if (!r)
+                        return r.GetError();
+                }
+                break;
+            case AssetTypes::TrueTypeFont:
+                {
+                    Asset::TrueTypeFontAssetArguments args;
+                    args.Path = path;
+                    args.Size = static_cast<uint32_t>(std::clamp(record.Params[0], 1, 100));
+                    auto r = assetSystem.CreateAsset<Asset::TrueTypeFontAssetFactory>(pool, fullName, args);
+                    if (!r)
+                        return r.GetError();
+                }
+                break;
+            case AssetTypes::Effect:
+                {
+                    Asset::EffectAssetArguments args;
+                    args.Path = path;
+                    auto r = assetSystem.CreateAsset<Asset::EffectAssetFactory>(pool, fullName, args);
+                    if (!r)
+                        return r.GetError();
+                }
+                break;
+            default:
+                return make_error_code(errc::invalid_argument);
+        }
+        return {};
+    }
+}
+
+Result<size_t> v2::CreateAssetsFromBundle(Subsystem::AssetSystem& assetSystem, Subsystem::Asset::AssetPoolPtr pool,
+    Subsystem::VFS::IFileSystem& bundle) noexcept
+{
+    assert(pool);
+
+    // 清单一次性读入内存，记录为定长结构，无需逐字段解析
+    vector<uint8_t> manifest;
+    {
+        auto stream = bundle.OpenFile(Subsystem::VFS::Path{kAssetBundleManifestPath}, Subsystem::VFS::FileAccessMode::Read,
+            Subsystem::VFS::FileOpenFlags::None);
+        if (!stream)
+            return stream.GetError();
+        auto ret = Subsystem::VFS::ReadAll(manifest, stream->get());
+        if (!ret)
+            return ret.GetError();
+    }
+
+    AssetBundleManifestHeader header {};
+    if (manifest.size() < sizeof(header))
+        return make_error_code(errc::io_error);
+    ::memcpy(&header, manifest.data(), sizeof(header));
+    if (::memcmp(header.Magic, kManifestMagic, sizeof(kManifestMagic)) != 0 || header.Version != kManifestVersion)
+        return make_error_code(errc::invalid_argument);
+
+    auto recordTableSize = static_cast<uint64_t>(header.RecordCount) * sizeof(AssetBundleRecord);
+    if (sizeof(header) + recordTableSize + header.StringTableSize > manifest.size())
+        return make_error_code(errc::io_error);
+
+    const auto* records = manifest.data() + sizeof(header);
+    ManifestStringTable strings(reinterpret_cast<const char*>(records + recordTableSize), header.StringTableSize);
+
+    size_t created = 0;
+    string fullName;
+    for (uint32_t i = 0; i < header.RecordCount; ++i)
+    {
+        AssetBundleRecord record {};
+        ::memcpy(&record, records + i * sizeof(AssetBundleRecord), sizeof(record));
+
+        string_view name, path, reference;
+        if (!strings.Get(name, record.Name) || !strings.Get(path, record.Path) || !strings.Get(reference, record.Reference))
+            return make_error_code(errc::io_error);
+        if (record.Type < static_cast<uint32_t>(AssetTypes::Texture) || record.Type > static_cast<uint32_t>(AssetTypes::Effect))
+        {
+            LSTG_LOG_ERROR_CAT(AssetBundle, "Unknown asset type {} in bundle, name={}", record.Type, name);
+            continue;
+        }
+
+        auto ret = MakeFullAssetName(fullName, static_cast<AssetTypes>(record.Type), name);
+        if (!ret)
+            return ret.GetError();
+
+        // 已经加载的资产跳过，与各 Load 接口行为一致
+        if (pool->ContainsAsset(fullName))
+            continue;
+
+        ret = CreateAssetFromRecord(assetSystem, pool, record, fullName, path, reference);
+        if (!ret)
+        {
+            // 与脚本接口不同，单个资产失败不中断整个资源束
+            LSTG_LOG_ERROR_CAT(AssetBundle, "Create asset \"{}\" from bundle fail: {}", fullName, ret.GetError());
+            continue;
+        }
+        ++created;
+    }
+    return created;
+}
@@ -8,15 +8,25 @@
 
 #include <lstg/Core/Logging.hpp>
 #include <lstg/Core/Subsystem/AssetSystem.hpp>
+#include <lstg/v2/AssetBundle.hpp>
 #include <lstg/v2/Asset/TextureAsset.hpp>
+#include <lstg/v2/Asset/TextureAssetFactory.hpp>
 #include <lstg/v2/Asset/SpriteAsset.hpp>
+#include <lstg/v2/Asset/SpriteAssetFactory.hpp>
 #include <lstg/v2/Asset/SpriteSequenceAsset.hpp>
+#include <lstg/v2/Asset/SpriteSequenceAssetFactory.hpp>
 #include <lstg/v2/Asset/TrueTypeFontAsset.hpp>
+#include <lstg/v2/Asset/TrueTypeFontAssetFactory.hpp>
 #include <lstg/v2/Asset/HgeFontAsset.hpp>
+#include <lstg/v2/Asset/HgeFontAssetFactory.hpp>
 #include <lstg/v2/Asset/EffectAsset.hpp>
+#include <lstg/v2/Asset/EffectAssetFactory.hpp>
 #include <lstg/v2/Asset/HgeParticleAsset.hpp>
+#include <lstg/v2/Asset/HgeParticleAssetFactory.hpp>
 #include <lstg/v2/Asset/SoundAsset.hpp>
+#include <lstg/v2/Asset/SoundAssetFactory.hpp>
 #include <lstg/v2/Asset/MusicAsset.hpp>
+#include <lstg/v2/Asset/MusicAssetFactory.hpp>
 #include "detail/Helper.hpp"
 
 using namespace std;
@@ -152,12 +162,15 @@ void AssetManagerModule::LoadTexture(LuaStack& stack, const char* name, const ch
         return;
     }
 
+    // 构造参数
+    auto resolvedPath = detail::ResolveAbsoluteOrRelativePath(stack, path);
+    Asset::TextureAssetArguments args;
+    args.RenderTarget = false;
+    args.Path = resolvedPath;
+    args.Mipmaps = mipmap ? *mipmap : false;
+
     // 执行加载
-    auto ret = assetSystem->CreateAsset<Asset::TextureAsset>(currentAssetPool, fullName, nlohmann::json {
-        {"rt", false},
-        {"path", detail::ResolveAbsoluteOrRelativePath(stack, path)},
-        {"mipmaps", mipmap ? *mipmap : false},
-    });
+    auto ret = assetSystem->CreateAsset<Asset::TextureAssetFactory>(currentAssetPool, fullName, args);
     if (!ret)
         stack.Error("load texture from file '%s' fail: %s", path, ret.GetError().message().c_str());
 }
@@ -179,19 +192,19 @@ void AssetManagerModule::LoadImage(LuaStack& stack, const char* name, const char
     }
 
     // 构造参数
-    nlohmann::json args {
-        {"texture", MakeFullAssetName(AssetTypes::Texture, textureName)},
-        {"left", x},
-        {"top", y},
-        {"width", w},
-        {"height", h},
-        {"colliderHalfSizeX", a ? *a : 0.},
-        {"colliderHalfSizeY", b ? *b : (a ? *a : 0.)},
-        {"colliderIsRect", rect && *rect},
-    };
+    auto textureFullName = MakeFullAssetName(AssetTypes::Texture, textureName);
+    Asset::SpriteAssetArguments args;
+    args.Texture = textureFullName;
+    args.Left = static_cast<float>(x);
+    args.Top = static_cast<float>(y);
+    args.Width = static_cast<float>(w);
+    args.Height = static_cast<float>(h);
+    args.ColliderHalfSizeX = a ? *a : 0.;
+    args.ColliderHalfSizeY = b ? *b : (a ? *a : 0.);
+    args.ColliderIsRect = rect && *rect;
 
     // 执行加载
-    auto ret = assetSystem->CreateAsset<Asset::SpriteAsset>(currentAssetPool, fullName, args);
+    auto ret = assetSystem->CreateAsset<Asset::SpriteAssetFactory>(currentAssetPool, fullName, args);
     if (!ret)
         stack.Error("load image \"%s\" fail: %s", name, ret.GetError().message().c_str());
 }
@@ -278,22 +291,22 @@ void AssetManagerModule::LoadAnimation(LuaStack& stack, const char* name, const
     }
 
     // 构造参数
-    nlohmann::json args {
-        {"texture", MakeFullAssetName(AssetTypes::Texture, textureName)},
-        {"left", x},
-        {"top", y},
-        {"frameWidth", w},
-        {"frameHeight", h},
-        {"row", m},
-        {"column", n},
-        {"interval", interval},
-        {"colliderHalfSizeX", a ? *a : 0.},
-        {"colliderHalfSizeY", b ? *b : (a ? *a : 0.)},
-        {"colliderIsRect", rect && *rect},
-    };
+    auto textureFullName = MakeFullAssetName(AssetTypes::Texture, textureName);
+    Asset::SpriteSequenceAssetArguments args;
+    args.Texture = textureFullName;
+    args.Left = static_cast<float>(x);
+    args.Top = static_cast<float>(y);
+    args.FrameWidth = static_cast<float>(w);
+    args.FrameHeight = static_cast<float>(h);
+    args.Row = m;
+    args.Column = n;
+    args.Interval = interval;
+    args.ColliderHalfSizeX = a ? *a : 0.;
+    args.ColliderHalfSizeY = b ? *b : (a ? *a : 0.);
+    args.ColliderIsRect = rect && *rect;
 
     // 执行加载
-    auto ret = assetSystem->CreateAsset<Asset::SpriteSequenceAsset>(currentAssetPool, fullName, args);
+    auto ret = assetSystem->CreateAsset<Asset::SpriteSequenceAssetFactory>(currentAssetPool, fullName, args);
     if (!ret)
         stack.Error("load animation \"%s\" fail: %s", name, ret.GetError().message().c_str());
 }
@@ -375,17 +388,18 @@ void AssetManagerModule::LoadParticle(LuaStack& stack, const char* name, const c
     }
 
     // 构造参数
-    nlohmann::json args {
-        {"path", detail::ResolveAbsoluteOrRelativePath(stack, path)},
-        {"sprite", MakeFullAssetName(AssetTypes::Image, imgName)},
-        {"colliderHalfSizeX", a ? *a : 0.},
-        {"colliderHalfSizeY", b ? *b : (a ? *a : 0.)},
-        {"colliderIsRect", rect && *rect},
-        {"emitDirectionOverride", static_cast<int32_t>(Subsystem::Render::Drawing2D::ParticleEmitDirection::OppositeToEmitter)},  // 兼容
-    };
+    auto resolvedPath = detail::ResolveAbsoluteOrRelativePath(stack, path);
+    auto spriteFullName = MakeFullAssetName(AssetTypes::Image, imgName);
+    Asset::HgeParticleAssetArguments args;
+    args.Path = resolvedPath;
+    args.Sprite = spriteFullName;
+    args.ColliderHalfSizeX = a ? *a : 0.;
+    args.ColliderHalfSizeY = b ? *b : (a ? *a : 0.);
+    args.ColliderIsRect = rect && *rect;
+    args.EmitDirectionOverride = Subsystem::Render::Drawing2D::ParticleEmitDirection::OppositeToEmitter;  // 兼容
 
     // 执行加载
-    auto ret = assetSystem->CreateAsset<Asset::HgeParticleAsset>(currentAssetPool, fullName, args);
+    auto ret = assetSystem->CreateAsset<Asset::HgeParticleAssetFactory>(currentAssetPool, fullName, args);
     if (!ret)
         stack.Error("load particle \"%s\" fail: %s", name, ret.GetError().message().c_str());
 }
@@ -406,13 +420,13 @@ void AssetManagerModule::LoadTexturedFont(LuaStack& stack, const char* name, con
     }
 
     // 构造参数
-    nlohmann::json args {
-        {"path", detail::ResolveAbsoluteOrRelativePath(stack, path)},
-        {"mipmaps", mipmap ? *mipmap : true},
-    };
+    auto resolvedPath = detail::ResolveAbsoluteOrRelativePath(stack, path);
+    Asset::HgeFontAssetArguments args;
+    args.Path = resolvedPath;
+    args.Mipmaps = mipmap ? *mipmap : true;
 
     // 执行加载
-    auto ret = assetSystem->CreateAsset<Asset::HgeFontAsset>(currentAssetPool, fullName, args);
+    auto ret = assetSystem->CreateAsset<Asset::HgeFontAssetFactory>(currentAssetPool, fullName, args);
     if (!ret)
         stack.Error("load textured font \"%s\" fail: %s", name, ret.GetError().message().c_str());
 }
@@ -469,13 +483,13 @@ void AssetManagerModule::LoadTrueTypeFont(LuaStack& stack, const char* name, con
     }
     fontSize = clamp(fontSize, 1u, 100u);  // 限定大小
 
-    nlohmann::json args {
-        {"path", detail::ResolveAbsoluteOrRelativePath(stack, path)},
-        {"size", fontSize},
-    };
+    auto resolvedPath = detail::ResolveAbsoluteOrRelativePath(stack, path);
+    Asset::TrueTypeFontAssetArguments args;
+    args.Path = resolvedPath;
+    args.Size = fontSize;
 
     // 执行加载
-    auto ret = assetSystem->CreateAsset<Asset::TrueTypeFontAsset>(currentAssetPool, fullName, args);
+    auto ret = assetSystem->CreateAsset<Asset::TrueTypeFontAssetFactory>(currentAssetPool, fullName, args);
     if (!ret)
         stack.Error("load ttf font \"%s\" fail: %s", name, ret.GetError().message().c_str());
 }
@@ -501,12 +515,12 @@ void AssetManagerModule::LoadSound(LuaStack& stack, const char* name, const char
     }
 
     // 构造参数
-    nlohmann::json args {
-        {"path", detail::ResolveAbsoluteOrRelativePath(stack, path)},
-    };
+    auto resolvedPath = detail::ResolveAbsoluteOrRelativePath(stack, path);
+    Asset::SoundAssetArguments args;
+    args.Path = resolvedPath;
 
     // 执行加载
-    auto ret = assetSystem->CreateAsset<Asset::SoundAsset>(currentAssetPool, fullName, args);
+    auto ret = assetSystem->CreateAsset<Asset::SoundAssetFactory>(currentAssetPool, fullName, args);
     if (!ret)
         stack.Error("load sound \"%s\" from \"%s\" fail: %s", name, path, ret.GetError().message().c_str());
 }
@@ -528,14 +542,14 @@ void AssetManagerModule::LoadMusic(LuaStack& stack, const char* name, const char
 
     // 构造参数
     double loopStart = std::max(0., end - loop);
-    nlohmann::json args {
-        {"path", detail::ResolveAbsoluteOrRelativePath(stack, path)},
-        {"loopBeginMs", static_cast<uint32_t>(loopStart * 1000)},
-        {"loopEndMs", static_cast<uint32_t>(end * 1000)},
-    };
+    auto resolvedPath = detail::ResolveAbsoluteOrRelativePath(stack, path);
+    Asset::MusicAssetArguments args;
+    args.Path = resolvedPath;
+    args.LoopBeginMs = static_cast<uint32_t>(loopStart * 1000);
+    args.LoopEndMs = static_cast<uint32_t>(end * 1000);
 
     // 执行加载
-    auto ret = assetSystem->CreateAsset<Asset::MusicAsset>(currentAssetPool, fullName, args);
+    auto ret = assetSystem->CreateAsset<Asset::MusicAssetFactory>(currentAssetPool, fullName, args);
     if (!ret)
         stack.Error("load music \"%s\" from \"%s\" fail: %s", name, path, ret.GetError().message().c_str());
 }
@@ -556,16 +570,37 @@ void AssetManagerModule::LoadFX(LuaStack& stack, const char* name, const char* p
     }
 
     // 构造参数
-    nlohmann::json args {
-        {"path", detail::ResolveAbsoluteOrRelativePath(stack, path)},
-    };
+    auto resolvedPath = detail::ResolveAbsoluteOrRelativePath(stack, path);
+    Asset::EffectAssetArguments args;
+    args.Path = resolvedPath;
 
     // 执行加载
-    auto ret = assetSystem->CreateAsset<Asset::EffectAsset>(currentAssetPool, fullName, args);
+    auto ret = assetSystem->CreateAsset<Asset::EffectAssetFactory>(currentAssetPool, fullName, args);
     if (!ret)
         stack.Error("load fx \"%s\" fail: %s", name, ret.GetError().message().c_str());
 }
 
+int32_t AssetManagerModule::LoadBundle(LuaStack& stack, const char* path)
+{
+    GET_CURRENT_POOL;
+
+    auto assetSystem = detail::GetGlobalApp().GetSubsystem<AssetSystem>();
+    assert(assetSystem);
+
+    // 挂载资源束，已经挂载时返回原有对象
+    auto bundle = detail::GetGlobalApp().MountAssetBundle(path, false);
+    if (!bundle)
+        stack.Error("load bundle from \"%s\" fail: %s", path, bundle.GetError().message().c_str());
+
+    // 按照清单创建资产
+    auto ret = v2::CreateAssetsFromBundle(*assetSystem, currentAssetPool, **bundle);
+    if (!ret)
+        stack.Error("load bundle manifest from \"%s\" fail: %s", path, ret.GetError().message().c_str());
+
+    LSTG_LOG_INFO_CAT(AssetManagerModule, "{} asset(s) created from bundle \"{}\"", *ret, path);
+    return static_cast<int32_t>(*ret);
+}
+
 void AssetManagerModule::CreateRenderTarget(LuaStack& stack, const char* name)
 {
     GET_CURRENT_POOL;
@@ -581,10 +616,12 @@ void AssetManagerModule::CreateRenderTarget(LuaStack& stack, const char* name)
         return;
     }
 
+    // 构造参数
+    Asset::TextureAssetArguments args;
+    args.RenderTarget = true;
+
     // 执行加载
-    auto ret = assetSystem->CreateAsset<Asset::TextureAsset>(currentAssetPool, fullName, nlohmann::json {
-        {"rt", true},
-    });
+    auto ret = assetSystem->CreateAsset<Asset::TextureAssetFactory>(currentAssetPool, fullName, args);
     if (!ret)
         stack.Error("create render target fail: %s", ret.GetError().message().c_str());
 }
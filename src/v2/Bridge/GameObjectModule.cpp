@@ -67,6 +67,18 @@ void GameObjectModule::SetBound(double left, double right, double bottom, double
     world.SetBoundary({left, top, std::abs(right - left), std::abs(top - bottom)});
 }
 
+void GameObjectModule::SetParallelRender(bool enabled)
+{
+    auto& world = detail::GetGlobalApp().GetDefaultWorld();
+    world.SetParallelRenderEnabled(enabled);
+}
+
+void GameObjectModule::SetObjectTableRecycle(LuaStack& stack, bool enabled)
+{
+    auto& world = detail::GetGlobalApp().GetDefaultWorld();
+    world.GetScriptObjectPool().SetTableRecyclingEnabled(stack, enabled);
+}
+
 void GameObjectModule::BoundCheck(LuaStack& stack)
 {
     auto& world = detail::GetGlobalApp().GetDefaultWorld();
@@ -593,6 +605,92 @@ GameObjectModule::Unpack<GameObjectModule::AbsIndex, int32_t, double> GameObject
     return { AbsIndex {stack.GetTop()}, groupId, firstObjectId };  // 返回组ID，第一个对象ID
 }
 
+int32_t GameObjectModule::QueryObjects(int32_t groupId, std::optional<double> layerMin, std::optional<double> layerMax)
+{
+    GameWorld::EntityQuery query;
+    if (groupId >= 0 && groupId < static_cast<int32_t>(Components::kColliderGroupCount))
+        query.Group = static_cast<uint32_t>(groupId);
+    query.LayerMin = layerMin;
+    query.LayerMax = layerMax;
+
+    auto& world = detail::GetGlobalApp().GetDefaultWorld();
+    return static_cast<int32_t>(world.QueryEntities(query));
+}
+
+int32_t GameObjectModule::QueryObjectsInRect(int32_t groupId, double left, double right, double bottom, double top,
+    std::optional<double> layerMin, std::optional<double> layerMax)
+{
+    GameWorld::EntityQuery query;
+    if (groupId >= 0 && groupId < static_cast<int32_t>(Components::kColliderGroupCount))
+        query.Group = static_cast<uint32_t>(groupId);
+    query.LayerMin = layerMin;
+    query.LayerMax = layerMax;
+    query.RegionType = GameWorld::QueryRegionTypes::Rectangle;
+    query.Rectangle = { std::min(left, right), std::max(top, bottom), std::abs(right - left), std::abs(top - bottom) };
+
+    auto& world = detail::GetGlobalApp().GetDefaultWorld();
+    return static_cast<int32_t>(world.QueryEntities(query));
+}
+
+int32_t GameObjectModule::QueryObjectsInCircle(int32_t groupId, double x, double y, double radius, std::optional<double> layerMin,
+    std::optional<double> layerMax)
+{
+    GameWorld::EntityQuery query;
+    if (groupId >= 0 && groupId < static_cast<int32_t>(Components::kColliderGroupCount))
+        query.Group = static_cast<uint32_t>(groupId);
+    query.LayerMin = layerMin;
+    query.LayerMax = layerMax;
+    query.RegionType = GameWorld::QueryRegionTypes::Circle;
+    query.Center = { x, y };
+    query.Radius = std::max(0., radius);
+
+    auto& world = detail::GetGlobalApp().GetDefaultWorld();
+    return static_cast<int32_t>(world.QueryEntities(query));
+}
+
+GameObjectModule::AbsIndex GameObjectModule::GetBatchObjects(LuaStack& stack)
+{
+    auto& world = detail::GetGlobalApp().GetDefaultWorld();
+    world.PushQueryResult(stack);
+    return AbsIndex { stack.GetTop() };
+}
+
+void GameObjectModule::BatchSetVelocity(double velocity, double angle, std::optional<bool> track)
+{
+    angle = glm::radians(angle);
+    Vec2 v { velocity * ::cos(angle), velocity * ::sin(angle) };
+
+    auto& world = detail::GetGlobalApp().GetDefaultWorld();
+    world.BatchSetVelocity(v, (track && *track) ? std::optional<double> { angle } : std::nullopt);
+}
+
+void GameObjectModule::BatchApplyImpulse(double x, double y, double strength, std::optional<double> radius)
+{
+    auto& world = detail::GetGlobalApp().GetDefaultWorld();
+    world.BatchApplyRadialImpulse({ x, y }, strength, radius ? *radius : 0.);
+}
+
+void GameObjectModule::BatchSetGroup(LuaStack& stack, int32_t groupId)
+{
+    if (groupId < 0 || groupId >= static_cast<int32_t>(Components::kColliderGroupCount))
+        stack.Error("Invalid group id");
+
+    auto& world = detail::GetGlobalApp().GetDefaultWorld();
+    world.BatchSetGroup(static_cast<uint32_t>(groupId));
+}
+
+int32_t GameObjectModule::BatchDelete(LuaStack& stack, std::optional<bool> callback)
+{
+    auto& world = detail::GetGlobalApp().GetDefaultWorld();
+    return static_cast<int32_t>(world.BatchDelete(stack, callback.value_or(true)));
+}
+
+int32_t GameObjectModule::BatchKill(LuaStack& stack, std::optional<bool> callback)
+{
+    auto& world = detail::GetGlobalApp().GetDefaultWorld();
+    return static_cast<int32_t>(world.BatchKill(stack, callback.value_or(true)));
+}
+
 int GameObjectModule::GetObjectAttribute(lua_State* L)
 {
     auto& world = detail::GetGlobalApp().GetDefaultWorld();
@@ -52,6 +52,40 @@ bool LSTGBentLaserData::BoundCheck() const
     return m_stImplementation.BoundCheck();
 }
 
+void LSTGBentLaserData::Bind(LuaStack& stack, AbsIndex baseObject, int32_t length, uint32_t width)
+{
+    assert(baseObject == 2);
+
+    // 检查参数
+    if (stack.TypeOf(baseObject) != LUA_TTABLE)
+        stack.Error("invalid argument #1, luastg object required for 'Bind'.");
+    stack.RawGet(baseObject, GamePlay::kIndexOfScriptObjectIdInObject);  // t(object) ... n(id)
+    auto id = static_cast<GamePlay::ScriptObjectId>(luaL_checkinteger(stack, -1));
+    stack.Pop(1);  // t(object) ...
+
+    if (!m_stImplementation.Bind(id, length, width))
+        stack.Error("invalid lstg object for 'Bind'.");
+}
+
+void LSTGBentLaserData::Unbind()
+{
+    m_stImplementation.Unbind();
+}
+
+bool LSTGBentLaserData::IsBound() const
+{
+    return m_stImplementation.IsBound();
+}
+
+void LSTGBentLaserData::SetRenderState(const char* texture, const char* blend, LSTGColor* color, double texLeft, double texTop,
+    double texWidth, double texHeight, std::optional<double> scale /* =1 */)
+{
+    Math::UVRectangle rect {
+        static_cast<float>(texLeft), static_cast<float>(texTop), static_cast<float>(texWidth), static_cast<float>(texHeight)
+    };
+    m_stImplementation.SetRenderState(texture, v2::BlendMode(blend), *color, rect, scale ? *scale : 1.);
+}
+
 std::string LSTGBentLaserData::ToString() const
 {
     return "lstgBentLaserData";
@@ -6,6 +6,8 @@
  */
 #include <lstg/v2/Bridge/LSTGColor.hpp>
 
+#include <lstg/v2/Bridge/ValueTypes.hpp>
+
 using namespace std;
 using namespace lstg;
 using namespace lstg::v2::Bridge;
@@ -59,3 +61,50 @@ std::string LSTGColor::ToString() const
 }
 
 // </editor-fold>
+// <editor-fold desc="LuaRead">
+
+int lstg::v2::Bridge::LuaRead(Subsystem::Script::LuaStack& stack, int idx, Result<LSTGColor*>& out)
+{
+    auto c = ReadFFIColor(stack, idx);
+    if (c)
+    {
+        out = c;
+        return 1;
+    }
+    return Subsystem::Script::LuaRead<LSTGColor>(stack, idx, out);
+}
+
+int lstg::v2::Bridge::LuaRead(Subsystem::Script::LuaStack& stack, int idx, Result<const LSTGColor*>& out)
+{
+    auto c = ReadFFIColor(stack, idx);
+    if (c)
+    {
+        out = c;
+        return 1;
+    }
+    return Subsystem::Script::LuaRead<const LSTGColor>(stack, idx, out);
+}
+
+int lstg::v2::Bridge::LuaRead(Subsystem::Script::LuaStack& stack, int idx, LSTGColor*& out)
+{
+    auto c = ReadFFIColor(stack, idx);
+    if (c)
+    {
+        out = c;
+        return 1;
+    }
+    return Subsystem::Script::LuaRead<LSTGColor>(stack, idx, out);
+}
+
+int lstg::v2::Bridge::LuaRead(Subsystem::Script::LuaStack& stack, int idx, const LSTGColor*& out)
+{
+    auto c = ReadFFIColor(stack, idx);
+    if (c)
+    {
+        out = c;
+        return 1;
+    }
+    return Subsystem::Script::LuaRead<const LSTGColor>(stack, idx, out);
+}
+
+// </editor-fold>
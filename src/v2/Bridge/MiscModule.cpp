@@ -9,6 +9,7 @@
 #include <lstg/Core/Logging.hpp>
 #include <lstg/Core/Subsystem/RenderSystem.hpp>
 #include <lstg/Core/Subsystem/VirtualFileSystem.hpp>
+#include <lstg/Core/Subsystem/VFS/ContainerStream.hpp>
 #include "detail/Helper.hpp"
 
 using namespace std;
@@ -40,24 +41,28 @@ void MiscModule::CaptureSnapshot(const char* path)
             return;
         }
 
-        // 打开数据流
-        auto& app = detail::GetGlobalApp();
-        auto& vfs = *app.GetSubsystem<Subsystem::VirtualFileSystem>();
-        auto stream = vfs.OpenFile(savePath.ToStringView(), Subsystem::VFS::FileAccessMode::Write, Subsystem::VFS::FileOpenFlags::Truncate);
-        if (!stream)
+        // 在内存中编码，避免在渲染线程回调中阻塞于磁盘写入
+        auto texData = *data;
+        assert(texData);
+        Subsystem::VFS::MemoryStream stream;
+        auto ret = Subsystem::Render::SaveToPng(&stream, texData);
+        if (!ret)
         {
-            LSTG_LOG_ERROR_CAT(MiscModule, "Open screenshot file '{}' fail: {}", savePath.ToStringView(), stream.GetError());
+            LSTG_LOG_ERROR_CAT(MiscModule, "Encode screenshot fail: {}", ret.GetError());
             return;
         }
 
-        // 写出截图
-        auto texData = *data;
-        assert(texData);
-        auto ret = Subsystem::Render::SaveToPng(stream->get(), texData);
+        // 异步写出截图
+        auto& app = detail::GetGlobalApp();
+        auto& vfs = *app.GetSubsystem<Subsystem::VirtualFileSystem>();
+        ret = vfs.WriteFileAsync(savePath.ToStringView(), std::move(stream.GetContainer()), [savePath](std::error_code ec) {
+            if (ec)
+                LSTG_LOG_ERROR_CAT(MiscModule, "Write screenshot '{}' fail: {}", savePath.ToStringView(), ec);
+            else
+                LSTG_LOG_INFO_CAT(MiscModule, "Screenshot save to '{}'", savePath.ToStringView());
+        });
         if (!ret)
-            LSTG_LOG_ERROR_CAT(MiscModule, "Write screenshot fail: {}", ret.GetError());
-        else
-            LSTG_LOG_INFO_CAT(MiscModule, "Screenshot save to '{}'", savePath.ToStringView());
+            LSTG_LOG_ERROR_CAT(MiscModule, "Write screenshot '{}' fail: {}", savePath.ToStringView(), ret.GetError());
     });
 }
 
@@ -104,3 +109,45 @@ LSTGBentLaserData MiscModule::NewBentLaserData()
 {
     return {};
 }
+
+int32_t MiscModule::BentLaserUpdateAll()
+{
+    return static_cast<int32_t>(GamePlay::BentLaser::UpdateAll());
+}
+
+void MiscModule::BentLaserRenderAll(Subsystem::Script::LuaStack& stack)
+{
+    if (!GamePlay::BentLaser::RenderAll())
+        stack.Error("can't render bent lasers.");
+}
+
+Subsystem::Script::LuaStack::AbsIndex MiscModule::BentLaserCollisionCheck(Subsystem::Script::LuaStack& stack,
+    Subsystem::Script::LuaStack::AbsIndex object)
+{
+    assert(object == 1);
+
+    // 检查参数
+    if (stack.TypeOf(object) != LUA_TTABLE)
+        stack.Error("invalid argument #1, luastg object required for 'BentLaserCollisionCheck'.");
+    stack.RawGet(object, GamePlay::kIndexOfScriptObjectIdInObject);  // t(object) ... n(id)
+    auto id = static_cast<GamePlay::ScriptObjectId>(luaL_checkinteger(stack, -1));
+    stack.Pop(1);  // t(object) ...
+
+    auto& world = detail::GetGlobalApp().GetDefaultWorld();
+    auto entity = world.GetEntityByScriptObjectId(id);
+    if (!entity)
+        stack.Error("invalid argument #1, invalid luastg object.");
+
+    // 结果缓冲区跨调用复用，只在主线程访问
+    static vector<GamePlay::ScriptObjectId> kHits;
+    kHits.clear();
+    GamePlay::BentLaser::CollisionCheckAll(*entity, kHits);
+
+    lua_createtable(stack, static_cast<int>(kHits.size()), 0);  // t
+    for (size_t i = 0; i < kHits.size(); ++i)
+    {
+        world.GetScriptObjectPool().PushScriptObject(stack, kHits[i]);  // t o
+        lua_rawseti(stack, -2, static_cast<int>(i + 1));  // t
+    }
+    return Subsystem::Script::LuaStack::AbsIndex { stack.GetTop() };
+}
@@ -561,20 +561,18 @@ namespace
                     if (!ret)
                         stack.Error("Set texture '%s' error: %s", key, ret.GetError().message().c_str());
                 }
-                else if (lua_isuserdata(stack, -1))  // 颜色类视作 uint32_t
+                else  // 颜色类视作 uint32_t
                 {
-                    auto c = stack.ReadValue<LSTGColor*>(-1);
-                    if (!c)
-                        stack.Error("unexpected userdata, LSTGColor expected at argument '%s'", key);
+                    // 经由 LuaRead 读取，同时接受 userdata 与 FFI 实现的颜色
+                    Result<LSTGColor*> c { nullptr };
+                    stack.ReadValue(-1, c);
+                    if (!c || !*c)
+                        stack.Error("invalid data type at argument '%s'", key);
 
-                    auto ret = mat->SetUniform<uint32_t>(key, c->rgba32());
+                    auto ret = mat->SetUniform<uint32_t>(key, (*c)->rgba32());
                     if (!ret)
                         stack.Error("Set uniform '%s' error: %s", key, ret.GetError().message().c_str());
                 }
-                else
-                {
-                    stack.Error("invalid data type at argument '%s'", key);
-                }
 
                 lua_pop(stack, 1);  // s s s t ... nil key
             }
@@ -179,3 +179,36 @@ void SystemModule::ShowSplashWindow(std::optional<std::string_view> path)
 {
     LSTG_LOG_DEPRECATED(SystemModule, ShowSplashWindow);
 }
+
+void SystemModule::SuspendGarbageCollection()
+{
+    GetApp().GetSubsystem<ScriptSystem>()->SuspendGarbageCollection();
+}
+
+void SystemModule::ResumeGarbageCollection(LuaStack& stack)
+{
+    auto scriptSystem = GetApp().GetSubsystem<ScriptSystem>();
+    if (!scriptSystem->IsGarbageCollectionSuspended())
+        stack.Error("GC is not suspended");
+    scriptSystem->ResumeGarbageCollection();
+}
+
+void SystemModule::SetGarbageCollectionBudget(double ratio, double minTime, double maxTime)
+{
+    GetApp().GetSubsystem<ScriptSystem>()->SetGarbageCollectionBudget(ratio, minTime, maxTime);
+}
+
+void SystemModule::ScheduleCoroutine(LuaStack& stack, AbsIndex co, int32_t frames)
+{
+    if (stack.TypeOf(co) != LUA_TTHREAD)
+        stack.Error("invalid argument #1, coroutine required");
+
+    auto ret = GetApp().GetSubsystem<ScriptSystem>()->GetCoroutineScheduler().Schedule(stack, co.Index,
+        static_cast<uint32_t>(std::max(frames, 1)));
+    stack.ThrowIfError(ret);
+}
+
+bool SystemModule::CancelCoroutine(LuaStack& stack, AbsIndex co)
+{
+    return GetApp().GetSubsystem<ScriptSystem>()->GetCoroutineScheduler().Cancel(stack, co.Index);
+}
@@ -0,0 +1,323 @@
+/**
+ * @file
+ * @date 2022/10/2
+ * @author 9chu
+ * 此文件为 LuaSTGPlus 项目的一部分，版权与许可声明详见 COPYRIGHT.txt。
+ */
+#include <lstg/v2/Bridge/ValueTypes.hpp>
+
+#include <cstring>
+#include <lstg/Core/Logging.hpp>
+
+using namespace std;
+using namespace lstg;
+using namespace lstg::v2::Bridge;
+
+LSTG_DEF_LOG_CATEGORY(ValueTypes);
+
+namespace
+{
+    const char* kColorCTypeKey = "__lstg_ColorCType";
+    const char* kIsTypeKey = "__lstg_ffi_istype";
+
+#ifdef LSTG_LUAJIT_FFI
+    const int kLuaTypeCData = 10;  // LUA_TCDATA，lua.h 中没有导出
+
+    /**
+     * ctype id 相对 cdata 数据区的可能偏移
+     * LuaJIT 的 GCcdata 头部以 uint16_t ctypeid 结尾，数据区紧随其后：32 位 GC 引用时偏移为 2，GC64 时因对齐偏移为 6。
+     * 实际偏移由 InitValueTypes 用已知类型的样本验证，验证失败时退回 ffi.istype。
+     */
+    const ptrdiff_t kCTypeIdOffsets[] = { 2, 6 };
+
+    /**
+     * 颜色类型的 ctype id 及其偏移，为 0 时表示未能确定
+     * 值类型只注册在主虚拟机上，ctype id 在 FFI 初始化后保持不变。
+     */
+    uint16_t s_uColorCTypeId = 0;
+    ptrdiff_t s_iCTypeIdOffset = 0;
+
+    uint16_t ReadCTypeId(const void* data, ptrdiff_t offset) noexcept
+    {
+        uint16_t ret = 0;
+        ::memcpy(&ret, static_cast<const uint8_t*>(data) - offset, sizeof(ret));
+        return ret;
+    }
+
+    /**
+     * 确定 ctype id 的偏移
+     * 栈上依次为：颜色 ctype id, 颜色样本, Vec2 ctype id, Vec2 样本
+     */
+    void ProbeCTypeIdOffset(Subsystem::Script::LuaStack& stack) noexcept
+    {
+        s_uColorCTypeId = 0;
+        s_iCTypeIdOffset = 0;
+        if (lua_type(stack, -3) != kLuaTypeCData || lua_type(stack, -1) != kLuaTypeCData)
+            return;
+
+        auto colorId = static_cast<uint16_t>(lua_tointeger(stack, -4));
+        auto colorData = lua_topointer(stack, -3);
+        auto vec2Id = static_cast<uint16_t>(lua_tointeger(stack, -2));
+        auto vec2Data = lua_topointer(stack, -1);
+        for (auto offset : kCTypeIdOffsets)
+        {
+            if (ReadCTypeId(colorData, offset) == colorId && ReadCTypeId(vec2Data, offset) == vec2Id)
+            {
+                s_uColorCTypeId = colorId;
+                s_iCTypeIdOffset = offset;
+                return;
+            }
+        }
+        LSTG_LOG_WARN_CAT(ValueTypes, "Unrecognized cdata layout, fallback to ffi.istype");
+    }
+#endif
+
+    // lstg_Color 与 LSTGColor 共享内存布局
+    static_assert(sizeof(LSTGColor) == 4);
+
+    /**
+     * 值类型实现
+     * 参数：ffi 模块（可能为 nil）, lstg 表
+     * 返回：颜色 ctype, ffi.istype, 颜色 ctype id, 颜色样本, Vec2 ctype id, Vec2 样本（未启用 FFI 时均为 nil）
+     */
+    const char* kValueTypesSource = R"lua(
+        local ffi, lstg = ...
+
+        local type, select, tonumber, error, setmetatable, getmetatable = type, select, tonumber, error, setmetatable, getmetatable
+        local floor, sqrt, atan2, deg = math.floor, math.sqrt, math.atan2, math.deg
+        local format = string.format
+        local istype = ffi and ffi.istype
+
+        -- <editor-fold desc="Vec2">
+
+        -- ffi.metatype 之后元表不能再修改，因此先填充元表再创建类型
+        local Vec2Methods = {}
+        local Vec2MetaTable = { __index = Vec2Methods }
+        local Vec2, IsVec2, Vec2Type
+
+        function Vec2Methods.Length(v)
+            return sqrt(v.x * v.x + v.y * v.y)
+        end
+
+        function Vec2Methods.Angle(v)
+            return deg(atan2(v.y, v.x))
+        end
+
+        function Vec2Methods.Dot(lhs, rhs)
+            return lhs.x * rhs.x + lhs.y * rhs.y
+        end
+
+        function Vec2Methods.Normalized(v)
+            local l = sqrt(v.x * v.x + v.y * v.y)
+            if l == 0 then
+                return Vec2(0, 0)
+            end
+            return Vec2(v.x / l, v.y / l)
+        end
+
+        function Vec2MetaTable.__eq(lhs, rhs)
+            -- cdata 与任意值比较时都会进入 __eq
+            return IsVec2(lhs) and IsVec2(rhs) and lhs.x == rhs.x and lhs.y == rhs.y
+        end
+
+        function Vec2MetaTable.__add(lhs, rhs)
+            return Vec2(lhs.x + rhs.x, lhs.y + rhs.y)
+        end
+
+        function Vec2MetaTable.__sub(lhs, rhs)
+            return Vec2(lhs.x - rhs.x, lhs.y - rhs.y)
+        end
+
+        function Vec2MetaTable.__mul(lhs, rhs)
+            if type(lhs) == "number" then
+                return Vec2(lhs * rhs.x, lhs * rhs.y)
+            elseif type(rhs) == "number" then
+                return Vec2(lhs.x * rhs, lhs.y * rhs)
+            end
+            return Vec2(lhs.x * rhs.x, lhs.y * rhs.y)
+        end
+
+        function Vec2MetaTable.__div(lhs, rhs)
+            return Vec2(lhs.x / rhs, lhs.y / rhs)
+        end
+
+        function Vec2MetaTable.__unm(v)
+            return Vec2(-v.x, -v.y)
+        end
+
+        function Vec2MetaTable.__tostring(v)
+            return format("lstg.Vec2(%g,%g)", v.x, v.y)
+        end
+
+        if ffi then
+            ffi.cdef "typedef struct { double x, y; } lstg_Vec2;"
+            Vec2Type = ffi.metatype("lstg_Vec2", Vec2MetaTable)
+            Vec2 = function(x, y)
+                return Vec2Type(x or 0, y or 0)
+            end
+            IsVec2 = function(v)
+                return istype(Vec2Type, v)
+            end
+        else
+            Vec2 = function(x, y)
+                return setmetatable({ x = x or 0, y = y or 0 }, Vec2MetaTable)
+            end
+            IsVec2 = function(v)
+                return getmetatable(v) == Vec2MetaTable
+            end
+        end
+        lstg.Vec2 = Vec2
+
+        -- </editor-fold>
+        -- <editor-fold desc="Color">
+
+        if not ffi then
+            return  -- 保持 userdata 实现
+        end
+
+        local band, rshift = bit.band, bit.rshift
+        local ColorMethods = {}
+        local ColorMetaTable = { __index = ColorMethods }
+        local ColorType
+
+        -- 与 ColorRGBA32 的运算保持一致：先限制范围，写入 uint8_t 时截断
+        local function Clamp(v)
+            if v < 0 then
+                return 0
+            elseif v > 255 then
+                return 255
+            end
+            return v
+        end
+
+        local function CheckNumber(v, i)
+            local n = tonumber(v)
+            if not n then
+                error(format("bad argument #%d to 'Color' (number expected, got %s)", i, type(v)), 3)
+            end
+            return n
+        end
+
+        local function Color(...)
+            if select("#", ...) == 1 then
+                local argb = floor(CheckNumber(..., 1))
+                return ColorType(band(rshift(argb, 16), 0xFF), band(rshift(argb, 8), 0xFF), band(argb, 0xFF), rshift(argb, 24))
+            end
+            local a, r, g, b = ...
+            a, r, g, b = CheckNumber(a, 1), CheckNumber(r, 2), CheckNumber(g, 3), CheckNumber(b, 4)
+            return ColorType(Clamp(floor(r)), Clamp(floor(g)), Clamp(floor(b)), Clamp(floor(a)))
+        end
+
+        function ColorMethods.ARGB(c)
+            return c.a, c.r, c.g, c.b
+        end
+
+        function ColorMetaTable.__eq(lhs, rhs)
+            return istype(ColorType, lhs) and istype(ColorType, rhs) and lhs.r == rhs.r and lhs.g == rhs.g and
+                lhs.b == rhs.b and lhs.a == rhs.a
+        end
+
+        function ColorMetaTable.__add(lhs, rhs)
+            return ColorType(Clamp(lhs.r + rhs.r), Clamp(lhs.g + rhs.g), Clamp(lhs.b + rhs.b), Clamp(lhs.a + rhs.a))
+        end
+
+        function ColorMetaTable.__sub(lhs, rhs)
+            return ColorType(Clamp(lhs.r - rhs.r), Clamp(lhs.g - rhs.g), Clamp(lhs.b - rhs.b), Clamp(lhs.a - rhs.a))
+        end
+
+        function ColorMetaTable.__mul(lhs, rhs)
+            if type(lhs) == "number" then
+                return ColorType(Clamp(lhs * rhs.r), Clamp(lhs * rhs.g), Clamp(lhs * rhs.b), Clamp(lhs * rhs.a))
+            elseif type(rhs) == "number" then
+                return ColorType(Clamp(lhs.r * rhs), Clamp(lhs.g * rhs), Clamp(lhs.b * rhs), Clamp(lhs.a * rhs))
+            end
+            return ColorType(Clamp(lhs.r * (rhs.r / 255)), Clamp(lhs.g * (rhs.g / 255)), Clamp(lhs.b * (rhs.b / 255)),
+                Clamp(lhs.a * (rhs.a / 255)))
+        end
+
+        function ColorMetaTable.__tostring(c)
+            return format("lstg.Color(%d,%d,%d,%d)", c.a, c.r, c.g, c.b)
+        end
+
+        ffi.cdef "typedef struct { uint8_t r, g, b, a; } lstg_Color;"
+        ColorType = ffi.metatype("lstg_Color", ColorMetaTable)
+        lstg.Color = Color
+
+        -- </editor-fold>
+
+        -- ctype id 与样本供原生代码确定 cdata 布局
+        return ColorType, istype, tonumber(ColorType), ColorType(), tonumber(Vec2Type), Vec2Type()
+    )lua";
+}
+
+Result<void> lstg::v2::Bridge::InitValueTypes(Subsystem::ScriptSystem& scriptSystem) noexcept
+{
+    auto& state = scriptSystem.GetState();
+    Subsystem::Script::LuaStack::BalanceChecker stackChecker(state);
+
+    auto ret = state.LoadBuffer({ reinterpret_cast<const uint8_t*>(kValueTypesSource), ::strlen(kValueTypesSource) },
+        "=(value types)");
+    if (!ret)
+    {
+        LSTG_LOG_ERROR_CAT(ValueTypes, "Compile value types fail: {}", lua_tostring(state, -1));
+        lua_pop(state, 1);
+        return ret.GetError();
+    }
+
+    if (!scriptSystem.PushFFIModule())
+        lua_pushnil(state);
+    lua_getglobal(state, "lstg");
+    assert(lua_istable(state, -1));
+
+    ret = state.ProtectedCallWithTraceback(2, 6);  // ctype istype colorId color vec2Id vec2
+    if (!ret)
+    {
+        LSTG_LOG_ERROR_CAT(ValueTypes, "Initialize value types fail: {}", lua_tostring(state, -1));
+        lua_pop(state, 1);
+        return ret.GetError();
+    }
+#ifdef LSTG_LUAJIT_FFI
+    ProbeCTypeIdOffset(state);
+#endif
+    lua_pop(state, 4);  // ctype istype
+    lua_setfield(state, LUA_REGISTRYINDEX, kIsTypeKey);
+    lua_setfield(state, LUA_REGISTRYINDEX, kColorCTypeKey);
+    return {};
+}
+
+LSTGColor* lstg::v2::Bridge::ReadFFIColor(Subsystem::Script::LuaStack& stack, int idx)
+{
+#ifdef LSTG_LUAJIT_FFI
+    if (lua_type(stack, idx) != kLuaTypeCData)
+        return nullptr;
+
+    // 直接比较 cdata 头部的 ctype id，避免每次读取都调用 ffi.istype
+    if (s_iCTypeIdOffset != 0)
+    {
+        auto data = lua_topointer(stack, idx);
+        return ReadCTypeId(data, s_iCTypeIdOffset) == s_uColorCTypeId ? static_cast<LSTGColor*>(const_cast<void*>(data)) : nullptr;
+    }
+
+    if (idx < 0 && idx > LUA_REGISTRYINDEX)
+        idx = lua_gettop(stack) + idx + 1;
+
+    lua_getfield(stack, LUA_REGISTRYINDEX, kIsTypeKey);  // f|n
+    if (!lua_isfunction(stack, -1))
+    {
+        lua_pop(stack, 1);
+        return nullptr;
+    }
+    lua_getfield(stack, LUA_REGISTRYINDEX, kColorCTypeKey);  // f ct
+    lua_pushvalue(stack, idx);  // f ct v
+    lua_call(stack, 2, 1);  // b
+    auto match = lua_toboolean(stack, -1);
+    lua_pop(stack, 1);
+
+    // lua_topointer 对 cdata 返回数据区的地址
+    return match ? static_cast<LSTGColor*>(const_cast<void*>(lua_topointer(stack, idx))) : nullptr;
+#else
+    static_cast<void>(stack);
+    static_cast<void>(idx);
+    return nullptr;
+#endif
+}
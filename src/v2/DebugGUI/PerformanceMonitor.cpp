@@ -42,9 +42,18 @@ PerformanceMonitor::PerformanceMonitor()
     AddInstrument("Draw", "Primitives", "Primitive", "Draw_PrimitiveCount");
     AddInstrument("Draw", "Draw Calls", "Count", "Draw_DrawCallCount");
 
+    // RenderSystem.cpp
+    AddInstrument("RenderSystem", "Render Target Pool (KB)", "Pooled", "RenderSystem_RTPoolPooled");
+    AddInstrument("RenderSystem", "Render Target Pool (KB)", "InUse", "RenderSystem_RTPoolInUse");
+    AddInstrument("RenderSystem", "Render Target Pool (KB)", "Peak", "RenderSystem_RTPoolPeak");
+    AddInstrument("RenderSystem", "Render Target Allocation", "Created", "RenderSystem_RTPoolCreated");
+    AddInstrument("RenderSystem", "Render Target Allocation", "Reused", "RenderSystem_RTPoolReused");
+    AddInstrument("RenderSystem", "Render Target Allocation", "Released", "RenderSystem_RTPoolReleased");
+
     // ScriptSystem.cpp
     AddInstrument("ScriptSystem", "VM Memory Usage (KB)", "Usage", "ScriptSystem_VMHeapSize");
-    AddInstrument("ScriptSystem", "GC Time", "Aggressive GC", "ScriptSystem_AggressiveGC");
+    AddInstrument("ScriptSystem", "GC Time", "Step", "ScriptSystem_GCTime");
+    AddInstrument("ScriptSystem", "GC Time", "Budget", "ScriptSystem_GCBudget");
 
     // AssetSystem.cpp
     AddInstrument("AssetSystem", "Loading Task", "Update", "AssetTask_Update");
@@ -53,6 +62,11 @@ PerformanceMonitor::PerformanceMonitor()
     AddInstrument("AssetSystem", "Loading Task", "WatchTasks", "AssetTask_WatchTasks");
     AddInstrument("AssetSystem", "Loading Task", "PrepareToReload", "AssetTask_PrepareToReload");
     AddInstrument("AssetSystem", "Loading Task", "ThreadUpdate", "AssetTask_ThreadUpadte");
+    AddInstrument("AssetSystem", "Loading Task", "TextureUpload", "AssetTask_TextureUpload");
+
+    // VirtualFileSystem.cpp
+    AddInstrument("VirtualFileSystem", "Block Cache Hit Rate (%)", "HitRate", "VirtualFileSystem_BlockCacheHitRate");
+    AddInstrument("VirtualFileSystem", "Block Cache Usage (KB)", "Usage", "VirtualFileSystem_BlockCacheUsage");
 
     if (!m_stGroupSelects.empty())
         m_stCurrentSelectedGroup = m_stGroupSelects[0];
@@ -21,6 +21,7 @@
 #include <lstg/Core/Subsystem/DebugGUI/MiniStatusWindow.hpp>
 #include <lstg/Core/Subsystem/DebugGUI/ConsoleWindow.hpp>
 #include <lstg/Core/Subsystem/VFS/FileStream.hpp>
+#include <lstg/Core/Subsystem/VFS/MemoryMappedFile.hpp>
 #include <lstg/Core/Subsystem/VFS/LocalFileSystem.hpp>
 #include <lstg/Core/Subsystem/VFS/ZipArchiveFileSystem.hpp>
 #include <lstg/Core/Subsystem/VFS/AndroidAssetFileSystem.hpp>
@@ -44,6 +45,7 @@
 
 // 脚本桥
 #include <lstg/v2/Bridge/BuiltInModules.hpp>
+#include <lstg/v2/Bridge/ValueTypes.hpp>
 
 using namespace std;
 using namespace lstg;
@@ -239,6 +241,11 @@ GameApp::GameApp(int argc, const char* argv[])
         // 设置默认工作路径
         scriptSystem.SetIoWorkingDirectory("/storage");
 
+        // 字节码缓存放在用户目录下，失败时仅禁用缓存
+        auto bytecodeCacheRet = scriptSystem.GetSandBox().GetBytecodeCache().SetCacheDirectory("/storage/.bytecode");
+        if (!bytecodeCacheRet)
+            LSTG_LOG_WARN_CAT(GameApp, "Bytecode cache disabled: {}", bytecodeCacheRet.GetError());
+
         // 打开默认函数库
         Subsystem::Script::LuaStack::BalanceChecker stackChecker(state);
 
@@ -251,6 +258,11 @@ GameApp::GameApp(int argc, const char* argv[])
         // 调用自动生成的注册方法
         Bridge::InitBuiltInModule(state);
 
+        // 注册值类型，启用 FFI 时会替换 lstg.Color
+        auto valueTypesRet = Bridge::InitValueTypes(scriptSystem);
+        if (!valueTypesRet)
+            LSTG_LOG_ERROR_CAT(GameApp, "Fail to initialize value types: {}", valueTypesRet.GetError());
+
         // 设置命令行参数
         lua_getglobal(state, "lstg");  // t(lstg)
         assert(lua_istable(state, -1));
@@ -295,55 +307,22 @@ Result<void> GameApp::MountAssetPack(std::string_view path, std::optional<std::s
         return make_error_code(errc::invalid_argument);
 
     // 检查是否已经加载
-    for (size_t i = 0; i < m_pAssetsFileSystem->GetFileSystemCount(); ++i)
+    if (FindMountedAssetPack(path))
     {
-        auto fs = m_pAssetsFileSystem->GetFileSystem(i);
-        assert(fs);
-        if (fs->GetUserData() == path)
-        {
-            LSTG_LOG_WARN_CAT(GameApp, "Asset pack is already loaded, path={}", path);
-            return {};
-        }
+        LSTG_LOG_WARN_CAT(GameApp, "Asset pack is already loaded, path={}", path);
+        return {};
     }
 
     // 创建 ZipArchiveFileSystem
     try
     {
-        Subsystem::VFS::StreamPtr packageStream;
+        auto packageStream = OpenAssetPackStream(path, vfsBypass);
+        if (!packageStream)
+            return packageStream.GetError();
 
-        if (vfsBypass)
-        {
-            try
-            {
-                auto fsStream = make_shared<Subsystem::VFS::FileStream>(path, Subsystem::VFS::FileAccessMode::Read,
-                    Subsystem::VFS::FileOpenFlags::None);
-                packageStream = std::move(fsStream);
-            }
-            catch (const std::system_error& ex)
-            {
-                LSTG_LOG_ERROR_CAT(GameApp, "Open asset pack from \"{}\" fail: {}", path, ex.code());
-                return ex.code();
-            }
-            catch (...)
-            {
-                LSTG_LOG_ERROR_CAT(GameApp, "Open asset pack from \"{}\" fail: <unknown>", path);
-                return make_error_code(errc::io_error);
-            }
-        }
-        else
-        {
-            // 尝试加载流
-            auto fullPath = fmt::format("{}/{}", GetSubsystem<Subsystem::VirtualFileSystem>()->GetAssetBaseDirectory(), path);
-            auto stream = GetSubsystem<Subsystem::VirtualFileSystem>()->OpenFile(fullPath, Subsystem::VFS::FileAccessMode::Read);
-            if (!stream)
-            {
-                LSTG_LOG_ERROR_CAT(GameApp, "Open asset pack from \"{}\" fail: {}", path, stream.GetError());
-                return stream.GetError();
-            }
-            packageStream = std::move(*stream);
-        }
-        auto fs = make_shared<Subsystem::VFS::ZipArchiveFileSystem>(packageStream, password ? string{*password} : "");
+        auto fs = make_shared<Subsystem::VFS::ZipArchiveFileSystem>(std::move(*packageStream), password ? string{*password} : "");
         fs->SetUserData(string{path});
+        fs->SetBlockCache(GetSubsystem<Subsystem::VirtualFileSystem>()->GetBlockCache());
         m_pAssetsFileSystem->PushFileSystem(std::move(fs));
         return {};
     }
@@ -357,6 +336,46 @@ Result<void> GameApp::MountAssetPack(std::string_view path, std::optional<std::s
     }
 }
 
+Result<std::shared_ptr<Subsystem::VFS::BundleFileSystem>> GameApp::MountAssetBundle(std::string_view path, bool vfsBypass) noexcept
+{
+    if (path.empty())
+        return make_error_code(errc::invalid_argument);
+
+    // 已经挂载的资源束直接返回，以便重复注册其中的资产
+    auto mounted = FindMountedAssetPack(path);
+    if (mounted)
+    {
+        auto bundle = dynamic_pointer_cast<Subsystem::VFS::BundleFileSystem>(mounted);
+        if (!bundle)
+        {
+            LSTG_LOG_ERROR_CAT(GameApp, "Path is already mounted as an asset pack, path={}", path);
+            return make_error_code(errc::invalid_argument);
+        }
+        return bundle;
+    }
+
+    try
+    {
+        auto bundleStream = OpenAssetPackStream(path, vfsBypass);
+        if (!bundleStream)
+            return bundleStream.GetError();
+
+        auto fs = make_shared<Subsystem::VFS::BundleFileSystem>(std::move(*bundleStream));
+        fs->SetUserData(string{path});
+        m_pAssetsFileSystem->PushFileSystem(fs);
+        return fs;
+    }
+    catch (const std::system_error& ex)
+    {
+        LSTG_LOG_ERROR_CAT(GameApp, "Open asset bundle from \"{}\" fail: {}", path, ex.code());
+        return ex.code();
+    }
+    catch (...)  // bad_alloc
+    {
+        return make_error_code(errc::not_enough_memory);
+    }
+}
+
 Result<void> GameApp::UnmountAssetPack(std::string_view path) noexcept
 {
     if (path.empty())
@@ -377,6 +396,62 @@ Result<void> GameApp::UnmountAssetPack(std::string_view path) noexcept
     return make_error_code(errc::no_such_file_or_directory);
 }
 
+Subsystem::VFS::FileSystemPtr GameApp::FindMountedAssetPack(std::string_view path) const noexcept
+{
+    for (size_t i = 0; i < m_pAssetsFileSystem->GetFileSystemCount(); ++i)
+    {
+        auto fs = m_pAssetsFileSystem->GetFileSystem(i);
+        assert(fs);
+        if (fs->GetUserData() == path)
+            return fs;
+    }
+    return nullptr;
+}
+
+Result<Subsystem::VFS::StreamPtr> GameApp::OpenAssetPackStream(std::string_view path, bool vfsBypass) noexcept
+{
+    if (vfsBypass)
+    {
+        // 资源包在挂载期间始终打开，优先映射到内存，使包内未压缩的文件可以零拷贝访问
+        auto mapped = Subsystem::VFS::MemoryMappedFile::OpenStream(filesystem::path{path});
+        if (mapped)
+            return std::move(*mapped);
+
+        try
+        {
+            return make_shared<Subsystem::VFS::FileStream>(path, Subsystem::VFS::FileAccessMode::Read, Subsystem::VFS::FileOpenFlags::None);
+        }
+        catch (const std::system_error& ex)
+        {
+            LSTG_LOG_ERROR_CAT(GameApp, "Open asset pack from \"{}\" fail: {}", path, ex.code());
+            return ex.code();
+        }
+        catch (...)
+        {
+            LSTG_LOG_ERROR_CAT(GameApp, "Open asset pack from \"{}\" fail: <unknown>", path);
+            return make_error_code(errc::io_error);
+        }
+    }
+
+    // 尝试加载流
+    try
+    {
+        auto fullPath = fmt::format("{}/{}", GetSubsystem<Subsystem::VirtualFileSystem>()->GetAssetBaseDirectory(), path);
+        auto stream = GetSubsystem<Subsystem::VirtualFileSystem>()->OpenFile(fullPath, Subsystem::VFS::FileAccessMode::Read,
+            Subsystem::VFS::FileOpenFlags::MemoryMap);  // 资源包在挂载期间不会被修改
+        if (!stream)
+        {
+            LSTG_LOG_ERROR_CAT(GameApp, "Open asset pack from \"{}\" fail: {}", path, stream.GetError());
+            return stream.GetError();
+        }
+        return std::move(*stream);
+    }
+    catch (...)  // bad_alloc
+    {
+        return make_error_code(errc::not_enough_memory);
+    }
+}
+
 // </editor-fold>
 // <editor-fold desc="渲染系统">
 
@@ -745,8 +820,13 @@ void GameApp::OnEvent(Subsystem::SubsystemEvent& event) noexcept
 
 void GameApp::OnUpdate(double elapsed) noexcept
 {
+    auto scriptSystem = GetSubsystem<Subsystem::ScriptSystem>();
+
+    // 唤醒到期的协程
+    scriptSystem->GetCoroutineScheduler().Update();
+
     // 执行框架 FrameFunc 方法
-    auto ret = GetSubsystem<Subsystem::ScriptSystem>()->CallGlobal<bool>(kEventOnUpdate);
+    auto ret = scriptSystem->CallGlobal<bool>(kEventOnUpdate);
     if (!ret)
     {
         LSTG_LOG_ERROR_CAT(GameApp, "Fail to call \"{}\": {}", kEventOnUpdate, ret.GetError());
@@ -6,9 +6,11 @@
  */
 #include <lstg/v2/GamePlay/BentLaser.hpp>
 
+#include <limits>
 #include <lstg/Core/Logging.hpp>
 #include <lstg/Core/Math/VectorHelper.hpp>
 #include <lstg/Core/Math/Collider2D/IntersectCheck.hpp>
+#include <lstg/Core/Subsystem/ProfileSystem.hpp>
 #include <lstg/v2/GameApp.hpp>
 #include <lstg/v2/Asset/TextureAsset.hpp>
 #include <lstg/v2/GamePlay/Components/Transform.hpp>
@@ -18,8 +20,219 @@ using namespace std;
 using namespace lstg;
 using namespace lstg::v2::GamePlay;
 
+#if (defined(__SSE2__) || defined(_M_AMD64) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define LSTG_SSE2 1
+#include <emmintrin.h>
+#elif (defined(__aarch64__) || defined(_M_ARM64))  // 需要 AArch64 的双精度向量指令
+#define LSTG_NEON 1
+#include <arm_neon.h>
+#endif
+
 LSTG_DEF_LOG_CATEGORY(BentLaser);
 
+namespace
+{
+    /**
+     * 批量激光链表
+     */
+    struct BatchList
+    {
+        IntrusiveListNode Header;
+        IntrusiveListNode Tailer;
+
+        BatchList() noexcept
+        {
+            Header.Next = &Tailer;
+            Tailer.Prev = &Header;
+        }
+    };
+
+    BatchList& GetBatchList() noexcept
+    {
+        static BatchList kList;
+        return kList;
+    }
+
+    /**
+     * 计算线段向量
+     * 对于 i in [0, count)，计算 d = (x[i], y[i]) - (x[i + 1], y[i + 1]) 及其长度与单位向量，长度为 0 时单位向量为 0。
+     * 与 glm::length / Math::Normalize 的计算方式相同。
+     */
+    void ComputeSegments(const double* x, const double* y, size_t count, double* len, double* nx, double* ny) noexcept
+    {
+        size_t i = 0;
+#if defined(LSTG_SSE2)
+        const auto zero = _mm_setzero_pd();
+        for (; i + 2 <= count; i += 2)
+        {
+            auto dx = _mm_sub_pd(_mm_loadu_pd(x + i), _mm_loadu_pd(x + i + 1));
+            auto dy = _mm_sub_pd(_mm_loadu_pd(y + i), _mm_loadu_pd(y + i + 1));
+            auto l = _mm_sqrt_pd(_mm_add_pd(_mm_mul_pd(dx, dx), _mm_mul_pd(dy, dy)));
+            auto mask = _mm_cmpneq_pd(l, zero);
+            _mm_storeu_pd(len + i, l);
+            _mm_storeu_pd(nx + i, _mm_and_pd(_mm_div_pd(dx, l), mask));
+            _mm_storeu_pd(ny + i, _mm_and_pd(_mm_div_pd(dy, l), mask));
+        }
+#elif defined(LSTG_NEON)
+        const auto zero = vdupq_n_f64(0.);
+        for (; i + 2 <= count; i += 2)
+        {
+            auto dx = vsubq_f64(vld1q_f64(x + i), vld1q_f64(x + i + 1));
+            auto dy = vsubq_f64(vld1q_f64(y + i), vld1q_f64(y + i + 1));
+            auto l = vsqrtq_f64(vaddq_f64(vmulq_f64(dx, dx), vmulq_f64(dy, dy)));
+            auto isZero = vceqq_f64(l, zero);
+            vst1q_f64(len + i, l);
+            vst1q_f64(nx + i, vbslq_f64(isZero, zero, vdivq_f64(dx, l)));
+            vst1q_f64(ny + i, vbslq_f64(isZero, zero, vdivq_f64(dy, l)));
+        }
+#endif
+        for (; i < count; ++i)
+        {
+            auto dx = x[i] - x[i + 1];
+            auto dy = y[i] - y[i + 1];
+            auto l = ::sqrt(dx * dx + dy * dy);
+            len[i] = l;
+            nx[i] = l == 0. ? 0. : dx / l;
+            ny[i] = l == 0. ? 0. : dy / l;
+        }
+    }
+}
+
+size_t BentLaser::UpdateAll() noexcept
+{
+#ifdef LSTG_DEVELOPMENT
+    LSTG_PER_FRAME_PROFILE(BentLaser_UpdateAll);
+#endif
+
+    auto& list = GetBatchList();
+    size_t count = 0;
+    auto p = list.Header.Next;
+    while (p != &list.Tailer)
+    {
+        auto next = p->Next;
+        auto laser = static_cast<BatchNode*>(p)->Owner;
+        assert(laser);
+        if (laser->Update(laser->m_uEmitterId, laser->m_iBindLength, laser->m_dBindWidth))
+            ++count;
+        else
+            laser->Unbind();  // 发射对象已经失效
+        p = next;
+    }
+    return count;
+}
+
+bool BentLaser::RenderAll() noexcept
+{
+    auto& list = GetBatchList();
+    bool ret = true;
+    for (auto p = list.Header.Next; p != &list.Tailer; p = p->Next)
+    {
+        auto laser = static_cast<BatchNode*>(p)->Owner;
+        assert(laser);
+        if (!laser->m_bHasRenderState)
+            continue;
+        ret &= laser->Render(laser->m_stRenderTexture.c_str(), laser->m_stRenderBlend, laser->m_stRenderColor, laser->m_stRenderRect,
+            laser->m_dRenderScale);
+    }
+    return ret;
+}
+
+void BentLaser::CollisionCheckAll(ECS::Entity target, std::vector<ScriptObjectId>& hits)
+{
+#ifdef LSTG_DEVELOPMENT
+    LSTG_PER_FRAME_PROFILE(BentLaser_CollisionCheckAll);
+#endif
+
+    auto transformComponent = target.TryGetComponent<Components::Transform>();
+    auto colliderComponent = target.TryGetComponent<Components::Collider>();
+    if (!transformComponent || !colliderComponent || !colliderComponent->Enabled)
+        return;
+
+    auto& list = GetBatchList();
+    for (auto p = list.Header.Next; p != &list.Tailer; p = p->Next)
+    {
+        auto laser = static_cast<BatchNode*>(p)->Owner;
+        assert(laser);
+        if (laser->CollisionCheck(transformComponent->Location, transformComponent->Rotation, colliderComponent->Shape,
+            colliderComponent->AABBHalfSize))
+        {
+            hits.push_back(laser->m_uEmitterId);
+        }
+    }
+}
+
+BentLaser::BentLaser() noexcept
+{
+    m_stBatchNode.Owner = this;
+}
+
+BentLaser::BentLaser(const BentLaser& rhs)
+    : m_stQueue(rhs.m_stQueue), m_dLength(rhs.m_dLength), m_bHasRenderState(rhs.m_bHasRenderState),
+    m_stRenderTexture(rhs.m_stRenderTexture), m_stRenderBlend(rhs.m_stRenderBlend), m_stRenderColor(rhs.m_stRenderColor),
+    m_stRenderRect(rhs.m_stRenderRect), m_dRenderScale(rhs.m_dRenderScale)
+{
+    m_stBatchNode.Owner = this;
+}
+
+BentLaser::~BentLaser()
+{
+    Unbind();
+}
+
+BentLaser& BentLaser::operator=(const BentLaser& rhs)
+{
+    if (this != &rhs)
+    {
+        m_stQueue = rhs.m_stQueue;
+        m_dLength = rhs.m_dLength;
+        m_bBoundsDirty = true;
+        m_bHasRenderState = rhs.m_bHasRenderState;
+        m_stRenderTexture = rhs.m_stRenderTexture;
+        m_stRenderBlend = rhs.m_stRenderBlend;
+        m_stRenderColor = rhs.m_stRenderColor;
+        m_stRenderRect = rhs.m_stRenderRect;
+        m_dRenderScale = rhs.m_dRenderScale;
+    }
+    return *this;
+}
+
+bool BentLaser::Bind(ScriptObjectId id, int32_t length, double width) noexcept
+{
+    if (length <= 1)
+    {
+        LSTG_LOG_ERROR_CAT(BentLaser, "Invalid length {}", length);
+        return false;
+    }
+
+    auto& world = static_cast<GameApp&>(v2::GameApp::GetInstance()).GetDefaultWorld();
+    if (!world.GetEntityByScriptObjectId(id))
+        return false;
+
+    m_uEmitterId = id;
+    m_iBindLength = length;
+    m_dBindWidth = width;
+    if (!IsBound())
+        ListInsertBefore(&GetBatchList().Tailer, &m_stBatchNode);
+    return true;
+}
+
+void BentLaser::Unbind() noexcept
+{
+    if (IsBound())
+        ListRemove(&m_stBatchNode);
+}
+
+void BentLaser::SetRenderState(std::string textureName, BlendMode blend, Subsystem::Render::ColorRGBA32 c, Math::UVRectangle textureRect,
+    double scale)
+{
+    m_stRenderTexture = std::move(textureName);
+    m_stRenderBlend = blend;
+    m_stRenderColor = c;
+    m_stRenderRect = textureRect;
+    m_dRenderScale = scale;
+    m_bHasRenderState = true;
+}
+
 bool BentLaser::Update(ScriptObjectId id, int32_t length, double width) noexcept
 {
     auto& world = static_cast<GameApp&>(v2::GameApp::GetInstance()).GetDefaultWorld();
@@ -68,6 +281,7 @@ bool BentLaser::Update(ScriptObjectId id, int32_t length, double width) noexcept
         }
     }
 
+    m_bBoundsDirty = true;
     return true;
 }
 
@@ -130,23 +344,37 @@ bool BentLaser::Render(const char* textureName, BlendMode blend, Subsystem::Rend
         },
     };
 
+    // 预先计算所有线段的长度和方向
+    // 节点坐标转为 SoA 布局后批量计算，逐段生成顶点时只需查表。
+    auto nodeCount = m_stQueue.GetSize();
+    auto segmentCount = nodeCount - 1;
+    double nodeX[kMaxLaserNodes], nodeY[kMaxLaserNodes];
+    double segmentLength[kMaxLaserNodes], segmentDirX[kMaxLaserNodes], segmentDirY[kMaxLaserNodes];
+    for (size_t i = 0; i < nodeCount; ++i)
+    {
+        auto& n = m_stQueue[i];
+        nodeX[i] = n.Location.x;
+        nodeY[i] = n.Location.y;
+    }
+    ComputeSegments(nodeX, nodeY, segmentCount, segmentLength, segmentDirX, segmentDirY);
+
+    cmdBuffer.SetColorBlendMode(blend.ColorBlend);
+
     double vecLength = 0.;
-    for (size_t i = 0; i < m_stQueue.GetSize() - 1; ++i)
+    for (size_t i = 0; i < segmentCount; ++i)
     {
         auto& cur = m_stQueue[i];
         auto& next = m_stQueue[i + 1];
 
         // === 计算最左侧的两个点 ===
-        // 计算从cur到next的向量
-        auto offsetA = cur.Location - next.Location;
-        auto lenOffsetA = glm::length(offsetA);
-        if (lenOffsetA < 0.0001f && i + 1 != m_stQueue.GetSize() - 1)
+        // 从cur到next的向量
+        auto lenOffsetA = segmentLength[i];
+        if (lenOffsetA < 0.0001f && i + 1 != segmentCount)
             continue;
+        Vec2 dirA { segmentDirX[i], segmentDirY[i] };
 
         // 计算宽度上的扩展长度(旋转270度)
-        auto expandVec = Math::Normalize(offsetA);
-        std::swap(expandVec.x, expandVec.y);
-        expandVec.y = -expandVec.y;
+        Vec2 expandVec { dirA.y, -dirA.x };
 
         if (i == 0)  // 如果是第一个节点，则其宽度扩展使用expandVec计算
         {
@@ -169,7 +397,7 @@ bool BentLaser::Render(const char* textureName, BlendMode blend, Subsystem::Rend
 
         // === 计算最右侧的两个点 ===
         vecLength += lenOffsetA;
-        if (i == m_stQueue.GetSize() - 2)  // 这是最后两个节点，则其宽度扩展使用expandVec计算
+        if (i == segmentCount - 1)  // 这是最后两个节点，则其宽度扩展使用expandVec计算
         {
             auto expandX = expandVec.x * scale * next.HalfWidth;
             auto expandY = expandVec.y * scale * next.HalfWidth;
@@ -182,11 +410,8 @@ bool BentLaser::Render(const char* textureName, BlendMode blend, Subsystem::Rend
         }
         else  // 否则，参考第三个点
         {
-            auto& afterNext = m_stQueue[i + 2];
-
-            // 计算向量next->afterNext并规范化，相加offsetA和offsetB后得角平分线
-            auto offsetB = afterNext.Location - next.Location;
-            auto angleBisect = Math::Normalize(offsetA) + Math::Normalize(offsetB);
+            // 向量next->afterNext即下一段的反向，与offsetA的单位向量相加后得角平分线
+            auto angleBisect = dirA - Vec2 { segmentDirX[i + 1], segmentDirY[i + 1] };
             auto angleBisectLen = glm::length(angleBisect);
 
             double expandX, expandY;
@@ -198,7 +423,7 @@ bool BentLaser::Render(const char* textureName, BlendMode blend, Subsystem::Rend
             else // 计算角平分线到角两边距离为next.half_width * scale的偏移量
             {
                 angleBisect *= (1. / angleBisectLen);  // angleBisect.Normalize();
-                auto t = angleBisect * Math::Normalize(offsetA);
+                auto t = angleBisect * dirA;
                 auto l = scale * next.HalfWidth;
                 auto expandDelta = sqrt(l * l / (1. - glm::length2(t)));
                 expandX = angleBisect.x * expandDelta;
@@ -231,7 +456,6 @@ bool BentLaser::Render(const char* textureName, BlendMode blend, Subsystem::Rend
         }
 
         // 绘制这一段
-        cmdBuffer.SetColorBlendMode(blend.ColorBlend);
         auto ret = cmdBuffer.DrawQuad(texture->GetDrawingTexture().GetUnderlayTexture(), renderVertex);
         if (!ret)
         {
@@ -258,41 +482,84 @@ bool BentLaser::CollisionCheck(double x, double y, double rot, double a, double
         colliderA.Shape = Math::Collider2D::EllipseShape<double> { a, b };
     colliderA.RefreshAABB();
 
+    return CollisionCheck(Vec2 { x, y }, rot, colliderA.Shape, colliderA.AABBHalfSize);
+}
+
+bool BentLaser::CollisionCheck(Vec2 location, double rot, const ColliderShape& shape, Vec2 aabbHalfSize) const noexcept
+{
+    // 忽略只有一个节点的情况
+    if (m_stQueue.GetSize() <= 1)
+        return false;
+
+    RefreshBounds();
+
     // 计算 AABB 范围
-    auto leftA = x - colliderA.AABBHalfSize.x;
-    auto rightA = x + colliderA.AABBHalfSize.x;
-    auto topA = y + colliderA.AABBHalfSize.y;
-    auto bottomA = y - colliderA.AABBHalfSize.y;
+    auto minA = location - aabbHalfSize;
+    auto maxA = location + aabbHalfSize;
+    auto overlap = [&](const Vec2& minB, const Vec2& maxB) {
+        return minA.x <= maxB.x && maxA.x >= minB.x && minA.y <= maxB.y && maxA.y >= minB.y;
+    };
 
-    // 遍历队列依次判断碰撞
-    for (size_t i = 0; i < m_stQueue.GetSize(); ++i)
+    // 逐层使用 AABB 进行快速判断
+    if (!overlap(m_stBounds.Min, m_stBounds.Max))
+        return false;
+    auto nodeCount = m_stQueue.GetSize();
+    for (size_t chunk = 0, begin = 0; begin < nodeCount; ++chunk, begin += kNodesPerChunk)
     {
-        auto& n = m_stQueue[i];
+        auto& bounds = m_stChunkBounds[chunk];
+        if (!overlap(bounds.Min, bounds.Max))
+            continue;
 
-        // 创建形状
-        Components::Collider colliderB;
-        colliderB.Shape = Math::Collider2D::CircleShape<double> { n.HalfWidth };
-        colliderB.RefreshAABB();
-
-        // 计算 AABB 范围
-        auto leftB = x - colliderB.AABBHalfSize.x;
-        auto rightB = x + colliderB.AABBHalfSize.x;
-        auto topB = y + colliderB.AABBHalfSize.y;
-        auto bottomB = y - colliderB.AABBHalfSize.y;
-
-        // 使用 AABB 进行快速判断
-        Vec2 na { std::max(leftA, leftB), std::min(topA, topB) };
-        Vec2 nb { std::min(rightA , rightB), std::max(bottomA, bottomB) };
-        if (na.x <= nb.x && na.y >= nb.y)
+        auto end = std::min<size_t>(begin + kNodesPerChunk, nodeCount);
+        for (auto i = begin; i < end; ++i)
         {
+            auto& n = m_stQueue[i];
+            Vec2 halfSize { n.HalfWidth, n.HalfWidth };
+            if (!overlap(n.Location - halfSize, n.Location + halfSize))
+                continue;
+
             // 执行碰撞检查
-            if (Math::Collider2D::IsIntersect(Vec2 { x, y }, rot, colliderA.Shape, n.Location, 0., colliderB.Shape))
+            ColliderShape shapeB = Math::Collider2D::CircleShape<double> { n.HalfWidth };
+            if (Math::Collider2D::IsIntersect(location, rot, shape, n.Location, 0., shapeB))
                 return true;
         }
     }
     return false;
 }
 
+void BentLaser::RefreshBounds() const noexcept
+{
+    if (!m_bBoundsDirty)
+        return;
+
+    auto nodeCount = m_stQueue.GetSize();
+    m_stBounds.Min = Vec2 { numeric_limits<double>::infinity(), numeric_limits<double>::infinity() };
+    m_stBounds.Max = -m_stBounds.Min;
+    for (size_t chunk = 0, begin = 0; begin < nodeCount; ++chunk, begin += kNodesPerChunk)
+    {
+        auto& bounds = m_stChunkBounds[chunk];
+        bounds.Min = m_stBounds.Min;
+        bounds.Max = m_stBounds.Max;
+
+        auto end = std::min<size_t>(begin + kNodesPerChunk, nodeCount);
+        for (auto i = begin; i < end; ++i)
+        {
+            auto& n = m_stQueue[i];
+            Vec2 halfSize { n.HalfWidth, n.HalfWidth };
+            bounds.Min = glm::min(bounds.Min, n.Location - halfSize);
+            bounds.Max = glm::max(bounds.Max, n.Location + halfSize);
+        }
+    }
+
+    // 根包围盒
+    for (size_t chunk = 0, begin = 0; begin < nodeCount; ++chunk, begin += kNodesPerChunk)
+    {
+        m_stBounds.Min = glm::min(m_stBounds.Min, m_stChunkBounds[chunk].Min);
+        m_stBounds.Max = glm::max(m_stBounds.Max, m_stChunkBounds[chunk].Max);
+    }
+    m_bBoundsDirty = false;
+}
+
 bool BentLaser::BoundCheck() const noexcept
 {
     auto& world = static_cast<GameApp&>(v2::GameApp::GetInstance()).GetDefaultWorld();
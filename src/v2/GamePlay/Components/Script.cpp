@@ -17,5 +17,6 @@ void Script::Reset() noexcept
     if (Pool)
         Pool->Free(Pool->GetState(), ScriptObjectId);
     ScriptObjectId = 0;
+    Sequence = 0;
     Pool = nullptr;
 }
@@ -34,6 +34,10 @@ using namespace lstg::v2::GamePlay::Components;
 
 LSTG_DEF_LOG_CATEGORY(GameWorld);
 
+static const size_t kParallelRenderMinEntities = 512u;  // 少于该数量的连续默认渲染对象直接串行绘制
+static const size_t kParallelRenderBatchSize = 128u;  // 工作线程单次领取的对象数量
+static const uint32_t kParallelRenderMaxWorkers = 7u;
+
 namespace
 {
     inline bool ColliderSortFunction(IntrusiveSkipListNode<kColliderSkipListNodeDepth>* lhs,
@@ -43,10 +47,10 @@ namespace
         auto left = Collider::FromSkipListNode(lhs);
         auto right = Collider::FromSkipListNode(rhs);
 
-        // 总是比较对象ID
+        // 总是比较创建序号
         auto lhsScript = left->BindingEntity.TryGetComponent<Script>();
         auto rhsScript = right->BindingEntity.TryGetComponent<Script>();
-        return (lhsScript ? lhsScript->ScriptObjectId : 0) < (rhsScript ? rhsScript->ScriptObjectId : 0);
+        return (lhsScript ? lhsScript->Sequence : 0) < (rhsScript ? rhsScript->Sequence : 0);
     }
 
     inline bool RendererSortFunction(IntrusiveSkipListNode<kRendererSkipListNodeDepth>* lhs,
@@ -60,15 +64,43 @@ namespace
         if (left->Layer < right->Layer)
             return true;
 
-        // 相同时比较对象ID
+        // 相同时比较创建序号
         if (left->Layer == right->Layer)
         {
             auto lhsScript = left->BindingEntity.TryGetComponent<Script>();
             auto rhsScript = right->BindingEntity.TryGetComponent<Script>();
-            return (lhsScript ? lhsScript->ScriptObjectId : 0) < (rhsScript ? rhsScript->ScriptObjectId : 0);
+            return (lhsScript ? lhsScript->Sequence : 0) < (rhsScript ? rhsScript->Sequence : 0);
         }
         return false;
     }
+
+    static_assert(kRendererSkipListNodeDepth == 3, "Depth of m_stRendererLayerTails mismatched");
+
+    /**
+     * 图层尾部缓存的访问器
+     * 组件内存可能移动，因此以 EntityId 作为句柄。
+     */
+    struct RendererLayerTailAccessor
+    {
+        ECS::World& World;
+
+        double GetKey(IntrusiveSkipListNode<kRendererSkipListNodeDepth>* n) const noexcept
+        {
+            return Renderer::FromSkipListNode(n)->Layer;
+        }
+
+        ECS::EntityId GetHandle(IntrusiveSkipListNode<kRendererSkipListNodeDepth>* n) const noexcept
+        {
+            return Renderer::FromSkipListNode(n)->BindingEntity.GetId();
+        }
+
+        IntrusiveSkipListNode<kRendererSkipListNodeDepth>* Resolve(ECS::EntityId id) const noexcept
+        {
+            ECS::Entity entity { &World, id };
+            auto renderer = entity ? entity.TryGetComponent<Renderer>() : nullptr;
+            return renderer ? &renderer->SkipListNode : nullptr;
+        }
+    };
 }
 
 GameWorld::GameWorld(GameApp& app)
@@ -116,16 +148,16 @@ Result<LuaStack::AbsIndex> GameWorld::CreateEntity(LuaStack stack, LuaStack::Abs
         auto& renderer = entity->GetComponent<Renderer>();
         auto& lifeTime = entity->GetComponent<LifeTime>();
         auto& script = entity->GetComponent<Script>();
+        script.Pool = &m_stScriptObjectPool;
+        script.ScriptObjectId = std::get<0>(*scriptObject);
+        script.Sequence = ++m_ullEntitySequence;  // 需要先于链表插入设置，排序依赖创建序号
         collider.BindingEntity = *entity;
         SkipListInsert(&(m_pColliderRoot->ColliderGroupTailers[collider.Group].SkipListNode), &collider.SkipListNode, ColliderSortFunction,
             m_stSkipListRandomizer);
         renderer.BindingEntity = *entity;
-        SkipListInsert(&(m_pRendererRoot->RendererTailer.SkipListNode), &renderer.SkipListNode, RendererSortFunction,
-            m_stSkipListRandomizer);
+        InsertRenderer(renderer);
         lifeTime.BindingEntity = *entity;
         ListInsertBefore(&m_pLifeTimeRoot->LifeTimeTailer.ListNode, &lifeTime.ListNode);
-        script.Pool = &m_stScriptObjectPool;
-        script.ScriptObjectId = std::get<0>(*scriptObject);
     }
 
     // 调用 Init 事件
@@ -224,6 +256,7 @@ void GameWorld::Frame() noexcept
 
     // 为了保证与 luastg 行为的兼容性，这里通过 LifeTime 上的链表更新所有对象
     // 这并不符合 ECS 的使用规范，无法得到 cache friendly 的优势
+    ScriptCallbackBatch frameBatch(m_stScriptObjectPool, ScriptCallbackFunctions::OnFrame);
     assert(m_pLifeTimeRoot);
     LifeTime* p = m_pLifeTimeRoot->LifeTimeHeader.NextNode();
     assert(p);
@@ -236,11 +269,11 @@ void GameWorld::Frame() noexcept
         if (scriptComponent)
         {
             assert(scriptComponent->Pool == &m_stScriptObjectPool);
-            m_stScriptObjectPool.InvokeCallback(m_stScriptObjectPool.GetState(), scriptComponent->ScriptObjectId,
-                ScriptCallbackFunctions::OnFrame, 0);
-
-            // 由于内存分配，此时迭代器可能失效
-            p = &entity.GetComponent<LifeTime>();
+            if (frameBatch.Invoke(scriptComponent->ScriptObjectId) != ScriptCallbackInvokeResult::CallbackNotDefined)
+            {
+                // 由于内存分配，此时迭代器可能失效
+                p = &entity.GetComponent<LifeTime>();
+            }
         }
 
         // 更新对象运动状态
@@ -288,6 +321,8 @@ void GameWorld::Render() noexcept
 #endif
 
     assert(m_pRendererRoot);
+    assert(m_stPendingRenderEntities.empty());
+    ScriptCallbackBatch renderBatch(m_stScriptObjectPool, ScriptCallbackFunctions::OnRender);
     Renderer* p = m_pRendererRoot->RendererHeader.NextNode();
     assert(p);
     while (p != &m_pRendererRoot->RendererTailer)
@@ -301,21 +336,43 @@ void GameWorld::Render() noexcept
             if (scriptComponent)
             {
                 assert(scriptComponent->Pool == &m_stScriptObjectPool);
-                if (m_stScriptObjectPool.InvokeCallback(m_stScriptObjectPool.GetState(), scriptComponent->ScriptObjectId,
-                    ScriptCallbackFunctions::OnRender, 0) == ScriptCallbackInvokeResult::CallbackNotDefined)
+                if (m_bParallelRenderEnabled && !m_stScriptObjectPool.IsCallbackDefined(scriptComponent->ScriptObjectId,
+                    ScriptCallbackFunctions::OnRender))
                 {
-                    // 当没有用户定义渲染方法时，调用默认渲染方法
-                    RenderEntityDefault(entity);
+                    // 并行模式下，默认渲染对象先积攒起来，在遇到脚本渲染对象或遍历结束时统一提交
+                    // 期间不会执行脚本，迭代器总是有效
+                    try
+                    {
+                        m_stPendingRenderEntities.push_back(entity);
+                    }
+                    catch (...)  // bad_alloc
+                    {
+                        FlushPendingDefaultRenderEntities();
+                        RenderEntityDefault(entity);
+                    }
                 }
+                else
+                {
+                    // 脚本渲染对象作为屏障，需要先提交之前的所有对象
+                    FlushPendingDefaultRenderEntities();
 
-                // 由于内存分配，此时迭代器可能失效
-                p = &entity.GetComponent<Renderer>();
+                    if (renderBatch.Invoke(scriptComponent->ScriptObjectId) == ScriptCallbackInvokeResult::CallbackNotDefined)
+                    {
+                        // 当没有用户定义渲染方法时，调用默认渲染方法
+                        RenderEntityDefault(entity);
+                    }
+
+                    // 由于内存分配，此时迭代器可能失效
+                    p = &entity.GetComponent<Renderer>();
+                }
             }
         }
 
         assert(p->NextNode());
         p = p->NextNode();
     }
+
+    FlushPendingDefaultRenderEntities();
 }
 
 void GameWorld::UpdateCoordinate() noexcept
@@ -414,17 +471,13 @@ void GameWorld::RenderEntityDefault(ECS::Entity entity) noexcept
                     {
                         auto& spriteRenderer = std::get<1>(rendererComponent->RenderData);
                         assert(spriteRenderer.Asset);
-                        auto draw = spriteRenderer.Asset->GetDrawingSprite().Draw(cmdBuffer);
-                        if (!draw)
-                        {
-                            LSTG_LOG_ERROR_CAT(GameWorld, "Draw asset {} fail: {}", spriteRenderer.Asset->GetName(), draw.GetError());
-                            return;
-                        }
-
                         auto loc = transformComponent->Location;
-                        draw->Transform(static_cast<float>(transformComponent->Rotation), static_cast<float>(rendererComponent->Scale.x),
-                            static_cast<float>(rendererComponent->Scale.y));
-                        draw->Translate(static_cast<float>(loc.x), static_cast<float>(loc.y), 0.5f);
+                        auto ret = spriteRenderer.Asset->GetDrawingSprite().DrawTransformed(cmdBuffer,
+                            { static_cast<float>(loc.x), static_cast<float>(loc.y), 0.5f },
+                            static_cast<float>(transformComponent->Rotation),
+                            { static_cast<float>(rendererComponent->Scale.x), static_cast<float>(rendererComponent->Scale.y) });
+                        if (!ret)
+                            LSTG_LOG_ERROR_CAT(GameWorld, "Draw asset {} fail: {}", spriteRenderer.Asset->GetName(), ret.GetError());
                     }
                     break;
                 case 2:
@@ -434,17 +487,13 @@ void GameWorld::RenderEntityDefault(ECS::Entity entity) noexcept
                         assert(asset && !asset->GetSequences().empty());
                         auto frame = (rendererComponent->AnimationTimer / spriteSequenceRenderer.Asset->GetInterval()) %
                             asset->GetSequences().size();
-                        auto draw = spriteSequenceRenderer.Asset->GetSequences()[frame].Draw(cmdBuffer);
-                        if (!draw)
-                        {
-                            LSTG_LOG_ERROR_CAT(GameWorld, "Draw asset {} fail: {}", asset->GetName(), draw.GetError());
-                            return;
-                        }
-
                         auto loc = transformComponent->Location;
-                        draw->Transform(static_cast<float>(transformComponent->Rotation), static_cast<float>(rendererComponent->Scale.x),
-                            static_cast<float>(rendererComponent->Scale.y));
-                        draw->Translate(static_cast<float>(loc.x), static_cast<float>(loc.y), 0.5f);
+                        auto ret = spriteSequenceRenderer.Asset->GetSequences()[frame].DrawTransformed(cmdBuffer,
+                            { static_cast<float>(loc.x), static_cast<float>(loc.y), 0.5f },
+                            static_cast<float>(transformComponent->Rotation),
+                            { static_cast<float>(rendererComponent->Scale.x), static_cast<float>(rendererComponent->Scale.y) });
+                        if (!ret)
+                            LSTG_LOG_ERROR_CAT(GameWorld, "Draw asset {} fail: {}", asset->GetName(), ret.GetError());
                     }
                     break;
                 case 3:
@@ -464,6 +513,121 @@ void GameWorld::RenderEntityDefault(ECS::Entity entity) noexcept
     }
 }
 
+void GameWorld::FlushPendingDefaultRenderEntities() noexcept
+{
+    auto count = m_stPendingRenderEntities.size();
+    if (count == 0)
+        return;
+
+    // 对象较少时并行的调度开销得不偿失，直接串行绘制
+    bool parallel = (count >= kParallelRenderMinEntities);
+    if (parallel && !m_pRenderWorkers)
+    {
+        try
+        {
+            // 主线程也会参与执行，因此工作线程数量为核心数减一
+            auto systemThreads = ThreadPool<>::GetSystemThreadCount();
+            auto workers = std::min(kParallelRenderMaxWorkers, systemThreads > 1 ? systemThreads - 1 : 0u);
+            m_pRenderWorkers = make_unique<ForkJoinPool<>>(workers);
+            LSTG_LOG_INFO_CAT(GameWorld, "Parallel render workers initialized, concurrency={}", m_pRenderWorkers->GetConcurrency());
+        }
+        catch (const std::exception& ex)
+        {
+            LSTG_LOG_ERROR_CAT(GameWorld, "Cannot initialize parallel render workers: {}", ex.what());
+            m_bParallelRenderEnabled = false;
+            parallel = false;
+        }
+    }
+    if (parallel)
+    {
+        try
+        {
+            m_stPreparedRenderItems.resize(count);
+        }
+        catch (...)  // bad_alloc
+        {
+            parallel = false;
+        }
+    }
+
+    if (!parallel)
+    {
+        for (auto entity : m_stPendingRenderEntities)
+            RenderEntityDefault(entity);
+        m_stPendingRenderEntities.clear();
+        return;
+    }
+
+    auto& cmdBuffer = m_stApp.GetCommandBuffer();
+
+    // 阶段一：在工作线程上计算顶点
+    // 这一阶段只读取组件，不访问命令缓冲区和 Lua 虚拟机
+    {
+        auto instancingAvailable = cmdBuffer.IsSpriteInstancingAvailable();
+        m_pRenderWorkers->For(count, kParallelRenderBatchSize, [&](size_t begin, size_t end) noexcept {
+            for (auto i = begin; i < end; ++i)
+            {
+                auto entity = m_stPendingRenderEntities[i];
+                auto& item = m_stPreparedRenderItems[i];
+                item.Sprite = nullptr;
+
+                auto transformComponent = entity.TryGetComponent<Transform>();
+                auto rendererComponent = entity.TryGetComponent<Renderer>();
+                if (!transformComponent || !rendererComponent || rendererComponent->Invisible)
+                    continue;
+
+                const Subsystem::Render::Drawing2D::Sprite* sprite = nullptr;
+                switch (rendererComponent->RenderData.index())
+                {
+                    case 1:
+                        {
+                            auto& spriteRenderer = std::get<1>(rendererComponent->RenderData);
+                            assert(spriteRenderer.Asset);
+                            sprite = &spriteRenderer.Asset->GetDrawingSprite();
+                        }
+                        break;
+                    case 2:
+                        {
+                            auto& asset = std::get<2>(rendererComponent->RenderData).Asset;
+                            assert(asset && !asset->GetSequences().empty());
+                            auto frame = (rendererComponent->AnimationTimer / asset->GetInterval()) % asset->GetSequences().size();
+                            sprite = &asset->GetSequences()[frame];
+                        }
+                        break;
+                    default:
+                        // 粒子等对象在提交阶段串行处理
+                        continue;
+                }
+
+                auto loc = transformComponent->Location;
+                sprite->PrepareTransformed(item.Drawing,
+                    { static_cast<float>(loc.x), static_cast<float>(loc.y), 0.5f },
+                    static_cast<float>(transformComponent->Rotation),
+                    { static_cast<float>(rendererComponent->Scale.x), static_cast<float>(rendererComponent->Scale.y) },
+                    instancingAvailable);
+                item.Sprite = sprite;
+            }
+        });
+    }
+
+    // 阶段二：按渲染顺序提交到命令缓冲区
+    for (size_t i = 0; i < count; ++i)
+    {
+        auto entity = m_stPendingRenderEntities[i];
+        auto& item = m_stPreparedRenderItems[i];
+        if (!item.Sprite)
+        {
+            RenderEntityDefault(entity);
+            continue;
+        }
+
+        auto ret = item.Sprite->DrawPrepared(cmdBuffer, item.Drawing);
+        if (!ret)
+            LSTG_LOG_ERROR_CAT(GameWorld, "Draw asset {} fail: {}", entity.GetComponent<Renderer>().GetAssetName(), ret.GetError());
+    }
+    m_stPendingRenderEntities.clear();
+}
+
 void GameWorld::CollisionCheck(uint32_t groupA, uint32_t groupB) noexcept
 {
 #ifdef LSTG_DEVELOPMENT
@@ -608,6 +772,260 @@ void GameWorld::Clear() noexcept
         p = next;
     }
     assert(m_stScriptObjectPool.GetCurrentObjects() == 0);
+    m_stQueryResult.clear();
+}
+
+size_t GameWorld::QueryEntities(const EntityQuery& query) noexcept
+{
+#ifdef LSTG_DEVELOPMENT
+    LSTG_PER_FRAME_PROFILE(GameWorld_Query);
+#endif
+
+    m_stQueryResult.clear();
+
+    auto topLeft = query.Rectangle.GetTopLeft();
+    auto bottomRight = query.Rectangle.GetBottomRight();
+    auto radiusSquared = query.Radius * query.Radius;
+
+    auto visit = [&](ECS::Entity entity) noexcept {
+        auto lifeTimeComponent = entity.TryGetComponent<LifeTime>();
+        if (!lifeTimeComponent || lifeTimeComponent->Status != LifeTimeStatus::Alive)
+            return true;
+        auto scriptComponent = entity.TryGetComponent<Script>();
+        if (!scriptComponent)
+            return true;
+
+        // 图层
+        if (query.LayerMin || query.LayerMax)
+        {
+            auto rendererComponent = entity.TryGetComponent<Renderer>();
+            if (!rendererComponent)
+                return true;
+            if ((query.LayerMin && rendererComponent->Layer < *query.LayerMin) ||
+                (query.LayerMax && rendererComponent->Layer > *query.LayerMax))
+            {
+                return true;
+            }
+        }
+
+        // 区域
+        if (query.RegionType != QueryRegionTypes::None)
+        {
+            auto transformComponent = entity.TryGetComponent<Transform>();
+            if (!transformComponent)
+                return true;
+            auto loc = transformComponent->Location;
+            if (query.RegionType == QueryRegionTypes::Rectangle)
+            {
+                if (loc.x < topLeft.x || loc.x > bottomRight.x || loc.y > topLeft.y || loc.y < bottomRight.y)
+                    return true;
+            }
+            else if (glm::dot(loc - query.Center, loc - query.Center) > radiusSquared)
+            {
+                return true;
+            }
+        }
+
+        try
+        {
+            m_stQueryResult.push_back({ scriptComponent->ScriptObjectId, entity.GetId() });
+        }
+        catch (...)  // bad_alloc
+        {
+            LSTG_LOG_ERROR_CAT(GameWorld, "Query result truncated, count={}", m_stQueryResult.size());
+            return false;
+        }
+        return true;
+    };
+
+    // 指定了碰撞组时只需要遍历组链表
+    if (query.Group && *query.Group < kColliderGroupCount)
+    {
+        assert(m_pColliderRoot);
+        Collider* p = m_pColliderRoot->ColliderGroupHeaders[*query.Group].NextNode();
+        while (p && p != &m_pColliderRoot->ColliderGroupTailers[*query.Group])
+        {
+            if (!visit(p->BindingEntity))
+                break;
+            p = p->NextNode();
+        }
+    }
+    else
+    {
+        assert(m_pLifeTimeRoot);
+        LifeTime* p = m_pLifeTimeRoot->LifeTimeHeader.NextNode();
+        while (p && p != &m_pLifeTimeRoot->LifeTimeTailer)
+        {
+            if (!visit(p->BindingEntity))
+                break;
+            p = p->NextNode();
+        }
+    }
+    return m_stQueryResult.size();
+}
+
+void GameWorld::PushQueryResult(Subsystem::Script::LuaStack stack) noexcept
+{
+    lua_createtable(stack, static_cast<int>(m_stQueryResult.size()), 0);  // t
+    int index = 0;
+    for (const auto& item : m_stQueryResult)
+    {
+        if (!ResolveQueryResult(item.ScriptId, item.EntityId))
+            continue;
+        m_stScriptObjectPool.PushScriptObject(stack, item.ScriptId);  // t o
+        lua_rawseti(stack, -2, ++index);  // t
+    }
+}
+
+void GameWorld::BatchSetVelocity(Vec2 velocity, std::optional<double> rotation) noexcept
+{
+    for (const auto& item : m_stQueryResult)
+    {
+        auto entity = ResolveQueryResult(item.ScriptId, item.EntityId);
+        if (!entity)
+            continue;
+
+        auto movementComponent = entity->TryGetComponent<Movement>();
+        if (movementComponent)
+            movementComponent->Velocity = velocity;
+        if (rotation)
+        {
+            auto transformComponent = entity->TryGetComponent<Transform>();
+            if (transformComponent)
+                transformComponent->Rotation = *rotation;
+        }
+    }
+}
+
+void GameWorld::BatchApplyRadialImpulse(Vec2 center, double strength, double radius) noexcept
+{
+    for (const auto& item : m_stQueryResult)
+    {
+        auto entity = ResolveQueryResult(item.ScriptId, item.EntityId);
+        if (!entity)
+            continue;
+
+        auto movementComponent = entity->TryGetComponent<Movement>();
+        auto transformComponent = entity->TryGetComponent<Transform>();
+        if (!movementComponent || !transformComponent)
+            continue;
+
+        auto direction = transformComponent->Location - center;
+        auto distance = glm::length(direction);
+        if (distance == 0. || (radius > 0. && distance >= radius))
+            continue;  // 中心处方向不确定，半径外不受影响
+        auto falloff = radius > 0. ? (1. - distance / radius) : 1.;
+        movementComponent->Velocity += direction * (strength * falloff / distance);
+    }
+}
+
+void GameWorld::BatchSetGroup(uint32_t group) noexcept
+{
+    assert(group < kColliderGroupCount);
+    for (const auto& item : m_stQueryResult)
+    {
+        auto entity = ResolveQueryResult(item.ScriptId, item.EntityId);
+        if (!entity)
+            continue;
+
+        auto colliderComponent = entity->TryGetComponent<Collider>();
+        if (colliderComponent)
+            SetColliderGroup(*colliderComponent, group);
+    }
+}
+
+size_t GameWorld::BatchDelete(Subsystem::Script::LuaStack stack, bool callback) noexcept
+{
+#ifdef LSTG_DEVELOPMENT
+    LSTG_PER_FRAME_PROFILE(GameWorld_BatchDel);
+#endif
+    return BatchDispose(stack, false, callback);
+}
+
+size_t GameWorld::BatchKill(Subsystem::Script::LuaStack stack, bool callback) noexcept
+{
+#ifdef LSTG_DEVELOPMENT
+    LSTG_PER_FRAME_PROFILE(GameWorld_BatchKill);
+#endif
+    return BatchDispose(stack, true, callback);
+}
+
+void GameWorld::SetColliderGroup(Components::Collider& collider, uint32_t group) noexcept
+{
+    assert(0 <= group && group < kColliderGroupCount);
+    if (group != collider.Group)
+    {
+        SkipListRemove(&collider.SkipListNode);  // 从原先的组脱离
+        collider.Group = group;
+        SkipListInsert(&(m_pColliderRoot->ColliderGroupTailers[group].SkipListNode), &collider.SkipListNode, ColliderSortFunction,
+            m_stSkipListRandomizer);  // 插入新的组
+    }
+}
+
+void GameWorld::InsertRenderer(Components::Renderer& renderer) noexcept
+{
+    m_stRendererLayerTails.Insert(&(m_pRendererRoot->RendererTailer.SkipListNode), &renderer.SkipListNode,
+        RendererLayerTailAccessor { m_stWorld }, RendererSortFunction, m_stSkipListRandomizer);
+}
+
+void GameWorld::SetRendererLayer(Components::Renderer& renderer, double layer) noexcept
+{
+    if (layer == renderer.Layer)
+        return;
+    renderer.Layer = layer;
+    m_stRendererLayerTails.Reorder(&(m_pRendererRoot->RendererHeader.SkipListNode), &(m_pRendererRoot->RendererTailer.SkipListNode),
+        &renderer.SkipListNode, RendererLayerTailAccessor { m_stWorld }, RendererSortFunction, m_stSkipListRandomizer);
+}
+
+std::optional<ECS::Entity> GameWorld::ResolveQueryResult(ScriptObjectId scriptId, ECS::EntityId entityId) noexcept
+{
+    // 脚本 ID 可能在对象回收后被复用，需要同时比较 ECS 侧的 ID
+    auto entId = m_stScriptObjectPool.GetEntityId(scriptId);
+    if (!entId || *entId != entityId)
+        return nullopt;
+    return ECS::Entity { &m_stWorld, *entId };
+}
+
+size_t GameWorld::BatchDispose(Subsystem::Script::LuaStack stack, bool kill, bool callback) noexcept
+{
+    auto status = kill ? LifeTimeStatus::Killed : LifeTimeStatus::Deleted;
+    auto function = kill ? ScriptCallbackFunctions::OnKill : ScriptCallbackFunctions::OnDelete;
+
+    // 回调中可能再次发起查询，先将结果换出
+    std::vector<QueryResultItem> result;
+    result.swap(m_stQueryResult);
+
+    // 在主线程上调用时使用批量回调，协程中则逐个调用
+    std::optional<ScriptCallbackBatch> batch;
+    if (callback && m_stScriptObjectPool.IsOnMainThread(stack))
+        batch.emplace(m_stScriptObjectPool, function);
+
+    size_t count = 0;
+    for (const auto& item : result)
+    {
+        auto entity = ResolveQueryResult(item.ScriptId, item.EntityId);
+        if (!entity)
+            continue;
+
+        // 前面对象的回调可能已经改变了状态
+        auto& lifeTime = entity->GetComponent<LifeTime>();
+        if (lifeTime.Status != LifeTimeStatus::Alive)
+            continue;
+        lifeTime.Status = status;
+        ++count;
+
+        if (!callback)
+            continue;
+        if (batch)
+            batch->Invoke(item.ScriptId);
+        else
+            m_stScriptObjectPool.InvokeCallback(stack, item.ScriptId, function, 0);
+    }
+
+    // 回调中没有发起新的查询时保留结果，以便继续对其操作
+    if (m_stQueryResult.empty())
+        m_stQueryResult.swap(result);
+    return count;
 }
 
 void GameWorld::Update(double elapsedTime) noexcept
@@ -909,10 +1327,7 @@ bool GameWorld::OnSetAttribute(LuaStack stack, ECS::EntityId id, std::string_vie
         case ScriptObjectAttributes::Layer:
             if (!(rendererComponent = ent.TryGetComponent<Renderer>()))
                 return false;
-            SkipListRemove(&rendererComponent->SkipListNode);  // 从跳表脱离
-            rendererComponent->Layer = stack.ReadValue<double>(value);
-            SkipListInsert(&(m_pRendererRoot->RendererTailer.SkipListNode), &rendererComponent->SkipListNode, RendererSortFunction,
-                m_stSkipListRandomizer);  // 重新插入
+            SetRendererLayer(*rendererComponent, stack.ReadValue<double>(value));
             return true;
         case ScriptObjectAttributes::Group:
             if (!(colliderComponent = ent.TryGetComponent<Collider>()))
@@ -924,14 +1339,7 @@ bool GameWorld::OnSetAttribute(LuaStack stack, ECS::EntityId id, std::string_vie
                 auto group = static_cast<uint32_t>(max(0, stack.ReadValue<int32_t>(value)));
                 if (group >= kColliderGroupCount)
                     group = 0;
-                assert(0 <= group && group < kColliderGroupCount);
-                if (group != colliderComponent->Group)
-                {
-                    SkipListRemove(&colliderComponent->SkipListNode);  // 从原先的组脱离
-                    colliderComponent->Group = group;
-                    SkipListInsert(&(m_pColliderRoot->ColliderGroupTailers[group].SkipListNode), &colliderComponent->SkipListNode,
-                        ColliderSortFunction, m_stSkipListRandomizer);  // 插入新的组
-                }
+                SetColliderGroup(*colliderComponent, group);
             }
             return true;
         case ScriptObjectAttributes::Invisible:
@@ -986,16 +1394,11 @@ bool GameWorld::OnSetAttribute(LuaStack stack, ECS::EntityId id, std::string_vie
             if (!(scriptComponent = ent.TryGetComponent<Script>()))
                 return 0;
             assert(scriptComponent->Pool == &m_stScriptObjectPool);
-            m_stScriptObjectPool.PushScriptObject(stack, scriptComponent->ScriptObjectId);
-            if (stack.TypeOf(-1) == LUA_TNIL)
+            if (!m_stScriptObjectPool.SetScriptObjectClass(stack, scriptComponent->ScriptObjectId, value))
             {
                 assert(false);
-                stack.Pop(1);
                 return false;
             }
-            stack.PushValue(value);
-            stack.RawSet(-2, kIndexOfClassInObject);
-            stack.Pop(1);
             return true;
         case ScriptObjectAttributes::ColliderX:
             if (!(colliderComponent = ent.TryGetComponent<Collider>()))
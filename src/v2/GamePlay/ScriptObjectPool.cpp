@@ -38,6 +38,7 @@ namespace
 }
 
 static const size_t kMaxObjectCount = std::numeric_limits<uint16_t>::max();
+static const int kMaxRecycledTables = 4096;
 
 const char* v2::GamePlay::ToString(ScriptCallbackFunctions functions) noexcept
 {
@@ -91,12 +92,12 @@ ScriptObjectPool::ScriptObjectPool(Subsystem::Script::LuaState& state, IScriptOb
                     lua_settop(L, 2);  // t k
 
                     // 转换到 EntityID
-                    auto it = self->m_stEntityIdMapping.find(id);
-                    if (it == self->m_stEntityIdMapping.end())
+                    auto info = self->FindObject(id);
+                    if (!info)
                         luaL_error(L, "entity is already disposed, sid=%d", static_cast<int>(id));
 
                     // 调用 Bridge 方法
-                    return self->m_pBridge->OnGetAttribute(L, it->second, key);
+                    return self->m_pBridge->OnGetAttribute(L, info->EntityId, key);
                 },
             },
             {
@@ -113,12 +114,12 @@ ScriptObjectPool::ScriptObjectPool(Subsystem::Script::LuaState& state, IScriptOb
                     lua_settop(L, 3);  // t k v
 
                     // 转换到 EntityID
-                    auto it = self->m_stEntityIdMapping.find(id);
-                    if (it == self->m_stEntityIdMapping.end())
+                    auto info = self->FindObject(id);
+                    if (!info)
                         luaL_error(L, "entity is already disposed, sid=%d", static_cast<int>(id));
 
                     // 调用 Bridge 方法
-                    if (!self->m_pBridge->OnSetAttribute(L, it->second, key, LuaStack::AbsIndex(3)))
+                    if (!self->m_pBridge->OnSetAttribute(L, info->EntityId, key, LuaStack::AbsIndex(3)))
                         lua_rawset(L, 1);
                     return 0;
                 },
@@ -128,6 +129,10 @@ ScriptObjectPool::ScriptObjectPool(Subsystem::Script::LuaState& state, IScriptOb
         ::lua_pushlightuserdata(L, this);  // t t t p(this)
         ::luaL_setfuncs(L, methods, 1);  // t t t
         m_stObjectMetaTableRef = LuaReference(L, -1);
+
+        // 创建回收表
+        ::lua_createtable(L, 0, 0);  // t t t t
+        m_stRecycledTableRef = LuaReference(L, -1);
     }).ThrowIfError();
 }
 
@@ -143,6 +148,28 @@ ScriptObjectPool::~ScriptObjectPool()
     m_stState.RawSet(-1, "__index", nullptr_t{});
     m_stState.RawSet(-1, "__newindex", nullptr_t{});
     m_stState.Pop(1);
+
+    // 正常情况下所有对象均已释放
+    assert(m_stClassDispatchTables.empty());
+    m_stClassDispatchTables.clear();
+}
+
+void ScriptObjectPool::SetTableRecyclingEnabled(Subsystem::Script::LuaStack stack, bool enabled) noexcept
+{
+    m_bTableRecycling = enabled;
+    if (!enabled && m_iRecycledTables > 0)
+    {
+        // 丢弃缓存的对象表
+        lua_checkstack(stack, 2);
+        m_stRecycledTableRef.Push(stack);  // ... t(recycled)
+        for (int i = 1; i <= m_iRecycledTables; ++i)
+        {
+            stack.PushValue(nullptr_t {});  // ... t(recycled) n
+            stack.RawSet(-2, i);  // ... t(recycled)
+        }
+        stack.Pop(1);
+        m_iRecycledTables = 0;
+    }
 }
 
 Result<std::tuple<ScriptObjectId, Subsystem::Script::LuaStack::AbsIndex>> ScriptObjectPool::Alloc(Subsystem::Script::LuaStack stack,
@@ -157,19 +184,44 @@ Result<std::tuple<ScriptObjectId, Subsystem::Script::LuaStack::AbsIndex>> Script
         return make_error_code(errc::not_enough_memory);
     }
 
-    // 分配ID
-    auto scriptId = ++m_uNextObjectId;
-    try
+    // 绑定类分派表
+    auto classTable = AcquireClassDispatchTable(stack, classIndex);
+    if (!classTable)
+        return make_error_code(errc::not_enough_memory);
+
+    // 分配槽位
+    uint32_t slot;
+    if (m_uFreeSlotHead != kInvalidSlot)
     {
-        assert(m_stEntityIdMapping.find(scriptId) == m_stEntityIdMapping.end());
-        m_stEntityIdMapping.emplace(scriptId, id);
+        slot = m_uFreeSlotHead;
+        m_uFreeSlotHead = m_stObjectInfos[slot].NextFree;
+        if (m_uFreeSlotHead == kInvalidSlot)
+            m_uFreeSlotTail = kInvalidSlot;
     }
-    catch (...)  // bad_alloc
+    else
     {
-        LSTG_LOG_ERROR_CAT(ScriptObjectPool, "Alloc memory fail");
-        return make_error_code(errc::not_enough_memory);
+        assert(m_stObjectInfos.size() < kMaxObjectCount);
+        try
+        {
+            slot = static_cast<uint32_t>(m_stObjectInfos.size());
+            m_stObjectInfos.emplace_back();
+        }
+        catch (...)  // bad_alloc
+        {
+            LSTG_LOG_ERROR_CAT(ScriptObjectPool, "Alloc memory fail");
+            ReleaseClassDispatchTable(classTable);
+            return make_error_code(errc::not_enough_memory);
+        }
     }
 
+    auto& info = m_stObjectInfos[slot];
+    assert(!info.Used);
+    info.EntityId = id;
+    info.Class = classTable;
+    info.Used = true;
+    info.NextFree = kInvalidSlot;
+    auto scriptId = MakeScriptObjectId(slot, info.Generation);
+
     // 分配对象
     // FIXME: 这里的 lua 侧错误无法捕获进行处理
 #ifdef LSTG_DEVELOPMENT
@@ -177,8 +229,21 @@ Result<std::tuple<ScriptObjectId, Subsystem::Script::LuaStack::AbsIndex>> Script
 #endif
     lua_checkstack(stack, 3);
     stack.PushValue(m_stObjectTableRef);  // ... t(objectTable)
-    assert(!stack.RawHas(-1, static_cast<int>(scriptId)));
-    lua_createtable(stack, 2, 0);  // ... t(objectTable) t(object)
+    assert(!stack.RawHas(-1, GetObjectTableIndex(scriptId)));
+    if (m_iRecycledTables > 0)
+    {
+        m_stRecycledTableRef.Push(stack);  // ... t(objectTable) t(recycled)
+        stack.RawGet(-1, m_iRecycledTables);  // ... t(objectTable) t(recycled) t(object)
+        stack.PushValue(nullptr_t {});  // ... t(objectTable) t(recycled) t(object) n
+        stack.RawSet(-3, m_iRecycledTables);  // ... t(objectTable) t(recycled) t(object)
+        stack.Remove(-2);  // ... t(objectTable) t(object)
+        --m_iRecycledTables;
+        assert(stack.TypeOf(-1) == LUA_TTABLE);
+    }
+    else
+    {
+        lua_createtable(stack, 2, 0);  // ... t(objectTable) t(object)
+    }
     stack.PushValue(classIndex);  // ... t(objectTable) t(object) t(classTable)
     stack.RawSet(-2, kIndexOfClassInObject);  // ... t(objectTable) t(object)
     stack.PushValue(static_cast<int>(scriptId));  // ... t(objectTable) t(object) i(scriptId)
@@ -186,7 +251,7 @@ Result<std::tuple<ScriptObjectId, Subsystem::Script::LuaStack::AbsIndex>> Script
     stack.PushValue(m_stObjectMetaTableRef);  // ... t(objectTable) t(object) t(metaTable)
     ::lua_setmetatable(stack, -2);  // ... t(objectTable) t(object)
     ::lua_pushvalue(stack, -1);  // ... t(objectTable) t(object) t(object)
-    stack.RawSet(-3, static_cast<int>(scriptId));  // ... t(objectTable) t(object)
+    stack.RawSet(-3, GetObjectTableIndex(scriptId));  // ... t(objectTable) t(object)
     stack.Remove(-2);  // ... t(object)
 #ifdef LSTG_DEVELOPMENT
     assert(stack.GetTop() == top + 1);
@@ -202,30 +267,64 @@ void ScriptObjectPool::Free(Subsystem::Script::LuaStack stack, ScriptObjectId sc
     LuaStack::BalanceChecker checker(stack);
 #endif
 
-    // 释放ID
-    auto it = m_stEntityIdMapping.find(scriptId);
-    assert(it != m_stEntityIdMapping.end());
-    m_stEntityIdMapping.erase(it);
+    // 释放槽位，递增代数使旧 ID 失效
+    auto info = FindObject(scriptId);
+    assert(info);
+    ReleaseClassDispatchTable(info->Class);
+    info->Class = nullptr;
+    info->Used = false;
+    info->Generation = (info->Generation >= kMaxGeneration) ? 1 : static_cast<uint16_t>(info->Generation + 1);
+    auto slot = static_cast<uint32_t>(info - m_stObjectInfos.data());
+    if (m_uFreeSlotTail != kInvalidSlot)
+        m_stObjectInfos[m_uFreeSlotTail].NextFree = slot;
+    else
+        m_uFreeSlotHead = slot;
+    m_uFreeSlotTail = slot;
 
     // 从 Lua 表删除
-    lua_checkstack(stack, 2);
+    auto index = GetObjectTableIndex(scriptId);
+    lua_checkstack(stack, 4);
     stack.PushValue(m_stObjectTableRef);  // ... t(objectTable)
-    assert(stack.RawHas(-1, static_cast<int>(scriptId)));
-    stack.PushValue(nullptr_t {});  // ... t(objectTable) n
-    stack.RawSet(-2, static_cast<int>(scriptId));  // ... t(objectTable)
-    stack.Pop(1);
+    assert(stack.RawHas(-1, index));
+    stack.RawGet(-1, index);  // ... t(objectTable) t(object)
+    stack.PushValue(nullptr_t {});  // ... t(objectTable) t(object) n
+    stack.RawSet(-3, index);  // ... t(objectTable) t(object)
+
+    // 清空后放入回收表，保留已经分配的哈希部分
+    if (m_bTableRecycling && m_iRecycledTables < kMaxRecycledTables && stack.TypeOf(-1) == LUA_TTABLE)
+    {
+        stack.PushValue(nullptr_t {});  // ... t(objectTable) t(object) n
+        while (::lua_next(stack, -2) != 0)  // ... t(objectTable) t(object) k v
+        {
+            stack.Pop(1);  // ... t(objectTable) t(object) k
+            ::lua_pushvalue(stack, -1);  // ... t(objectTable) t(object) k k
+            stack.PushValue(nullptr_t {});  // ... t(objectTable) t(object) k k n
+            ::lua_rawset(stack, -4);  // ... t(objectTable) t(object) k
+        }
+        m_stRecycledTableRef.Push(stack);  // ... t(objectTable) t(object) t(recycled)
+        ::lua_insert(stack, -2);  // ... t(objectTable) t(recycled) t(object)
+        stack.RawSet(-2, ++m_iRecycledTables);  // ... t(objectTable) t(recycled)
+    }
+    stack.Pop(2);
 
     --m_uCurrentObjects;
 }
 
 void ScriptObjectPool::PushScriptObject(Subsystem::Script::LuaStack stack, ScriptObjectId scriptId) noexcept
 {
+    // 失效的 ID 对应的槽位可能已经被复用
+    if (!FindObject(scriptId))
+    {
+        stack.PushValue(nullptr_t {});  // ... n
+        return;
+    }
+
     // 获取对象
     stack.PushValue(m_stObjectTableRef);  // ... t(objectTable)
     assert(stack.TypeOf(-1) == LUA_TTABLE);
-    stack.RawGet(-1, static_cast<int>(scriptId));  // ...t(objectTable) t(object)
+    stack.RawGet(-1, GetObjectTableIndex(scriptId));  // ...t(objectTable) t(object)
     stack.Remove(-2);  // ... t(object)
-    assert(stack.TypeOf(-1) == LUA_TTABLE || stack.TypeOf(-1) == LUA_TNIL);
+    assert(stack.TypeOf(-1) == LUA_TTABLE);
 }
 
 ScriptCallbackInvokeResult ScriptObjectPool::InvokeCallback(Subsystem::Script::LuaStack stack, ScriptObjectId scriptId,
@@ -236,41 +335,48 @@ ScriptCallbackInvokeResult ScriptObjectPool::InvokeCallback(Subsystem::Script::L
 #endif
 
     // 获取对象
-    lua_checkstack(stack, 5);
-    PushScriptObject(stack, static_cast<int>(scriptId));  // ... {args...} t(object)
-    if (stack.TypeOf(-1) != LUA_TTABLE)
+    auto info = FindObject(scriptId);
+    if (!info)
     {
         LSTG_LOG_ERROR_CAT(ScriptObjectPool, "Entity is already disposed, sid={}", scriptId);
-        lua_pop(stack, args + 1);
+        lua_pop(stack, args);
         return ScriptCallbackInvokeResult::Disposed;
     }
-    stack.RawGet(-1, kIndexOfClassInObject);  // ... {args...} t(object) t(class)
-    if (stack.TypeOf(-1) != LUA_TTABLE)
+    auto classTable = info->Class;
+    if (!classTable)
     {
-        LSTG_LOG_ERROR_CAT(ScriptObjectPool, "Invalid class object, sid={}, type={}", scriptId, stack.TypeOf(-1));
-        lua_pop(stack, args + 2);
+        LSTG_LOG_ERROR_CAT(ScriptObjectPool, "Invalid class object, sid={}", scriptId);
+        lua_pop(stack, args);
         return ScriptCallbackInvokeResult::InvalidClass;
     }
-    stack.RawGet(-1, static_cast<int>(callback));  // ... {args...} t(object) t(class) f(callback)
-    if (stack.TypeOf(-1) == LUA_TNIL)
+
+    // 从类上取回调，同时刷新对应的缓存项
+    auto slot = static_cast<unsigned>(callback) - 1;
+    lua_checkstack(stack, 5);
+    classTable->ClassRef.Push(stack);  // ... {args...} t(class)
+    stack.RawGet(-1, static_cast<int>(callback));  // ... {args...} t(class) f(callback)
+    stack.Remove(-2);  // ... {args...} f(callback)
+    UpdateCallbackSlot(stack, *classTable, slot);
+    if ((classTable->DefinedMask & (1u << slot)) == 0)
     {
-        lua_pop(stack, args + 3);
+        lua_pop(stack, args + 1);
         return ScriptCallbackInvokeResult::CallbackNotDefined;
     }
-    else if (stack.TypeOf(-1) != LUA_TFUNCTION)
+    else if ((classTable->FunctionMask & (1u << slot)) == 0)
     {
         LSTG_LOG_ERROR_CAT(ScriptObjectPool, "Attempt to call non-function callback \"{}\" on entity, sid={}", ToString(callback),
             scriptId);
-        lua_pop(stack, args + 3);
+        lua_pop(stack, args + 1);
         return ScriptCallbackInvokeResult::InvalidCallback;
     }
 
     // 准备调用
     auto top = stack.GetTop();
-    assert(top >= args + 3u);
-    stack.Insert(top - (args + 3u - 1u));  // ... f(callback) {args...} t(object) t(class)
-    lua_pop(stack, 1);  // ... f(callback) {args...} t(object)
-    stack.Insert((top - 1u) - (args + 1u - 1u));  // ... f(callback) t(object) {args...}
+    assert(top >= args + 1u);
+    stack.Insert(top - args);  // ... f(callback) {args...}
+    PushScriptObject(stack, scriptId);  // ... f(callback) {args...} t(object)
+    assert(stack.TypeOf(-1) == LUA_TTABLE);
+    stack.Insert(top - args + 1);  // ... f(callback) t(object) {args...}
     auto ret = stack.ProtectedCallWithTraceback(args + 1, 0);  // ...
     if (!ret)
     {
@@ -286,10 +392,212 @@ ScriptCallbackInvokeResult ScriptObjectPool::InvokeCallback(Subsystem::Script::L
     return ScriptCallbackInvokeResult::Ok;
 }
 
+bool ScriptObjectPool::IsCallbackDefined(ScriptObjectId scriptId, ScriptCallbackFunctions callback) const noexcept
+{
+    auto info = FindObject(scriptId);
+    if (!info || !info->Class)
+        return true;  // 交由 InvokeCallback 报告错误
+    auto slot = static_cast<unsigned>(callback) - 1;
+    return (info->Class->DefinedMask & (1u << slot)) != 0;
+}
+
+bool ScriptObjectPool::SetScriptObjectClass(Subsystem::Script::LuaStack stack, ScriptObjectId scriptId,
+    Subsystem::Script::LuaStack::AbsIndex classIndex) noexcept
+{
+#ifdef LSTG_DEVELOPMENT
+    LuaStack::BalanceChecker checker(stack);
+#endif
+
+    auto info = FindObject(scriptId);
+    if (!info)
+        return false;
+
+    // 写入对象
+    lua_checkstack(stack, 2);
+    PushScriptObject(stack, scriptId);  // ... t(object)
+    assert(stack.TypeOf(-1) == LUA_TTABLE);
+    stack.PushValue(classIndex);  // ... t(object) t(class)
+    stack.RawSet(-2, kIndexOfClassInObject);  // ... t(object)
+    stack.Pop(1);
+
+    // 重新绑定分派表，新的类不是 table 时调用回调会报告 InvalidClass
+    auto classTable = (stack.TypeOf(classIndex) == LUA_TTABLE) ? AcquireClassDispatchTable(stack, classIndex) : nullptr;
+    ReleaseClassDispatchTable(info->Class);
+    info->Class = classTable;
+    return true;
+}
+
 std::optional<ECS::EntityId> ScriptObjectPool::GetEntityId(ScriptObjectId scriptObjectId) noexcept
 {
-    auto it = m_stEntityIdMapping.find(scriptObjectId);
-    if (it == m_stEntityIdMapping.end())
+    auto info = FindObject(scriptObjectId);
+    if (!info)
         return nullopt;
-    return it->second;
+    return info->EntityId;
+}
+
+ScriptObjectPool::ScriptObjectInfo* ScriptObjectPool::FindObject(ScriptObjectId scriptId) noexcept
+{
+    auto slot = scriptId & kSlotMask;
+    if (slot >= m_stObjectInfos.size())
+        return nullptr;
+    auto& info = m_stObjectInfos[slot];
+    if (!info.Used || info.Generation != (scriptId >> kSlotBits))
+        return nullptr;
+    return &info;
 }
+
+const ScriptObjectPool::ScriptObjectInfo* ScriptObjectPool::FindObject(ScriptObjectId scriptId) const noexcept
+{
+    return const_cast<ScriptObjectPool*>(this)->FindObject(scriptId);
+}
+
+ScriptObjectPool::ClassDispatchTable* ScriptObjectPool::AcquireClassDispatchTable(Subsystem::Script::LuaStack stack,
+    Subsystem::Script::LuaStack::AbsIndex classIndex) noexcept
+{
+    assert(stack.TypeOf(classIndex) == LUA_TTABLE);
+    auto key = ::lua_topointer(stack, static_cast<int>(classIndex.Index));
+
+    auto it = m_stClassDispatchTables.find(key);
+    if (it != m_stClassDispatchTables.end())
+    {
+        ++it->second->BindingObjects;
+        return it->second.get();
+    }
+
+    // 首次见到该类，建立分派表
+    try
+    {
+        auto table = make_unique<ClassDispatchTable>();
+        table->Key = key;
+        table->ClassRef = LuaReference(stack, static_cast<int>(classIndex.Index));
+        SyncClassDispatchTable(stack, *table);
+        table->BindingObjects = 1;
+        auto ret = m_stClassDispatchTables.emplace(key, std::move(table));
+        return ret.first->second.get();
+    }
+    catch (...)  // bad_alloc
+    {
+        LSTG_LOG_ERROR_CAT(ScriptObjectPool, "Alloc memory fail");
+        return nullptr;
+    }
+}
+
+void ScriptObjectPool::ReleaseClassDispatchTable(ClassDispatchTable* table) noexcept
+{
+    if (!table)
+        return;
+
+    assert(table->BindingObjects > 0);
+    if (--table->BindingObjects > 0)
+        return;
+
+    // 没有对象引用时释放，防止动态创建的类无法被回收
+    auto it = m_stClassDispatchTables.find(table->Key);
+    assert(it != m_stClassDispatchTables.end() && it->second.get() == table);
+    m_stClassDispatchTables.erase(it);
+}
+
+void ScriptObjectPool::SyncClassDispatchTable(Subsystem::Script::LuaStack stack, ClassDispatchTable& table) noexcept
+{
+    lua_checkstack(stack, 2);
+    table.ClassRef.Push(stack);  // t(class)
+    assert(stack.TypeOf(-1) == LUA_TTABLE);
+    for (unsigned i = 0; i < kScriptCallbackFunctionCount; ++i)
+    {
+        stack.RawGet(-1, static_cast<int>(i + 1));  // t(class) v
+        UpdateCallbackSlot(stack, table, i);
+        stack.Pop(1);  // t(class)
+    }
+    stack.Pop(1);
+}
+
+void ScriptObjectPool::UpdateCallbackSlot(Subsystem::Script::LuaStack stack, ClassDispatchTable& table, unsigned slot) noexcept
+{
+    assert(slot < kScriptCallbackFunctionCount);
+
+    // 值位于栈顶，函数按地址判断是否被替换
+    auto type = stack.TypeOf(-1);
+    auto identity = (type == LUA_TFUNCTION) ? ::lua_topointer(stack, -1) : nullptr;
+    auto bit = static_cast<uint8_t>(1u << slot);
+    auto defined = (type != LUA_TNIL);
+    if (identity == table.CallbackIdentities[slot] && defined == ((table.DefinedMask & bit) != 0))
+        return;
+
+    table.CallbackIdentities[slot] = identity;
+    table.DefinedMask = static_cast<uint8_t>(defined ? (table.DefinedMask | bit) : (table.DefinedMask & ~bit));
+    if (identity)
+    {
+        table.FunctionMask |= bit;
+        table.Callbacks[slot] = LuaReference(stack, -1);
+    }
+    else
+    {
+        table.FunctionMask = static_cast<uint8_t>(table.FunctionMask & ~bit);
+        table.Callbacks[slot].Reset();
+    }
+}
+
+// <editor-fold desc="ScriptCallbackBatch">
+
+ScriptCallbackBatch::ScriptCallbackBatch(ScriptObjectPool& pool, ScriptCallbackFunctions callback) noexcept
+    : m_stPool(pool), m_iCallback(callback), m_stStack(pool.GetState())
+{
+    // 同步类缓存，类的数量远少于对象，每批只需要做一次
+    for (auto& p : m_stPool.m_stClassDispatchTables)
+        m_stPool.SyncClassDispatchTable(m_stStack, *p.second);
+
+    lua_checkstack(m_stStack, 4);
+    lua_pushcfunction(m_stStack, Subsystem::Script::detail::PCallErrorHandler);  // f(handler)
+    m_iBase = lua_gettop(m_stStack);
+    m_stPool.m_stObjectTableRef.Push(m_stStack);  // f(handler) t(objectTable)
+}
+
+ScriptCallbackBatch::~ScriptCallbackBatch()
+{
+    assert(lua_gettop(m_stStack) == m_iBase + 1);
+    lua_pop(m_stStack, 2);
+}
+
+ScriptCallbackInvokeResult ScriptCallbackBatch::Invoke(ScriptObjectId scriptId) noexcept
+{
+    auto info = m_stPool.FindObject(scriptId);
+    if (!info)
+    {
+        LSTG_LOG_ERROR_CAT(ScriptObjectPool, "Entity is already disposed, sid={}", scriptId);
+        return ScriptCallbackInvokeResult::Disposed;
+    }
+    auto classTable = info->Class;
+    if (!classTable)
+    {
+        LSTG_LOG_ERROR_CAT(ScriptObjectPool, "Invalid class object, sid={}", scriptId);
+        return ScriptCallbackInvokeResult::InvalidClass;
+    }
+
+    // 未定义回调时不访问 Lua 栈
+    auto slot = static_cast<unsigned>(m_iCallback) - 1;
+    if ((classTable->DefinedMask & (1u << slot)) == 0)
+        return ScriptCallbackInvokeResult::CallbackNotDefined;
+    if ((classTable->FunctionMask & (1u << slot)) == 0)
+    {
+        LSTG_LOG_ERROR_CAT(ScriptObjectPool, "Attempt to call non-function callback \"{}\" on entity, sid={}", ToString(m_iCallback),
+            scriptId);
+        return ScriptCallbackInvokeResult::InvalidCallback;
+    }
+
+    assert(lua_gettop(m_stStack) == m_iBase + 1);
+    classTable->Callbacks[slot].Push(m_stStack);  // f(handler) t(objectTable) f(callback)
+    auto index = ScriptObjectPool::GetObjectTableIndex(scriptId);
+    ::lua_rawgeti(m_stStack, m_iBase + 1, index);  // f(handler) t(objectTable) f(callback) t(object)
+    assert(lua_type(m_stStack, -1) == LUA_TTABLE);
+    auto ret = ::lua_pcall(m_stStack, 1, 0, m_iBase);  // f(handler) t(objectTable)
+    if (ret != 0)
+    {
+        LSTG_LOG_ERROR_CAT(ScriptObjectPool, "Uncaught error in callback \"{}\" on entity {}: {}", ToString(m_iCallback), scriptId,
+            lua_tostring(m_stStack, -1));
+        lua_pop(m_stStack, 1);
+        return ScriptCallbackInvokeResult::CallError;
+    }
+    return ScriptCallbackInvokeResult::Ok;
+}
+
+// </editor-fold>
@@ -0,0 +1,294 @@
+#!env python3
+# -*- coding: utf-8 -*-
+# 此文件为 LuaSTGPlus 项目的一部分，版权与许可声明详见 COPYRIGHT.txt。
+"""
+资源束打包工具
+
+将一个关卡所需的全部资产按照清单打包为单个资源束文件，运行时通过 LoadBundle 一次性挂载并创建所有资产。
+ - 文件数据不压缩并按 16 字节对齐，文件表按路径排序，运行时无需构建目录树
+ - 纹理调用 TextureBakeTool 预先烘焙为 DDS/KTX2，运行时直接使用其中的像素数据
+ - 音效可选地通过 ffmpeg 预先解码为 PCM WAV，运行时无需再解码压缩格式
+ - 精灵、动画、粒子等定义被预先转换为定长的二进制记录
+
+清单为 JSON 文件，格式如下（字段含义与同名脚本接口一致，路径相对于资产根目录）：
+{
+    "assets": [
+        { "type": "texture", "name": "tex", "path": "stage1/tex.png", "mipmap": false },
+        { "type": "image", "name": "img", "texture": "tex", "x": 0, "y": 0, "w": 16, "h": 16, "a": 4, "b": 4, "rect": false },
+        { "type": "animation", "name": "ani", "texture": "tex", "x": 0, "y": 0, "w": 16, "h": 16, "n": 4, "m": 1, "interval": 4 },
+        { "type": "particle", "name": "ps", "path": "stage1/ps.psi", "image": "img" },
+        { "type": "font", "name": "fnt", "path": "stage1/font.fnt", "mipmap": true },
+        { "type": "ttf", "name": "ttf", "path": "stage1/font.ttf", "width": 20 },
+        { "type": "sound", "name": "se", "path": "stage1/se.ogg" },
+        { "type": "music", "name": "bgm", "path": "stage1/bgm.ogg", "end": 120.0, "loop": 100.0 },
+        { "type": "fx", "name": "fx", "path": "stage1/fx.lua" }
+    ],
+    "files": [ "stage1/fx_common.hlsl" ]
+}
+"""
+import os
+import sys
+import json
+import struct
+import shutil
+import argparse
+import tempfile
+import subprocess
+
+# <editor-fold desc="格式定义">
+
+BUNDLE_MAGIC = b"LSTGBDL\0"
+BUNDLE_VERSION = 1
+BUNDLE_ALIGNMENT = 16
+BUNDLE_HEADER = struct.Struct("<8sIIQQ")
+BUNDLE_FILE_ENTRY = struct.Struct("<QQqII")
+
+MANIFEST_PATH = ".manifest"
+MANIFEST_MAGIC = b"LSAM"
+MANIFEST_VERSION = 1
+MANIFEST_HEADER = struct.Struct("<4sIII")
+MANIFEST_RECORD = struct.Struct("<IIIII4f3i2d")
+NO_STRING = 0xFFFFFFFF
+
+FLAG_MIPMAPS = 1
+FLAG_COLLIDER_IS_RECT = 2
+
+# 类型名: (AssetTypes 枚举值, 创建顺序)
+# 被引用的资产需要先于引用方创建：精灵、动画引用纹理，粒子引用精灵
+ASSET_TYPES = {
+    "texture": (1, 0),
+    "image": (2, 1),
+    "animation": (3, 1),
+    "music": (4, 0),
+    "sound": (5, 0),
+    "particle": (6, 2),
+    "font": (7, 0),
+    "ttf": (8, 0),
+    "fx": (9, 0),
+}
+
+assert BUNDLE_HEADER.size == 32
+assert BUNDLE_FILE_ENTRY.size == 32
+assert MANIFEST_HEADER.size == 16
+assert MANIFEST_RECORD.size == 64
+
+# </editor-fold>
+
+
+def normalize_path(path):
+    path = path.replace("\\", "/")
+    parts = []
+    for part in path.split("/"):
+        if part == "" or part == ".":
+            continue
+        if part == "..":
+            if not parts:
+                raise ValueError("Path '%s' escapes asset root" % path)
+            parts.pop()
+            continue
+        parts.append(part)
+    return "/".join(parts)
+
+
+class StringTable:
+    def __init__(self):
+        self.data = bytearray()
+        self.offsets = {}
+
+    def add(self, s):
+        if s is None:
+            return NO_STRING
+        if s not in self.offsets:
+            self.offsets[s] = len(self.data)
+            self.data += s.encode("utf-8") + b"\0"
+        return self.offsets[s]
+
+
+class BundleBuilder:
+    def __init__(self, args):
+        self.args = args
+        self.files = {}  # 包内路径 -> (数据, 修改时间)
+
+    def add_file(self, path):
+        path = normalize_path(path)
+        if path in self.files:
+            return path
+        source = os.path.join(self.args.input, path)
+        with open(source, "rb") as f:
+            self.files[path] = (f.read(), int(os.path.getmtime(source)))
+        return path
+
+    def add_data(self, path, data, mtime):
+        self.files[normalize_path(path)] = (data, mtime)
+
+    def add_texture(self, path, mipmaps):
+        path = self.add_file(path)
+        if self.args.no_bake:
+            return path
+
+        # 运行时优先查找同名的 .dds/.ktx2，因此只需将烘焙结果以相应的文件名放入资源束
+        baker = load_texture_bake_tool()
+        container, fmt = baker.PLATFORM_DEFAULTS[self.args.platform]
+        target = baker.baked_name(path, container)
+        if target not in self.files:
+            data, mtime = self.files[path]
+            self.add_data(target, baker.bake(data, container, fmt, mipmaps), mtime)
+            print("%s -> %s" % (path, target))
+        return path
+
+    def add_sound(self, path):
+        path = normalize_path(path)
+        if self.args.no_pcm or os.path.splitext(path)[1].lower() == ".wav" or shutil.which("ffmpeg") is None:
+            return self.add_file(path)
+
+        # 音效在加载时总是被整体解码，预先转换为 PCM 可以省去运行时的解码开销
+        target = os.path.splitext(path)[0] + ".wav"
+        source = os.path.join(self.args.input, path)
+        with tempfile.TemporaryDirectory() as tmp:
+            output = os.path.join(tmp, "out.wav")
+            ret = subprocess.run(["ffmpeg", "-v", "error", "-y", "-i", source, "-acodec", "pcm_s16le", output])
+            if ret.returncode != 0 or os.path.getsize(output) > self.args.max_pcm_size:
+                return self.add_file(path)
+            with open(output, "rb") as f:
+                self.add_data(target, f.read(), int(os.path.getmtime(source)))
+        print("%s -> %s" % (path, target))
+        return target
+
+    def add_font(self, path):
+        path = self.add_file(path)
+
+        # HGE 字体在同级目录中寻找纹理
+        data, _ = self.files[path]
+        for line in data.decode("utf-8", errors="ignore").splitlines():
+            if line.strip().lower().startswith("bitmap="):
+                bitmap = line.split("=", 1)[1].strip()
+                self.add_file(os.path.join(os.path.dirname(path), bitmap))
+                break
+        return path
+
+    def write(self, output):
+        entries = sorted(self.files.items(), key=lambda x: x[0].encode("utf-8"))
+
+        paths = bytearray()
+        path_offsets = []
+        for path, _ in entries:
+            encoded = path.encode("utf-8")
+            path_offsets.append((len(paths), len(encoded)))
+            paths += encoded
+
+        index_size = len(entries) * BUNDLE_FILE_ENTRY.size + len(paths)
+        offset = align(BUNDLE_HEADER.size + index_size)
+        table = bytearray()
+        for (path, (data, mtime)), (path_offset, path_length) in zip(entries, path_offsets):
+            table += BUNDLE_FILE_ENTRY.pack(offset, len(data), mtime, path_offset, path_length)
+            offset = align(offset + len(data))
+
+        with open(output, "wb") as f:
+            f.write(BUNDLE_HEADER.pack(BUNDLE_MAGIC, BUNDLE_VERSION, len(entries), index_size, 0))
+            f.write(table)
+            f.write(paths)
+            for _, (data, _) in entries:
+                f.write(b"\0" * (align(f.tell()) - f.tell()))
+                f.write(data)
+
+
+def align(offset):
+    return (offset + BUNDLE_ALIGNMENT - 1) // BUNDLE_ALIGNMENT * BUNDLE_ALIGNMENT
+
+
+def load_texture_bake_tool():
+    tool_dir = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "TextureBakeTool")
+    if tool_dir not in sys.path:
+        sys.path.insert(0, tool_dir)
+    import TextureBakeTool
+    return TextureBakeTool
+
+
+def build_record(builder, strings, asset):
+    t = asset["type"]
+    if t not in ASSET_TYPES:
+        raise ValueError("Unknown asset type '%s'" % t)
+
+    flags = 0
+    path = None
+    reference = None
+    rect = (0., 0., 0., 0.)
+    params = (0, 0, 0)
+    a = float(asset.get("a", 0.))
+    collider = (a, float(asset.get("b", a)))
+    if asset.get("rect", False):
+        flags |= FLAG_COLLIDER_IS_RECT
+
+    if t == "texture":
+        if asset.get("mipmap", False):
+            flags |= FLAG_MIPMAPS
+        path = builder.add_texture(asset["path"], bool(flags & FLAG_MIPMAPS))
+    elif t == "image":
+        reference = asset["texture"]
+        rect = (asset["x"], asset["y"], asset["w"], asset["h"])
+    elif t == "animation":
+        reference = asset["texture"]
+        rect = (asset["x"], asset["y"], asset["w"], asset["h"])
+        params = (asset["m"], asset["n"], asset["interval"])  # 同 LoadAnimation，Row 取 m、Column 取 n
+    elif t == "particle":
+        reference = asset["image"]
+        path = builder.add_file(asset["path"])
+    elif t == "font":
+        if asset.get("mipmap", True):
+            flags |= FLAG_MIPMAPS
+        path = builder.add_font(asset["path"])
+    elif t == "ttf":
+        width = asset.get("width", 0)
+        size = int(asset.get("height", 0)) if width == 0 else int(width)
+        params = (min(max(size, 1), 100), 0, 0)
+        path = builder.add_file(asset["path"])
+    elif t == "sound":
+        path = builder.add_sound(asset["path"])
+    elif t == "music":
+        end = float(asset["end"])
+        loop = float(asset["loop"])
+        params = (int(max(0., end - loop) * 1000), int(end * 1000), 0)
+        path = builder.add_file(asset["path"])
+    elif t == "fx":
+        path = builder.add_file(asset["path"])
+
+    return MANIFEST_RECORD.pack(ASSET_TYPES[t][0], flags, strings.add(asset["name"]), strings.add(path), strings.add(reference),
+                                *[float(x) for x in rect], *[int(x) for x in params], *collider)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Pack assets listed in a manifest into a single bundle file")
+    parser.add_argument("-i", "--input", required=True, type=str, help="Asset root directory")
+    parser.add_argument("-m", "--manifest", required=True, type=str, help="Manifest file (json)")
+    parser.add_argument("-o", "--output", required=True, type=str, help="Output bundle file")
+    parser.add_argument("-p", "--platform", default="desktop", choices=["desktop", "mobile", "web"],
+                        help="Target platform, determines baked texture container and format")
+    parser.add_argument("--no-bake", action="store_true", help="Do not bake textures")
+    parser.add_argument("--no-pcm", action="store_true", help="Do not decode sounds into PCM")
+    parser.add_argument("--max-pcm-size", type=int, default=4 * 1024 * 1024,
+                        help="Keep the original sound file if the decoded PCM is larger than this size (bytes)")
+
+    args = parser.parse_args()
+
+    with open(args.manifest, "r", encoding="utf-8") as f:
+        manifest = json.load(f)
+
+    builder = BundleBuilder(args)
+    for path in manifest.get("files", []):
+        builder.add_file(path)
+
+    # 稳定排序，保证被引用的资产先创建
+    assets = sorted(manifest.get("assets", []), key=lambda x: ASSET_TYPES.get(x.get("type"), (0, 0))[1])
+    strings = StringTable()
+    records = bytearray()
+    for asset in assets:
+        records += build_record(builder, strings, asset)
+
+    builder.add_data(MANIFEST_PATH, MANIFEST_HEADER.pack(MANIFEST_MAGIC, MANIFEST_VERSION, len(assets), len(strings.data)) +
+                     records + strings.data, int(os.path.getmtime(args.manifest)))
+    builder.write(args.output)
+    print("%d asset(s), %d file(s) packed into %s" % (len(assets), len(builder.files), args.output))
+
+
+if __name__ == "__main__":
+    main()
@@ -624,7 +624,8 @@ def main():
                 f.write(f'            .End()\n')
             for method_name in methods:
                 method = methods[method_name]
-                f.write(f'        .Put("{method[0]}", &{native_class}::{method[1]})\n')
+                # 模块方法总是静态函数，使用编译期绑定的包装，参见 StaticFunction（原生 lua_CFunction 由 LuaPush 原样推入）
+                f.write(f'        .Put("{method[0]}", lstg::Subsystem::Script::StaticFunction<&{native_class}::{method[1]}>{{}})\n')
             f.write('    ;\n\n')
         # 强制注册所有类对象
         for name in header_parser.get_classes():
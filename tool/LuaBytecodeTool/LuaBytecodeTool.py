@@ -0,0 +1,117 @@
+#!env python3
+# -*- coding: utf-8 -*-
+# 此文件为 LuaSTGPlus 项目的一部分，版权与许可声明详见 COPYRIGHT.txt。
+"""
+Lua 字节码预编译工具
+
+将资源包（目录或 zip）中的 .lua 脚本通过 `luajit -b` 预编译为字节码，输出文件与源文件同名。
+运行时 luaL_loadbuffer 会根据首字节自动识别字节码，require / import / DoFile 无需任何修改，同时跳过 BytecodeCache。
+
+注意：
+ - 字节码与 LuaJIT 版本及 GC64 等编译选项相关，需要使用与引擎相同版本、相同配置构建的 luajit
+ - 默认剥离调试信息，此时运行时使用加载方提供的块名称；使用 -g 保留行号等调试信息
+"""
+import os
+import sys
+import shutil
+import zipfile
+import argparse
+import tempfile
+import subprocess
+
+BYTECODE_PREFIX = b"\x1b"
+
+
+def chunk_name(path):
+    # 与 ScriptSystem 中的加载器保持一致：require("a/b") 对应 "@a/b"
+    name = path.replace(os.sep, "/")
+    if name.lower().endswith(".lua"):
+        name = name[:-4]
+    return "@" + name
+
+
+def compile_source(args, source, name):
+    if source.startswith(BYTECODE_PREFIX):
+        return None  # 已经是字节码
+    with tempfile.TemporaryDirectory() as tmp:
+        src_path = os.path.join(tmp, "input.lua")
+        dst_path = os.path.join(tmp, "output.out")
+        with open(src_path, "wb") as f:
+            f.write(source)
+        command = [args.luajit, "-b", "-g" if args.debug else "-s", "-n", name, src_path, dst_path]
+        ret = subprocess.run(command, stdout=subprocess.PIPE, stderr=subprocess.STDOUT)
+        if ret.returncode != 0:
+            raise RuntimeError("Fail to compile '%s': %s" % (name, ret.stdout.decode("utf-8", "replace").strip()))
+        with open(dst_path, "rb") as f:
+            return f.read()
+
+
+def precompile_directory(args):
+    count = 0
+    for root, _, files in os.walk(args.input):
+        for filename in files:
+            src = os.path.join(root, filename)
+            rel = os.path.relpath(src, args.input)
+            dst = os.path.join(args.output, rel)
+            os.makedirs(os.path.dirname(dst), exist_ok=True)
+            if os.path.splitext(filename)[1].lower() != ".lua":
+                shutil.copy2(src, dst)
+                continue
+            if not args.force and os.path.exists(dst) and os.path.getmtime(dst) >= os.path.getmtime(src):
+                continue  # 目标比源文件新
+            with open(src, "rb") as f:
+                bytecode = compile_source(args, f.read(), chunk_name(rel))
+            if bytecode is None:
+                shutil.copy2(src, dst)
+                continue
+            with open(dst, "wb") as f:
+                f.write(bytecode)
+            count += 1
+            print("%s -> %s" % (rel, dst))
+    return count
+
+
+def precompile_zip(args):
+    count = 0
+    with zipfile.ZipFile(args.input, "r") as zin, zipfile.ZipFile(args.output, "w", zipfile.ZIP_DEFLATED) as zout:
+        for info in zin.infolist():
+            data = zin.read(info.filename)
+            if not info.is_dir() and os.path.splitext(info.filename)[1].lower() == ".lua":
+                bytecode = compile_source(args, data, chunk_name(info.filename))
+                if bytecode is not None:
+                    data = bytecode
+                    count += 1
+                    print(info.filename)
+            zout.writestr(info, data)
+    return count
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Precompile lua scripts in an asset pack into LuaJIT bytecode")
+    parser.add_argument("-i", "--input", required=True, type=str, help="Asset pack directory or zip file")
+    parser.add_argument("-o", "--output", required=True, type=str, help="Output directory or zip file")
+    parser.add_argument("-l", "--luajit", default="luajit", type=str, help="LuaJIT executable, must match the engine build")
+    parser.add_argument("-g", "--debug", action="store_true", help="Keep debug information")
+    parser.add_argument("--force", action="store_true", help="Recompile even if target is newer than source")
+
+    args = parser.parse_args()
+    if os.path.abspath(args.input) == os.path.abspath(args.output):
+        print("Output must not be the same as input", file=sys.stderr)
+        sys.exit(1)
+
+    try:
+        if os.path.isdir(args.input):
+            count = precompile_directory(args)
+        elif zipfile.is_zipfile(args.input):
+            count = precompile_zip(args)
+        else:
+            print("Input '%s' is neither a directory nor a zip file" % args.input, file=sys.stderr)
+            sys.exit(1)
+    except (RuntimeError, OSError) as ex:
+        print(ex, file=sys.stderr)
+        sys.exit(1)
+    print("%d script(s) precompiled" % count)
+
+
+if __name__ == "__main__":
+    main()
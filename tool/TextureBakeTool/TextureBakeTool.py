@@ -0,0 +1,363 @@
+#!env python3
+# -*- coding: utf-8 -*-
+# 此文件为 LuaSTGPlus 项目的一部分，版权与许可声明详见 COPYRIGHT.txt。
+"""
+纹理烘焙工具
+
+将资源包（目录或 zip）中的 PNG 转换为包含预计算 Mipmap 的 DDS/KTX2 容器，输出文件与源文件同名、扩展名不同。
+运行时 BasicTexture2DAssetLoader 会按照平台偏好优先加载 .dds/.ktx2，设备不支持对应格式时回退到源文件。
+
+依赖 Pillow 与 numpy。
+"""
+import os
+import sys
+import struct
+import zipfile
+import argparse
+
+try:
+    import numpy as np
+    from PIL import Image
+except ImportError:
+    print("Pillow and numpy are required, try `pip install pillow numpy`", file=sys.stderr)
+    sys.exit(1)
+
+
+# <editor-fold desc="格式定义">
+
+FORMAT_RGBA8 = "rgba8"
+FORMAT_BC1 = "bc1"
+FORMAT_BC3 = "bc3"
+
+# (DXGI_FORMAT, VkFormat, 块大小, 块字节数)
+FORMAT_INFO = {
+    FORMAT_RGBA8: (29, 43, 1, 4),  # R8G8B8A8_UNORM_SRGB / VK_FORMAT_R8G8B8A8_SRGB
+    FORMAT_BC1: (72, 132, 4, 8),  # BC1_UNORM_SRGB / VK_FORMAT_BC1_RGB_SRGB_BLOCK
+    FORMAT_BC3: (78, 138, 4, 16),  # BC3_UNORM_SRGB / VK_FORMAT_BC3_SRGB_BLOCK
+}
+
+PLATFORM_DEFAULTS = {
+    # 平台: (容器, 格式)
+    "desktop": ("dds", "auto"),
+    "mobile": ("ktx2", FORMAT_RGBA8),
+    "web": ("ktx2", FORMAT_RGBA8),
+}
+
+# </editor-fold>
+
+# <editor-fold desc="Mipmap">
+
+
+def srgb_to_linear(c):
+    return np.where(c <= 0.04045, c / 12.92, ((c + 0.055) / 1.055) ** 2.4)
+
+
+def linear_to_srgb(c):
+    return np.where(c <= 0.0031308, c * 12.92, 1.055 * np.power(np.maximum(c, 0.0031308), 1.0 / 2.4) - 0.055)
+
+
+def generate_mip_chain(rgba):
+    """
+    生成 Mipmap 链
+    颜色在线性空间做 2x2 盒式滤波，alpha 直接平均。
+    :param rgba: HxWx4 uint8
+    :return: 各层 HxWx4 uint8 数组
+    """
+    levels = [rgba]
+    current = rgba.astype(np.float64) / 255.0
+    current[..., :3] = srgb_to_linear(current[..., :3])
+    while current.shape[0] > 1 or current.shape[1] > 1:
+        h, w = current.shape[0], current.shape[1]
+        # 奇数尺寸时复制边缘
+        if h > 1 and h % 2 == 1:
+            current = np.concatenate([current, current[-1:, :, :]], axis=0)
+        if w > 1 and w % 2 == 1:
+            current = np.concatenate([current, current[:, -1:, :]], axis=1)
+        h2, w2 = max(1, h // 2), max(1, w // 2)
+        fy, fx = current.shape[0] // h2, current.shape[1] // w2
+        current = current.reshape(h2, fy, w2, fx, 4).mean(axis=(1, 3))
+
+        out = current.copy()
+        out[..., :3] = linear_to_srgb(out[..., :3])
+        levels.append(np.clip(np.rint(out * 255.0), 0, 255).astype(np.uint8))
+    return levels
+
+# </editor-fold>
+
+# <editor-fold desc="块压缩">
+
+
+def split_blocks(rgba):
+    """
+    将图像切分为 4x4 块，不足的部分复制边缘
+    :return: (块行数, 块列数, Nx16x4 float 数组)
+    """
+    h, w = rgba.shape[0], rgba.shape[1]
+    bh, bw = (h + 3) // 4, (w + 3) // 4
+    padded = np.pad(rgba, ((0, bh * 4 - h), (0, bw * 4 - w), (0, 0)), mode="edge")
+    blocks = padded.reshape(bh, 4, bw, 4, 4).transpose(0, 2, 1, 3, 4).reshape(bh * bw, 16, 4)
+    return bh, bw, blocks.astype(np.float64)
+
+
+def pack_rgb565(c):
+    q = np.rint(c * np.array([31.0, 63.0, 31.0]) / 255.0).astype(np.uint32)
+    return (q[:, 0] << 11) | (q[:, 1] << 5) | q[:, 2]
+
+
+def unpack_rgb565(v):
+    r = (v >> 11) & 0x1F
+    g = (v >> 5) & 0x3F
+    b = v & 0x1F
+    return np.stack([r * 255.0 / 31.0, g * 255.0 / 63.0, b * 255.0 / 31.0], axis=-1)
+
+
+def encode_color_blocks(blocks):
+    """
+    BC1 颜色块编码（包围盒端点 + 最近调色板索引）
+    :param blocks: Nx16x4
+    :return: Nx8 uint8
+    """
+    rgb = blocks[..., :3]
+    lo = rgb.min(axis=1)
+    hi = rgb.max(axis=1)
+    inset = (hi - lo) / 16.0
+    c0 = pack_rgb565(np.clip(hi - inset, 0, 255))
+    c1 = pack_rgb565(np.clip(lo + inset, 0, 255))
+
+    # 保证 c0 > c1，使用 4 色模式
+    swap = c0 < c1
+    c0, c1 = np.where(swap, c1, c0), np.where(swap, c0, c1)
+
+    e0, e1 = unpack_rgb565(c0), unpack_rgb565(c1)
+    palette = np.stack([e0, e1, (2.0 * e0 + e1) / 3.0, (e0 + 2.0 * e1) / 3.0], axis=1)  # Nx4x3
+    dist = ((rgb[:, :, None, :] - palette[:, None, :, :]) ** 2).sum(axis=-1)  # Nx16x4
+    indices = dist.argmin(axis=-1).astype(np.uint32)
+    indices[c0 == c1] = 0
+
+    packed = np.zeros(indices.shape[0], dtype=np.uint32)
+    for i in range(16):
+        packed |= indices[:, i] << np.uint32(2 * i)
+
+    out = np.zeros((indices.shape[0], 8), dtype=np.uint8)
+    out[:, 0:2] = c0.astype("<u2").view(np.uint8).reshape(-1, 2)
+    out[:, 2:4] = c1.astype("<u2").view(np.uint8).reshape(-1, 2)
+    out[:, 4:8] = packed.astype("<u4").view(np.uint8).reshape(-1, 4)
+    return out
+
+
+def encode_alpha_blocks(blocks):
+    """
+    BC3 Alpha 块编码（8 值插值模式）
+    :param blocks: Nx16x4
+    :return: Nx8 uint8
+    """
+    alpha = blocks[..., 3]
+    a0 = alpha.max(axis=1)
+    a1 = alpha.min(axis=1)
+    weights = np.array([[1, 0], [0, 1], [6, 1], [5, 2], [4, 3], [3, 4], [2, 5], [1, 6]], dtype=np.float64)
+    weights[2:] /= 7.0
+    palette = a0[:, None] * weights[None, :, 0] + a1[:, None] * weights[None, :, 1]  # Nx8
+    indices = np.abs(alpha[:, :, None] - palette[:, None, :]).argmin(axis=-1).astype(np.uint64)
+    indices[a0 == a1] = 0
+
+    packed = np.zeros(indices.shape[0], dtype=np.uint64)
+    for i in range(16):
+        packed |= indices[:, i] << np.uint64(3 * i)
+
+    out = np.zeros((indices.shape[0], 8), dtype=np.uint8)
+    out[:, 0] = a0.astype(np.uint8)
+    out[:, 1] = a1.astype(np.uint8)
+    out[:, 2:8] = packed.astype("<u8").view(np.uint8).reshape(-1, 8)[:, 0:6]
+    return out
+
+
+def encode_level(rgba, fmt):
+    if fmt == FORMAT_RGBA8:
+        return np.ascontiguousarray(rgba).tobytes()
+    _, _, blocks = split_blocks(rgba)
+    if fmt == FORMAT_BC1:
+        return encode_color_blocks(blocks).tobytes()
+    assert fmt == FORMAT_BC3
+    return np.concatenate([encode_alpha_blocks(blocks), encode_color_blocks(blocks)], axis=1).tobytes()
+
+# </editor-fold>
+
+# <editor-fold desc="容器">
+
+
+def write_dds(width, height, fmt, levels):
+    dxgi_format, _, block_size, block_bytes = FORMAT_INFO[fmt]
+    flags = 0x1 | 0x2 | 0x4 | 0x1000 | 0x20000  # CAPS | HEIGHT | WIDTH | PIXELFORMAT | MIPMAPCOUNT
+    if block_size > 1:
+        flags |= 0x80000  # LINEARSIZE
+        pitch = len(levels[0])
+    else:
+        flags |= 0x8  # PITCH
+        pitch = width * block_bytes
+    caps = 0x1000  # TEXTURE
+    if len(levels) > 1:
+        caps |= 0x8 | 0x400000  # COMPLEX | MIPMAP
+
+    header = struct.pack("<4s7I44x", b"DDS ", 124, flags, height, width, pitch, 0, len(levels))
+    header += struct.pack("<2I4s5I", 32, 0x4, b"DX10", 0, 0, 0, 0, 0)  # DDS_PIXELFORMAT
+    header += struct.pack("<5I", caps, 0, 0, 0, 0)
+    header += struct.pack("<5I", dxgi_format, 3, 0, 1, 0)  # DDS_HEADER_DXT10
+    return header + b"".join(levels)
+
+
+def make_ktx2_dfd(fmt):
+    """
+    生成 Basic Data Format Descriptor
+    """
+    # 颜色模型：RGBSDA=1, BC1A=128, BC3=130；色域 BT709；传输函数 sRGB
+    if fmt == FORMAT_RGBA8:
+        model, block_dim, plane_bytes = 1, 0, 4
+        samples = [(0, 7, 0), (8, 7, 1), (16, 7, 2), (24, 7, 15 | 0x10)]
+        sample_upper = 255
+    elif fmt == FORMAT_BC1:
+        model, block_dim, plane_bytes = 128, 0x0303, 8
+        samples = [(0, 63, 0)]
+        sample_upper = 0xFFFFFFFF
+    else:
+        model, block_dim, plane_bytes = 130, 0x0303, 16
+        samples = [(0, 63, 15 | 0x10), (64, 63, 0)]
+        sample_upper = 0xFFFFFFFF
+
+    block_size = 24 + 16 * len(samples)
+    body = struct.pack("<IIBBBBIII", 0, 2 | (block_size << 16), model, 1, 2, 0, block_dim, plane_bytes, 0)
+    for offset, length, channel in samples:
+        body += struct.pack("<HBBIII", offset, length, channel, 0, 0, sample_upper)
+    return struct.pack("<I", 4 + len(body)) + body
+
+
+def write_ktx2(width, height, fmt, levels):
+    _, vk_format, _, block_bytes = FORMAT_INFO[fmt]
+    level_count = len(levels)
+    dfd = make_ktx2_dfd(fmt)
+
+    # Mip 数据按照从小到大的顺序存放，并对齐到 lcm(块字节数, 4)
+    alignment = block_bytes if block_bytes % 4 == 0 else block_bytes * 4
+    dfd_offset = 80 + 24 * level_count
+    cursor = dfd_offset + len(dfd)
+    offsets = [0] * level_count
+    data = bytearray()
+    for i in reversed(range(level_count)):
+        padding = (-(cursor + len(data))) % alignment
+        data += b"\0" * padding
+        offsets[i] = cursor + len(data)
+        data += levels[i]
+
+    header = struct.pack("<12s9I", b"\xABKTX 20\xBB\r\n\x1A\n", vk_format, 1, width, height, 0, 0, 1, level_count, 0)
+    header += struct.pack("<4I2Q", dfd_offset, len(dfd), 0, 0, 0, 0)
+    for i in range(level_count):
+        header += struct.pack("<3Q", offsets[i], len(levels[i]), len(levels[i]))
+    return header + dfd + bytes(data)
+
+# </editor-fold>
+
+
+def bake(data, container, fmt, mipmaps):
+    """
+    烘焙一张图片
+    :param data: 源文件内容
+    :param container: dds 或 ktx2
+    :param fmt: 像素格式，auto 表示根据是否有透明通道选择 BC1/BC3
+    :param mipmaps: 是否生成 Mipmap
+    :return: 容器内容
+    """
+    from io import BytesIO
+    with Image.open(BytesIO(data)) as img:
+        rgba = np.asarray(img.convert("RGBA"), dtype=np.uint8)
+    height, width = rgba.shape[0], rgba.shape[1]
+
+    if fmt == "auto":
+        fmt = FORMAT_BC1 if bool((rgba[..., 3] == 255).all()) else FORMAT_BC3
+
+    chain = generate_mip_chain(rgba) if mipmaps else [rgba]
+    levels = [encode_level(level, fmt) for level in chain]
+    if container == "dds":
+        return write_dds(width, height, fmt, levels)
+    return write_ktx2(width, height, fmt, levels)
+
+
+def baked_name(path, container):
+    return os.path.splitext(path)[0] + "." + container
+
+
+def bake_directory(args, container, fmt):
+    output_root = args.output or args.input
+    count = 0
+    for root, _, files in os.walk(args.input):
+        for name in files:
+            if os.path.splitext(name)[1].lower() not in args.extensions:
+                continue
+            source = os.path.join(root, name)
+            target = os.path.join(output_root, os.path.relpath(baked_name(source, container), args.input))
+            if not args.force and os.path.exists(target) and os.path.getmtime(target) >= os.path.getmtime(source):
+                continue
+
+            with open(source, "rb") as f:
+                baked = bake(f.read(), container, fmt, not args.no_mipmaps)
+            os.makedirs(os.path.dirname(target) or ".", exist_ok=True)
+            with open(target, "wb") as f:
+                f.write(baked)
+            count += 1
+            print("%s -> %s" % (source, target))
+    return count
+
+
+def bake_zip(args, container, fmt):
+    if not args.output or os.path.abspath(args.output) == os.path.abspath(args.input):
+        print("Output zip file must be specified and differ from input", file=sys.stderr)
+        sys.exit(1)
+
+    count = 0
+    with zipfile.ZipFile(args.input, "r") as zin, zipfile.ZipFile(args.output, "w", zipfile.ZIP_DEFLATED) as zout:
+        names = set(zin.namelist())
+        for info in zin.infolist():
+            zout.writestr(info, zin.read(info.filename))
+        for info in zin.infolist():
+            if os.path.splitext(info.filename)[1].lower() not in args.extensions:
+                continue
+            target = baked_name(info.filename, container)
+            if target in names:
+                continue  # 已经包含预烘焙的文件
+            # 压缩纹理本身难以再被 deflate，直接存储
+            zout.writestr(target, bake(zin.read(info.filename), container, fmt, not args.no_mipmaps), zipfile.ZIP_STORED)
+            count += 1
+            print("%s -> %s" % (info.filename, target))
+    return count
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Bake textures in an asset pack into DDS/KTX2 containers")
+    parser.add_argument("-i", "--input", required=True, type=str, help="Asset pack directory or zip file")
+    parser.add_argument("-o", "--output", type=str, help="Output directory or zip file, default to input directory")
+    parser.add_argument("-p", "--platform", default="desktop", choices=sorted(PLATFORM_DEFAULTS.keys()),
+                        help="Target platform, determines default container and format")
+    parser.add_argument("-c", "--container", choices=["dds", "ktx2"], help="Override container")
+    parser.add_argument("-f", "--format", choices=["auto", FORMAT_RGBA8, FORMAT_BC1, FORMAT_BC3],
+                        help="Override pixel format, auto picks BC1 for opaque images and BC3 otherwise")
+    parser.add_argument("-e", "--extensions", nargs="+", default=[".png"], help="Source file extensions")
+    parser.add_argument("--no-mipmaps", action="store_true", help="Do not generate mipmaps")
+    parser.add_argument("--force", action="store_true", help="Rebake even if target is newer than source")
+
+    args = parser.parse_args()
+    args.extensions = [e.lower() if e.startswith(".") else "." + e.lower() for e in args.extensions]
+
+    container, fmt = PLATFORM_DEFAULTS[args.platform]
+    container = args.container or container
+    fmt = args.format or fmt
+
+    if os.path.isdir(args.input):
+        count = bake_directory(args, container, fmt)
+    elif zipfile.is_zipfile(args.input):
+        count = bake_zip(args, container, fmt)
+    else:
+        print("Input '%s' is neither a directory nor a zip file" % args.input, file=sys.stderr)
+        sys.exit(1)
+    print("%d texture(s) baked" % count)
+
+
+if __name__ == "__main__":
+    main()